@@ -31,9 +31,13 @@ namespace rocwmma
     // Fwd declare API tags
     struct col_major;
     struct row_major;
+    template <uint32_t TileRows, uint32_t TileCols, typename InnerLayoutT, typename OuterLayoutT>
+    struct blocked_layout;
     struct matrix_a;
     struct matrix_b;
     struct accumulator;
+    struct vgpr_storage;
+    struct agpr_storage;
 
     template <typename MatrixT,
               uint32_t BlockM,
@@ -43,6 +47,14 @@ namespace rocwmma
               typename DataLayoutT>
     class __align__(4) fragment;
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    class __align__(4) native_fragment;
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_INTERNAL_API_FWD_HPP
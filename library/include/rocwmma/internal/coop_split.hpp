@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_COOP_SPLIT_HPP
+#define ROCWMMA_COOP_SPLIT_HPP
+
+#include "tuple.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        constexpr static inline uint32_t coopMaxWaves(uint32_t workItems, uint32_t waveCount)
+        {
+            return (workItems % waveCount == 0 ? waveCount
+                                               : coopMaxWaves(workItems, waveCount / 2));
+        }
+
+        // Reduced stride space of a wave's work items, with the VW dimension added back in.
+        template <class MatrixLayout>
+        constexpr static inline auto coopWaveStrideSpace(uint32_t workItemsPerWave)
+        {
+            constexpr auto strideSpace  = MatrixLayout::strideCounts();
+            constexpr auto strideSpaceR = pop_right(strideSpace);
+            return vector_cat(inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u,
+                              make_vector(get_last(strideSpace)));
+        }
+
+    } // namespace detail
+
+    /*! \struct CoopSplit
+     *  \brief Partitioning of a cooperative load / store over the stride space of a MatrixLayout.
+     *
+     * The reduced stride space (without the VW strides) is split into work items, which are
+     * assigned in contiguous runs of WorkItemsPerWave to waves [0, MaxWaves). Each wave's
+     * share of WaveIOCount IOs is then split into SplitCount contiguous chunks of SplitIOCount
+     * IOs, in flattened stride space order. Chunk s owns registers
+     * [s * SplitIOCount, (s + 1) * SplitIOCount) of the wave's fragment, so chunks are
+     * independent of each other and may be issued and waited on separately.
+     * Issuing all chunks in order is equivalent to the unsplit operation.
+     *
+     * @tparam MatrixLayout in-register layout of the cooperative fragment
+     * @tparam WaveCount number of waves in the collaboration
+     * @tparam SplitCount number of chunks of each wave's share
+     */
+    template <class MatrixLayout, uint32_t WaveCount, uint32_t SplitCount = 1u>
+    struct CoopSplit
+    {
+        enum : uint32_t
+        {
+            TotalWorkItems
+            = flatten_coord_left(pop_right(MatrixLayout::strideCounts()) - 1u,
+                                 pop_right(MatrixLayout::strideCounts()))
+              + 1u,
+            MaxWaves         = detail::coopMaxWaves(TotalWorkItems, WaveCount),
+            WorkItemsPerWave = max((uint32_t)TotalWorkItems / (uint32_t)MaxWaves, 1u),
+            WaveIOCount
+            = flatten_coord_left(detail::coopWaveStrideSpace<MatrixLayout>(WorkItemsPerWave) - 1u,
+                                 detail::coopWaveStrideSpace<MatrixLayout>(WorkItemsPerWave))
+              + 1u,
+            SplitIOCount = WaveIOCount / SplitCount
+        };
+
+        static_assert(MaxWaves <= WaveCount, "Max waves cannot exceed given WaveCount");
+        static_assert(SplitCount > 0u && WaveIOCount % SplitCount == 0u,
+                      "SplitCount must evenly divide the IO count of each wave");
+
+        // Stride space of the current wave's IOs
+        ROCWMMA_HOST_DEVICE constexpr static inline auto waveStrideSpace()
+        {
+            return detail::coopWaveStrideSpace<MatrixLayout>(WorkItemsPerWave);
+        }
+
+        // Matrix offset of the current wave's first work item, relative to the base offset
+        ROCWMMA_HOST_DEVICE constexpr static inline auto waveOffset(uint32_t waveIndex)
+        {
+            constexpr auto strideSpaceR = pop_right(MatrixLayout::strideCounts());
+            constexpr auto stridesR     = pop_right(MatrixLayout::strides());
+            return to_matrix_space(stridesR,
+                                   inflate_coord_left(waveIndex * WorkItemsPerWave, strideSpaceR));
+        }
+
+        // IO (register) index within the wave of the i-th IO of chunk splitIndex
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t ioIndex(uint32_t splitIndex,
+                                                                     uint32_t i)
+        {
+            return splitIndex * SplitIOCount + i;
+        }
+
+        // Matrix offset of the wave's ioIndex-th IO, relative to the wave offset
+        ROCWMMA_HOST_DEVICE constexpr static inline auto ioOffset(uint32_t ioIndex)
+        {
+            constexpr auto strides     = MatrixLayout::strides();
+            constexpr auto strideSpace = waveStrideSpace();
+            return to_matrix_space(strides, inflate_coord_left(ioIndex, strideSpace));
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_COOP_SPLIT_HPP
@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_COOP_STORE_HPP
 #define ROCWMMA_COOP_STORE_HPP
 
+#include "coop_split.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "opaque_store.hpp"
@@ -62,39 +63,57 @@ namespace rocwmma
 
         using StoreVecTraits = VecTraits<typename Traits::StoreT>;
 
+        // Walks the wave's split stride space, whose outer counts are only known at
+        // run-time. Linear data layouts advance the address by each stride offset.
+        // Non-linear data layouts (e.g. blocked) advance the full matrix coordinate.
         // Outer loop = index 0,
         // Inner loop = index N-1
-        template <size_t Depth = 0, typename Iterator, typename StrideSpace, typename Strides2d>
-        ROCWMMA_DEVICE static inline auto unroll_right(DataT*        dataPtr,
-                                                       Iterator&     in,
+        template <size_t Depth = 0, typename Iterator, typename StrideSpace, typename Coord2d>
+        ROCWMMA_DEVICE static inline void unroll_right(Iterator&     out,
+                                                       DataT*        dataPtr,
                                                        uint32_t      ldm,
-                                                       StrideSpace&& strideCounts,
-                                                       Strides2d&&   strides2d)
+                                                       Coord2d       offset2d,
+                                                       StrideSpace&& strideSpace)
         {
-            static_assert(VecTraits<decay_t<StrideSpace>>::size()
-                              == VecTraits<decay_t<Strides2d>>::size(),
-                          "Mismatched size");
-            auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm);
-            auto strideCount  = get<Depth>(strideCounts);
-
-            // Last depth layer will invoke the load
-            if constexpr(Depth == (VecTraits<decay_t<StrideSpace>>::size() - 1u))
-            {
-#pragma unroll
-                for(int i = 0; i < strideCount; i++)
+            auto stride2d = get<Depth>(MatrixLayout::strides());
+
+            auto advance = [&]() {
+                if constexpr((bool)DataLayout::IsLinear)
                 {
-                    Traits::Storer::exec(dataPtr, *in);
-                    dataPtr += strideOffset;
-                    in++;
+                    dataPtr += DataLayout::fromMatrixCoord(stride2d, ldm);
                 }
+                else
+                {
+                    offset2d += stride2d;
+                }
+            };
+
+            // Last depth layer unrolls storing over the VW strides
+            if constexpr(Depth == VecTraits<decay_t<StrideSpace>>::size())
+            {
+                auto store = [&](uint32_t) {
+                    if constexpr((bool)DataLayout::IsLinear)
+                    {
+                        Traits::Storer::exec(dataPtr, *out);
+                    }
+                    else
+                    {
+                        Traits::Storer::exec(
+                            dataPtr + DataLayout::fromMatrixCoord(offset2d, ldm), *out);
+                    }
+                    advance();
+                    out++;
+                };
+
+                unroll_flat<get_last(MatrixLayout::strideCounts())>(store);
             }
             // Recurse to the next nested layer
             else
             {
-                for(int i = 0; i < strideCount; i++)
+                for(uint32_t i = 0; i < get<Depth>(strideSpace); i++)
                 {
-                    unroll_right<Depth + 1>(dataPtr, in, ldm, strideCounts, strides2d);
-                    dataPtr += strideOffset;
+                    unroll_right<Depth + 1>(out, dataPtr, ldm, offset2d, strideSpace);
+                    advance();
                 }
             }
         }
@@ -135,10 +154,6 @@ namespace rocwmma
             auto workItemsPerWave = max(totalWorkItems / maxWaves, 1u);
             auto strideSpaceS     = inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u;
 
-            // Add back in the VW dimension, for the full stride
-            // space of the current wave
-            auto strideSpaceW = vector_cat(strideSpaceS, make_vector(get_last(strideSpace)));
-
             auto it = makeVectorIterator<StoreVecTraits::size()>(data).begin();
 
             // Align threads to starting matrix offset coordinates
@@ -149,71 +164,79 @@ namespace rocwmma
             auto           currentWaveOffset = apply(
                 sum, inflate_coord_left(waveIndex * workItemsPerWave, strideSpaceR) * stridesR);
 
-            unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
-                         it,
-                         ldm,
-                         strideSpaceW,
-                         strides);
+            // The split stride space is only known at run-time, so walk its outer
+            // strides in loops and unroll only over the VW strides.
+            auto waveOffset2d = baseOffset + currentWaveOffset;
+            if constexpr((bool)DataLayout::IsLinear)
+            {
+                unroll_right(it,
+                             dataPtr + DataLayout::fromMatrixCoord(waveOffset2d, ldm),
+                             ldm,
+                             waveOffset2d,
+                             strideSpaceS);
+            }
+            else
+            {
+                unroll_right(it, dataPtr, ldm, waveOffset2d, strideSpaceS);
+            }
         }
 
-        template <uint32_t WaveCount>
+        // SplitCount / SplitIndex select one of SplitCount independent chunks of the
+        // current wave's share (see CoopSplit). The default issues the whole share.
+        template <uint32_t WaveCount, uint32_t SplitCount = 1u, uint32_t SplitIndex = 0u>
         ROCWMMA_DEVICE static inline void exec(DataT*                         dataPtr,
                                                typename Traits::InputT const& data,
                                                uint32_t                       ldm,
                                                uint32_t                       waveIndex)
         {
-            // Full fragment work
-            constexpr auto strideSpace = MatrixLayout::strideCounts();
-            constexpr auto strides     = MatrixLayout::strides();
+            using Split = CoopSplit<MatrixLayout, WaveCount, SplitCount>;
 
-            // Drop the VW strides for splitting (reduced stride space).
-            constexpr auto strideSpaceR = pop_right(strideSpace);
-            constexpr auto stridesR     = pop_right(strides);
-            constexpr auto totalWorkItems
-                = flatten_coord_left((strideSpaceR - 1u), strideSpaceR) + 1u;
-
-            // Determine max waves possible.
-            constexpr auto maxWaves = calcMaxWaves((uint32_t)totalWorkItems, (uint32_t)WaveCount);
+            static_assert(SplitIndex < SplitCount, "SplitIndex must be less than SplitCount");
 
             // maxWaves is the maximum amount of waves split the work into.
             // For the rest of the waves, bail out
-            if constexpr(WaveCount != maxWaves)
+            if constexpr(WaveCount != Split::MaxWaves)
             {
-                if(__builtin_amdgcn_readfirstlane(waveIndex) >= maxWaves)
+                if(__builtin_amdgcn_readfirstlane(waveIndex) >= Split::MaxWaves)
                 {
                     return; // bail
                 }
             }
 
-            // Split the reduced stride space.
-            constexpr auto workItemsPerWave = max(totalWorkItems / maxWaves, 1u);
-            constexpr auto strideSpaceS
-                = inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u;
-
-            // Add back in the VW dimension, for the full stride
-            // space of the current wave
-            constexpr auto strideSpaceW
-                = vector_cat(strideSpaceS, make_vector(get_last(strideSpace)));
-
             // Alias the original frag due to smaller split size
             auto& dataR = (typename StoreVecTraits::template VecT<
                            DataT,
-                           workItemsPerWave * StoreVecTraits::size()> const&)(data);
-            auto  it    = makeVectorIterator<StoreVecTraits::size()>(dataR).begin();
+                           Split::WaveIOCount * StoreVecTraits::size()> const&)(data);
+            auto it = makeVectorIterator<StoreVecTraits::size()>(dataR).it(
+                Split::ioIndex(SplitIndex, 0u));
 
             // Align threads to starting matrix offset coordinates
             auto baseOffset = MatrixLayout::baseOffset();
 
-            // Find current wave offset
-            constexpr auto sum               = [](auto... items) { return (items + ...); };
-            auto           currentWaveOffset = apply(
-                sum, inflate_coord_left(waveIndex * workItemsPerWave, strideSpaceR) * stridesR);
+            // Linear data layouts offset the wave's base address by each stride offset.
+            // Non-linear data layouts (e.g. blocked) must map each full matrix coordinate.
+            auto waveOffset2d = baseOffset + Split::waveOffset(waveIndex);
+            auto basePtr      = dataPtr + DataLayout::fromMatrixCoord(waveOffset2d, ldm);
+
+            // Unroll storing over the current chunk of the wave's flattened stride space.
+            // Outer loop = index 0,
+            // Inner loop = index N-1
+            auto store = [&](uint32_t i) {
+                auto offset2d = Split::ioOffset(Split::ioIndex(SplitIndex, i));
+
+                if constexpr((bool)DataLayout::IsLinear)
+                {
+                    Traits::Storer::exec(basePtr + DataLayout::fromMatrixCoord(offset2d, ldm), *it);
+                }
+                else
+                {
+                    Traits::Storer::exec(
+                        dataPtr + DataLayout::fromMatrixCoord(waveOffset2d + offset2d, ldm), *it);
+                }
+                it++;
+            };
 
-            unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
-                         it,
-                         ldm,
-                         strideSpaceW,
-                         strides);
+            unroll_flat<Split::SplitIOCount>(store);
         }
     };
 
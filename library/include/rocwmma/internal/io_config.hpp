@@ -30,9 +30,12 @@
 #include "coop_load.hpp"
 #include "coop_store.hpp"
 #include "io_shape.hpp"
+#include "opaque_atomic_store.hpp"
+#include "opaque_broadcast_load.hpp"
 #include "opaque_load.hpp"
 #include "opaque_store.hpp"
 #include "pack_util.hpp"
+#include "packed_io.hpp"
 #include "types.hpp"
 
 namespace rocwmma
@@ -60,6 +63,10 @@ namespace rocwmma
  * @param MappingUtil global mapping utility for current fragment
  * @param Loader Issues load instructions for raw fragment data
  * @param Storer Issues store instructions for raw fragment data
+ * @param AtomicStorer Issues atomic add instructions for raw fragment data
+ * @param OrderedStorer Issues non-atomic read-modify-write adds for raw fragment data
+ * @param BroadcastLoader Issues loads of a 1D vector replicated across raw fragment data
+ * @param Packer Packs raw fragment data into, and loads / stores it from, the pre-packed format
  */
 
     template <typename MatrixT,
@@ -94,6 +101,39 @@ namespace rocwmma
                                    typename IOLayout::DataLayout,
                                    typename IOLayout::MatrixLayout,
                                    IOLayout::VW>;
+
+        using AtomicStorer = OpaqueAtomicStore<IOShape::BlockDim,
+                                               IOShape::KDim,
+                                               DataT,
+                                               typename IOLayout::DataLayout,
+                                               typename IOLayout::MatrixLayout,
+                                               IOLayout::VW>;
+
+        using OrderedStorer
+            = OpaqueAtomicStore<IOShape::BlockDim,
+                                IOShape::KDim,
+                                DataT,
+                                typename IOLayout::DataLayout,
+                                typename IOLayout::MatrixLayout,
+                                IOLayout::VW,
+                                detail::amdgcn_opaque_ordered_add<DataT, IOLayout::VW>>;
+
+        // VectorIndex 0 : column vector, 1 : row vector
+        template <uint32_t VectorIndex>
+        using BroadcastLoader = OpaqueBroadcastLoad<IOShape::BlockDim,
+                                                    IOShape::KDim,
+                                                    DataT,
+                                                    typename IOLayout::DataLayout,
+                                                    typename IOLayout::MatrixLayout,
+                                                    IOLayout::VW,
+                                                    VectorIndex>;
+
+        using Packer = PackedIO<IOShape::BlockDim,
+                                IOShape::KDim,
+                                DataT,
+                                typename IOLayout::DataLayout,
+                                typename IOLayout::MatrixLayout,
+                                IOLayout::VW>;
     };
 
     /************************************************
@@ -100,6 +100,18 @@ namespace rocwmma
             };
         };
 
+        // Order of contiguous elements in memory, as row_major or col_major
+        template <typename DataLayoutT>
+        using DataOrientation_t = typename DataLayout::template Array1d<DataLayoutT>::Orientation;
+
+        // Vectors may not cross the contiguous extent of the data layout (e.g. blocked tiles)
+        template <typename DataLayoutT>
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t contiguousVW(uint32_t vectorWidth)
+        {
+            return min(vectorWidth,
+                       (uint32_t)DataLayout::template Array1d<DataLayoutT>::MaxContiguous);
+        }
+
     } // namespace detail
 
     /*! \struct IOLayout
@@ -110,7 +122,7 @@ namespace rocwmma
  * @tparam BlockDim Block leading dimension
  * @tparam BlockK Block K-dimension
  * @tparam DataT data type
- * @tparam DataLayoutT in-memory layout as col_major or row_major
+ * @tparam DataLayoutT in-memory layout as col_major, row_major or blocked_layout
  * @tparam WaveCount number of cooperative waves
  */
     template <typename MatrixT,
@@ -134,7 +146,10 @@ namespace rocwmma
             MaxVW = detail::
                 MaxVWSelector<matrix_a, BlockDim, BlockK, DataT, DataLayoutT, WaveCount>::Result,
 
-            VW = is_same<DataLayoutT, row_major>::value || BlockDim > 32 ? MaxVW : 1u
+            VW = detail::contiguousVW<DataLayoutT>(
+                is_same<detail::DataOrientation_t<DataLayoutT>, row_major>::value || BlockDim > 32
+                    ? MaxVW
+                    : 1u)
         };
 
         // Layout profile for 'matrix_a': ColNT for small frags, Col for large frags
@@ -161,7 +176,10 @@ namespace rocwmma
             MaxVW = detail::
                 MaxVWSelector<matrix_b, BlockDim, BlockK, DataT, DataLayoutT, WaveCount>::Result,
 
-            VW = is_same<DataLayoutT, col_major>::value || BlockDim > 32 ? MaxVW : 1u
+            VW = detail::contiguousVW<DataLayoutT>(
+                is_same<detail::DataOrientation_t<DataLayoutT>, col_major>::value || BlockDim > 32
+                    ? MaxVW
+                    : 1u)
         };
 
         // Layout profile for 'matrix_b': RowNT for small frags, Row for large frags
@@ -186,7 +204,8 @@ namespace rocwmma
         enum : uint32_t
         {
             MaxVW = (is_same<DataT, float64_t>::value || ROCWMMA_ARCH_GFX11) ? 1u : 4u,
-            VW    = is_same<DataLayoutT, col_major>::value ? MaxVW : 1u
+            VW    = detail::contiguousVW<DataLayoutT>(
+                is_same<detail::DataOrientation_t<DataLayoutT>, col_major>::value ? MaxVW : 1u)
         };
 
         // Layout profile for 'accumulator' set to RowNT
@@ -33,6 +33,9 @@ namespace rocwmma
     // In relation to matrix space, DataLayouts describe whether consecutive elements in 1D data arrays are:
     // 1. Contiguous rows (row_major)
     // 2. Contiguous columns (col_major)
+    // 3. Contiguous tiles, of rows or columns (blocked_layout)
+    // Profiles select matrix layouts by Orientation: the row_major or col_major order of
+    // contiguous elements.
     namespace DataLayout
     {
         template <typename DataLayoutT>
@@ -41,6 +44,12 @@ namespace rocwmma
         using RowMajor = Array1d<row_major>;
         using ColMajor = Array1d<col_major>;
 
+        template <uint32_t TileRows,
+                  uint32_t TileCols,
+                  typename InnerLayoutT,
+                  typename OuterLayoutT>
+        using Blocked = Array1d<blocked_layout<TileRows, TileCols, InnerLayoutT, OuterLayoutT>>;
+
     } // namespace DataLayout
 
     // In 2D space, Matrix Layouts describe per-thread offset coordinates and iterative spaces
@@ -121,8 +130,9 @@ namespace rocwmma
         {
             // Layouts
             using DataLayout   = DataLayout::template Array1d<DataLayoutT>;
+            using Orientation  = typename DataLayout::Orientation;
             using MatrixLayout = conditional_t<
-                is_same_v<DataLayoutT, col_major>,
+                is_same_v<Orientation, col_major>,
                 MatrixLayout::ColOrthoVW<BlockDim, BlockK, DataT, 1, MaxVectorWidth>,
                 MatrixLayout::ColOrthoVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>>;
             using RegisterLayout = RegisterLayout::template Soa<BlockDim, MaxVectorWidth>;
@@ -136,12 +146,12 @@ namespace rocwmma
             // elements in both row_major or col_major data layouts.
             // This layout cannot support for VW > 1 in col_major data layout otherwise the
             // ordering is broken.
-            static_assert(!(is_same_v<DataLayoutT, col_major> && VectorWidth > 1),
+            static_assert(!(is_same_v<Orientation, col_major> && VectorWidth > 1),
                           "ColNT in col_major does not support VectorWidth > 1");
 
             // Must ensure that MaxVectorWidth fits inside the leading dimension
             static_assert(
-                !(is_same_v<DataLayoutT, row_major> && (MaxVectorWidth > BlockK)),
+                !(is_same_v<Orientation, row_major> && (MaxVectorWidth > BlockK)),
                 "MaxVectorWidth is larger than BlockK dimension. Try reducing MaxVectorWidth");
         };
 
@@ -163,8 +173,9 @@ namespace rocwmma
         {
             // Layouts
             using DataLayout   = DataLayout::template Array1d<DataLayoutT>;
+            using Orientation  = typename DataLayout::Orientation;
             using MatrixLayout = conditional_t<
-                is_same_v<DataLayoutT, col_major>,
+                is_same_v<Orientation, col_major>,
                 MatrixLayout::RowOrthoVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>,
                 MatrixLayout::RowOrthoVW<BlockDim, BlockK, DataT, 1, MaxVectorWidth>>;
             using RegisterLayout = RegisterLayout::template Soa<BlockDim, MaxVectorWidth>;
@@ -177,12 +188,12 @@ namespace rocwmma
             // RowNT enforces consistent in-register alignment of contiguous matrix row
             // elements in both in row_major or col_major data layouts.
             // This layout cannot support for VW > 1 in row_major data layout.
-            static_assert(!(is_same_v<DataLayoutT, row_major> && VectorWidth > 1),
+            static_assert(!(is_same_v<Orientation, row_major> && VectorWidth > 1),
                           "RowNT in row_major does not support VectorWidth > 1");
 
             // Must ensure that MaxVectorWidth fits inside the leading dimension
             static_assert(
-                !(is_same_v<DataLayoutT, col_major> && (MaxVectorWidth > BlockK)),
+                !(is_same_v<Orientation, col_major> && (MaxVectorWidth > BlockK)),
                 "MaxVectorWidth is larger than BlockK dimension. Try reducing MaxVectorWidth");
         };
 
@@ -207,12 +218,13 @@ namespace rocwmma
         {
             // Layouts
             using DataLayout   = DataLayout::template Array1d<DataLayoutT>;
+            using Orientation  = typename DataLayout::Orientation;
             using MatrixLayout = conditional_t<
-                is_same_v<DataLayoutT, col_major>,
+                is_same_v<Orientation, col_major>,
                 MatrixLayout::ColInlineVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>,
                 MatrixLayout::ColOrthoVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>>;
             using RegisterLayout
-                = conditional_t<is_same_v<DataLayoutT, col_major>,
+                = conditional_t<is_same_v<Orientation, col_major>,
                                      RegisterLayout::template Aos<BlockDim, MaxVectorWidth>,
                                      RegisterLayout::template Soa<BlockDim, MaxVectorWidth>>;
 
@@ -223,7 +235,7 @@ namespace rocwmma
             // Sanity checks
             // Must ensure that MaxVectorWidth fits inside the leading dimension
             static_assert(
-                !(is_same_v<DataLayoutT, row_major> && (MaxVectorWidth > BlockK)),
+                !(is_same_v<Orientation, row_major> && (MaxVectorWidth > BlockK)),
                 "MaxVectorWidth is larger than BlockK dimension. Try reducing MaxVectorWidth");
         };
 
@@ -248,12 +260,13 @@ namespace rocwmma
         {
             // Layouts
             using DataLayout   = DataLayout::template Array1d<DataLayoutT>;
+            using Orientation  = typename DataLayout::Orientation;
             using MatrixLayout = conditional_t<
-                is_same_v<DataLayoutT, row_major>,
+                is_same_v<Orientation, row_major>,
                 MatrixLayout::RowInlineVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>,
                 MatrixLayout::RowOrthoVW<BlockDim, BlockK, DataT, VectorWidth, MaxVectorWidth>>;
             using RegisterLayout
-                = conditional_t<is_same_v<DataLayoutT, row_major>,
+                = conditional_t<is_same_v<Orientation, row_major>,
                                      RegisterLayout::template Aos<BlockDim, MaxVectorWidth>,
                                      RegisterLayout::template Soa<BlockDim, MaxVectorWidth>>;
 
@@ -264,7 +277,7 @@ namespace rocwmma
             // Sanity checks
             // Must ensure that MaxVectorWidth fits inside the leading dimension
             static_assert(
-                !(is_same_v<DataLayoutT, col_major> && (MaxVectorWidth > BlockK)),
+                !(is_same_v<Orientation, col_major> && (MaxVectorWidth > BlockK)),
                 "MaxVectorWidth is larger than BlockK dimension. Try reducing MaxVectorWidth");
         };
         
@@ -141,14 +141,14 @@ namespace rocwmma
                 using MatrixCoordT = Coord2d;
             };
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                    (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                    (uint32_t)Traits::VWSegs); // VW Segments
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 return make_vector(
                     make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -159,17 +159,24 @@ namespace rocwmma
             }
 
             ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+            {
+                return baseOffset(threadIdx.x);
+            }
+
+            // Lane-parameterized base offset, also usable for host-side layout models
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t laneId)
             {
                 if constexpr((uint32_t)Traits::BlockDimStride_X >= (uint32_t)Traits::WaveSize)
                 {
                     // Don't need initial offset calc in Y direction: all threads fit in neighbouring rows
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X, 0u);
+                    return make_coord2d(laneId % (uint32_t)Traits::BlockDimStride_X, 0u);
                 }
                 else
                 {
                     // Threads need to spread over the Y direction as well
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X,
-                                        (threadIdx.x / (uint32_t)Traits::BlockDimStride_X)
+                    return make_coord2d(laneId % (uint32_t)Traits::BlockDimStride_X,
+                                        (laneId / (uint32_t)Traits::BlockDimStride_X)
                                             * MaxVectorWidth % (uint32_t)Traits::BlockKStride_Y);
                 }
             }
@@ -243,7 +250,7 @@ namespace rocwmma
                 return make_coord2d(BlockDimOffsetX, VWOffsetY + BlockKOffsetY);
             }
 
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 int32_t cumVWOffsetY
@@ -257,6 +264,41 @@ namespace rocwmma
 
                 return make_coord2d(cumBlockDimOffsetX, cumVWOffsetY + cumBlockKOffsetY);
             }
+
+            // Offset of register element elementIdx from the lane's base offset.
+            // Elements are ordered by IO iteration, VectorWidth elements at a time.
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                elementOffset(uint32_t elementIdx)
+            {
+                return cumulativeOffset(elementIdx / VectorWidth)
+                       + make_coord2d(0u, elementIdx % VectorWidth);
+            }
+
+            // Matrix coord of register element elementIdx held by laneId.
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                matrixCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return baseOffset(laneId) + elementOffset(elementIdx);
+            }
+
+            // Inverse of matrixCoord: (laneId, elementIdx) of the register holding coord
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                registerCoord(typename Traits::MatrixCoordT const& coord)
+            {
+                auto blockKOffset = get<1>(coord) % (uint32_t)Traits::BlockKStride_Y;
+                auto vwOffset     = blockKOffset % MaxVectorWidth;
+
+                auto laneId = blockKOffset / MaxVectorWidth * (uint32_t)Traits::BlockDimStride_X
+                              + get<0>(coord) % (uint32_t)Traits::BlockDimStride_X;
+                auto iteration
+                    = ((get<0>(coord) / (uint32_t)Traits::BlockDimStride_X)
+                           * (uint32_t)Traits::BlockKSegs
+                       + get<1>(coord) / (uint32_t)Traits::BlockKStride_Y)
+                          * (uint32_t)Traits::VWSegs
+                      + vwOffset / VectorWidth;
+
+                return make_coord2d(laneId, iteration * VectorWidth + vwOffset % VectorWidth);
+            }
         };
 
         /* Pattern that maps threads to matrix columns and assumes
@@ -402,14 +444,14 @@ namespace rocwmma
                 using MatrixCoordT = Coord2d;
             };
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                    (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                    (uint32_t)Traits::VWSegs); // VW Segments
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 return make_vector(
                     make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -420,19 +462,26 @@ namespace rocwmma
             }
 
             ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+            {
+                return baseOffset(threadIdx.x);
+            }
+
+            // Lane-parameterized base offset, also usable for host-side layout models
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t laneId)
             {
                 if constexpr(((uint32_t)Traits::BlockDimStride_X >= (uint32_t)Traits::WaveSize)
                              && (MaxVectorWidth == 1))
                 {
                     // Don't need initial offset calc in Y direction: all threads fit in neighbouring rows
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X, 0u);
+                    return make_coord2d(laneId % (uint32_t)Traits::BlockDimStride_X, 0u);
                 }
                 else
                 {
                     // Threads need to spread over the Y direction as well
                     return make_coord2d(
-                        threadIdx.x * MaxVectorWidth % (uint32_t)Traits::BlockDimStride_X,
-                        threadIdx.x * MaxVectorWidth / (uint32_t)Traits::BlockDimStride_X
+                        laneId * MaxVectorWidth % (uint32_t)Traits::BlockDimStride_X,
+                        laneId * MaxVectorWidth / (uint32_t)Traits::BlockDimStride_X
                             % (uint32_t)Traits::BlockKStride_Y);
                 }
             }
@@ -508,7 +557,7 @@ namespace rocwmma
             }
 
             // Cumulative iteration offset
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 int32_t cumVWOffsetX
@@ -522,6 +571,43 @@ namespace rocwmma
 
                 return make_coord2d(cumVWOffsetX + cumBlockDimOffsetX, cumBlockKOffsetY);
             }
+
+            // Offset of register element elementIdx from the lane's base offset.
+            // Elements are ordered by IO iteration, VectorWidth elements at a time.
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                elementOffset(uint32_t elementIdx)
+            {
+                return cumulativeOffset(elementIdx / VectorWidth)
+                       + make_coord2d(elementIdx % VectorWidth, 0u);
+            }
+
+            // Matrix coord of register element elementIdx held by laneId.
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                matrixCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return baseOffset(laneId) + elementOffset(elementIdx);
+            }
+
+            // Inverse of matrixCoord: (laneId, elementIdx) of the register holding coord
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                registerCoord(typename Traits::MatrixCoordT const& coord)
+            {
+                auto blockDimOffset = get<0>(coord) % (uint32_t)Traits::BlockDimStride_X;
+                auto blockKOffset   = get<1>(coord) % (uint32_t)Traits::BlockKStride_Y;
+                auto vwOffset       = blockDimOffset % MaxVectorWidth;
+
+                auto laneId
+                    = (blockKOffset * (uint32_t)Traits::BlockDimStride_X + blockDimOffset)
+                      / MaxVectorWidth;
+                auto iteration
+                    = ((get<0>(coord) / (uint32_t)Traits::BlockDimStride_X)
+                           * (uint32_t)Traits::BlockKSegs
+                       + get<1>(coord) / (uint32_t)Traits::BlockKStride_Y)
+                          * (uint32_t)Traits::VWSegs
+                      + vwOffset / VectorWidth;
+
+                return make_coord2d(laneId, iteration * VectorWidth + vwOffset % VectorWidth);
+            }
         };
 
         template <uint32_t BlockDim,
@@ -546,12 +632,18 @@ namespace rocwmma
                 return swap(Traits::OrthoLayout::baseOffset());
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t laneId)
+            {
+                return swap(Traits::OrthoLayout::baseOffset(laneId));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return Traits::OrthoLayout::strideCounts();
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 auto t = Traits::OrthoLayout::strides();
                 return make_vector(
@@ -563,11 +655,29 @@ namespace rocwmma
             {
                 return swap(Traits::OrthoLayout::incrementalOffset(iteration));
             }
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 return swap(Traits::OrthoLayout::cumulativeOffset(iteration));
             }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                elementOffset(uint32_t elementIdx)
+            {
+                return swap(Traits::OrthoLayout::elementOffset(elementIdx));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                matrixCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return swap(Traits::OrthoLayout::matrixCoord(laneId, elementIdx));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                registerCoord(typename Traits::MatrixCoordT const& coord)
+            {
+                return Traits::OrthoLayout::registerCoord(swap(coord));
+            }
         };
 
         template <uint32_t BlockDim,
@@ -592,12 +702,18 @@ namespace rocwmma
                 return swap(Traits::OrthoLayout::baseOffset());
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t laneId)
+            {
+                return swap(Traits::OrthoLayout::baseOffset(laneId));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return Traits::OrthoLayout::strideCounts();
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 auto t = Traits::OrthoLayout::strides();
                 return make_vector(
@@ -609,11 +725,29 @@ namespace rocwmma
             {
                 return swap(Traits::OrthoLayout::incrementalOffset(iteration));
             }
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 return swap(Traits::OrthoLayout::cumulativeOffset(iteration));
             }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                elementOffset(uint32_t elementIdx)
+            {
+                return swap(Traits::OrthoLayout::elementOffset(elementIdx));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                matrixCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return swap(Traits::OrthoLayout::matrixCoord(laneId, elementIdx));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                registerCoord(typename Traits::MatrixCoordT const& coord)
+            {
+                return Traits::OrthoLayout::registerCoord(swap(coord));
+            }
         };
 
     } // namespace MatrixLayout
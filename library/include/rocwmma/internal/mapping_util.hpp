@@ -34,6 +34,8 @@ namespace rocwmma
     // Fwd declaration
     struct row_major;
     struct col_major;
+    template <uint32_t TileRows, uint32_t TileCols, typename InnerLayoutT, typename OuterLayoutT>
+    struct blocked_layout;
 
     namespace detail
     {
@@ -95,14 +97,68 @@ namespace rocwmma
             enum : uint32_t
             {
                 MajorIndex = is_same<DataOrientation, row_major>::value ? 0 : 1,
-                MinorIndex = is_same<DataOrientation, row_major>::value ? 1 : 0
+                MinorIndex = is_same<DataOrientation, row_major>::value ? 1 : 0,
+
+                // Offsets are linear in the matrix coordinate, so IO can step
+                // data pointers by fixed stride offsets.
+                IsLinear = 1u,
+
+                // Max count of contiguous elements in the minor dimension
+                MaxContiguous = ~0u
+            };
+
+            // Determine the leading dimension of a matrix.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
+
+            // Global data coordinate space (1d element) transform for a matrix coordinate.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim);
+        };
+
+        /*
+    Blocked data space: contiguous TileRows x TileCols tiles, with elements in InnerLayoutT
+    order within each tile and tiles in OuterLayoutT order. The leading dimension is the
+    matrix leading dimension in OuterLayoutT, in elements.
+    */
+        template <uint32_t TileRows,
+                  uint32_t TileCols,
+                  typename InnerLayoutT,
+                  typename OuterLayoutT>
+        struct DataSpace<blocked_layout<TileRows, TileCols, InnerLayoutT, OuterLayoutT>>
+        {
+            using MatrixCoordT = Coord2d;
+            using MatrixSizeT  = Coord2d;
+
+            using InnerSpace = DataSpace<InnerLayoutT>;
+            using OuterSpace = DataSpace<OuterLayoutT>;
+
+            // Vector IO follows the element order within tiles
+            using Orientation = InnerLayoutT;
+
+            enum : uint32_t
+            {
+                MajorIndex = InnerSpace::MajorIndex,
+                MinorIndex = InnerSpace::MinorIndex,
+
+                TileSize = TileRows * TileCols,
+
+                // Offsets jump between tiles
+                IsLinear = 0u,
+
+                // Contiguous elements in the minor dimension end at the tile edge
+                MaxContiguous = (uint32_t)MinorIndex == 1u ? TileCols : TileRows
             };
 
+            static_assert(TileRows > 0u && (TileRows & (TileRows - 1u)) == 0u,
+                          "TileRows must be a power of 2");
+            static_assert(TileCols > 0u && (TileCols & (TileCols - 1u)) == 0u,
+                          "TileCols must be a power of 2");
+
             // Determine the leading dimension of a matrix.
-            ROCWMMA_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
 
             // Global data coordinate space (1d element) transform for a matrix coordinate.
-            ROCWMMA_DEVICE constexpr static inline auto
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
                 fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim);
         };
 
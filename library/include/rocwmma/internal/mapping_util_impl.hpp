@@ -133,14 +133,14 @@ namespace rocwmma
 
         /// DataSpace
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::leadingDim(MatrixSizeT const& matrixSize)
         {
             return get<MinorIndex>(matrixSize);
         }
 
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::fromMatrixCoord(MatrixCoordT const& matrixCoord,
                                                         uint32_t            leadingDim)
         {
@@ -148,6 +148,38 @@ namespace rocwmma
             return get<MajorIndex>(matrixCoord) * leadingDim + get<MinorIndex>(matrixCoord);
         }
 
+        template <uint32_t TileRows,
+                  uint32_t TileCols,
+                  typename InnerLayoutT,
+                  typename OuterLayoutT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            DataSpace<blocked_layout<TileRows, TileCols, InnerLayoutT, OuterLayoutT>>::leadingDim(
+                MatrixSizeT const& matrixSize)
+        {
+            return OuterSpace::leadingDim(matrixSize);
+        }
+
+        template <uint32_t TileRows,
+                  uint32_t TileCols,
+                  typename InnerLayoutT,
+                  typename OuterLayoutT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            DataSpace<blocked_layout<TileRows, TileCols, InnerLayoutT, OuterLayoutT>>::
+                fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim)
+        {
+            constexpr auto tileSize = make_coord2d(TileRows, TileCols);
+
+            auto tileCoord  = make_coord2d(get<0>(matrixCoord) / TileRows,
+                                           get<1>(matrixCoord) / TileCols);
+            auto innerCoord = make_coord2d(get<0>(matrixCoord) % TileRows,
+                                           get<1>(matrixCoord) % TileCols);
+
+            // Tile offset in a grid of tiles, then element offset within the tile
+            auto tileLeadingDim = leadingDim / get<OuterSpace::MinorIndex>(tileSize);
+            return OuterSpace::fromMatrixCoord(tileCoord, tileLeadingDim) * (uint32_t)TileSize
+                   + InnerSpace::fromMatrixCoord(innerCoord, InnerSpace::leadingDim(tileSize));
+        }
+
     } // namespace detail
 
     template <uint32_t BlockHeight, uint32_t BlockWidth, typename DataT, typename DataLayout>
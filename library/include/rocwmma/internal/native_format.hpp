@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_NATIVE_FORMAT_HPP
+#define ROCWMMA_NATIVE_FORMAT_HPP
+
+#include "api_fwd.hpp"
+#include "config.hpp"
+#include "io_shape.hpp"
+#include "io_traits.hpp"
+#include "pack_util.hpp"
+#include "swizzle.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+#include "vector_util.hpp"
+#include "wmma_impl.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Register format in which the mma backend consumes fragment data.
+        // By default, mma operates directly on packed fragment storage and
+        // conversions are no-ops.
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename Enabler = void>
+        struct amdgcn_native_format
+        {
+            template <typename PackedRegsT>
+            using NativeRegsT = PackedRegsT;
+
+            template <typename PackedRegsT>
+            ROCWMMA_DEVICE static inline auto format(PackedRegsT const& regs)
+            {
+                return regs;
+            }
+
+            template <typename NativeRegsT>
+            ROCWMMA_DEVICE static inline auto unformat(NativeRegsT const& regs)
+            {
+                return regs;
+            }
+        };
+
+// WMMA native formats are specific to gfx11 architecture
+#if ROCWMMA_ARCH_GFX11
+
+        template <typename DataT>
+        constexpr bool is_wmma_input_v
+            = is_same_v<DataT, float16_t> || is_same_v<DataT, hfloat16_t>
+              || is_same_v<DataT, bfloat16_t> || is_same_v<DataT, int8_t>;
+
+        template <typename DataT>
+        constexpr bool is_wmma_compute_v
+            = is_same_v<DataT, float16_t> || is_same_v<DataT, hfloat16_t>
+              || is_same_v<DataT, bfloat16_t> || is_same_v<DataT, float32_t>
+              || is_same_v<DataT, int32_t>;
+
+        // WMMA inputs A / B.
+        // Each WMMA expects its packed K-slice to be duplicated across lanes i and i + 16:
+        // evens hold the original elements, odds hold the Swap16 neighbours.
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT>
+        struct amdgcn_native_format<
+            MatrixT,
+            BlockM,
+            BlockN,
+            BlockK,
+            DataT,
+            enable_if_t<(is_same_v<MatrixT, matrix_a> || is_same_v<MatrixT, matrix_b>)
+                        && is_wmma_input_v<DataT> && (BlockM == 16) && (BlockN == 16)
+                        && (BlockK >= 16) && (BlockK % 16 == 0)>>
+        {
+            using IOShape  = IOShape<MatrixT, BlockM, BlockN, BlockK>;
+            using IOTraits = IOTraits<IOShape::BlockDim, IOShape::KDim, DataT>;
+            using PackedT  = typename PackTraits<DataT>::PackedT;
+
+            enum : uint32_t
+            {
+                // All gfx11 WMMA builtins consume K = 16 per invocation
+                WmmaCount  = BlockK / 16u,
+                PackedSize = IOTraits::PackedSize / WmmaCount,
+                NativeSize = PackedSize * 2u,
+            };
+
+            template <typename PackedRegsT>
+            using NativeRegsT = VecT<PackedT, WmmaCount * NativeSize>;
+
+            ROCWMMA_DEVICE static inline auto
+                format(VecT<PackedT, IOTraits::PackedSize> const& regs)
+            {
+                NativeRegsT<void> result;
+
+                auto const inIt  = makeVectorIterator<PackedSize>(regs).begin();
+                auto       outIt = makeVectorIterator<NativeSize>(result).begin();
+
+#pragma unroll
+                for(uint32_t i = 0; i < WmmaCount; i++)
+                {
+                    auto swapped = Swizzle::Swap16::exec(*inIt);
+                    *outIt       = concat(unpackLo(*inIt, swapped), unpackHi(*inIt, swapped));
+
+                    inIt++;
+                    outIt++;
+                }
+
+                return result;
+            }
+        };
+
+        // Output register select of the WMMA backend accumulating into DataT.
+        // 16b accumulators accumulate with inputs of the same type.
+        // 32b accumulators fill whole registers and are not padded.
+        template <typename DataT, uint32_t BlockM, uint32_t BlockN, typename Enabler = void>
+        struct wmma_accum_bits
+        {
+            enum : uint32_t
+            {
+                value = WmmaCtrlFlags::LOW
+            };
+        };
+
+        template <typename DataT, uint32_t BlockM, uint32_t BlockN>
+        struct wmma_accum_bits<DataT, BlockM, BlockN, enable_if_t<(sizeof(DataT) < 4u)>>
+        {
+            enum : uint32_t
+            {
+                value = amdgcn_wmma<DataT, DataT, BlockM, BlockN>::Traits::AccumBits
+            };
+        };
+
+        // WMMA accumulator.
+        // The accumulator is unpacked and each element is padded to 32b. The 16b
+        // data sits in the register half selected by the backend's AccumBits.
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+        struct amdgcn_native_format<
+            accumulator,
+            BlockM,
+            BlockN,
+            BlockK,
+            DataT,
+            enable_if_t<is_wmma_compute_v<DataT> && (BlockM == 16) && (BlockN == 16)>>
+        {
+            using IOShape  = IOShape<accumulator, BlockM, BlockN, BlockK>;
+            using IOTraits = IOTraits<IOShape::BlockDim, IOShape::KDim, DataT>;
+            using PackUtil = PackUtil<DataT>;
+            using PackedT  = typename PackTraits<DataT>::PackedT;
+
+            enum : uint32_t
+            {
+                PadIdx = wmma_accum_bits<DataT, BlockM, BlockN>::value,
+            };
+
+            template <typename PackedRegsT>
+            using NativeRegsT = VecT<PackedT, IOTraits::UnpackedSize>;
+
+            ROCWMMA_DEVICE static inline auto
+                format(VecT<PackedT, IOTraits::PackedSize> const& regs)
+            {
+                return NativeRegsT<void>(PackUtil::template pad<PadIdx>(PackUtil::unpack(regs)));
+            }
+
+            ROCWMMA_DEVICE static inline auto unformat(NativeRegsT<void> const& regs)
+            {
+                return VecT<PackedT, IOTraits::PackedSize>(
+                    PackUtil::pack(PackUtil::template unpad<PadIdx>(regs)));
+            }
+        };
+
+#endif // ROCWMMA_ARCH_GFX11
+
+    } // namespace detail
+
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    using NativeFormat = detail::amdgcn_native_format<MatrixT, BlockM, BlockN, BlockK, DataT>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_NATIVE_FORMAT_HPP
@@ -0,0 +1,331 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_OPAQUE_ATOMIC_STORE_HPP
+#define ROCWMMA_OPAQUE_ATOMIC_STORE_HPP
+
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "opaque_store.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Element-wise add in the native type, or in f32 for the small float types
+        // that don't carry their own arithmetic.
+        template <typename DataT>
+        ROCWMMA_DEVICE static inline DataT accum_add(DataT const& lhs, DataT const& rhs)
+        {
+            if constexpr(is_integral_v<DataT> || is_same_v<DataT, float32_t>
+                         || is_same_v<DataT, float64_t>)
+            {
+                return static_cast<DataT>(lhs + rhs);
+            }
+            else
+            {
+                return static_cast<DataT>(static_cast<float32_t>(lhs)
+                                          + static_cast<float32_t>(rhs));
+            }
+        }
+
+        // Compare-and-swap fallback for types / archs without a native atomic add.
+        // Sub-dword types are updated through their containing aligned dword.
+        template <typename DataT>
+        struct amdgcn_atomic_add_cas
+        {
+            static_assert(sizeof(DataT) == 1u || sizeof(DataT) == 2u || sizeof(DataT) == 4u
+                              || sizeof(DataT) == 8u,
+                          "Unsupported atomic data size");
+
+            ROCWMMA_DEVICE static inline void exec(DataT* addr, DataT const& value)
+            {
+                if constexpr(sizeof(DataT) >= 4u)
+                {
+                    using WordT = conditional_t<sizeof(DataT) == 8u, unsigned long long, uint32_t>;
+
+                    auto* word = reinterpret_cast<WordT*>(addr);
+                    auto  old  = *word;
+                    WordT assumed;
+                    do
+                    {
+                        assumed  = old;
+                        auto sum = accum_add(*reinterpret_cast<DataT const*>(&assumed), value);
+                        old      = atomicCAS(word, assumed, *reinterpret_cast<WordT*>(&sum));
+                    } while(assumed != old);
+                }
+                else
+                {
+                    using BitsT = conditional_t<sizeof(DataT) == 1u, uint8_t, uint16_t>;
+
+                    auto  addrBits = reinterpret_cast<uint64_t>(addr);
+                    auto* word     = reinterpret_cast<uint32_t*>(addrBits & ~uint64_t(0x3u));
+                    auto  shift    = static_cast<uint32_t>(addrBits & 0x3u) * 8u;
+                    auto  mask     = static_cast<uint32_t>(BitsT(~BitsT(0u))) << shift;
+
+                    auto     old = *word;
+                    uint32_t assumed;
+                    do
+                    {
+                        assumed   = old;
+                        auto bits = static_cast<BitsT>((assumed & mask) >> shift);
+                        auto sum  = accum_add(*reinterpret_cast<DataT const*>(&bits), value);
+                        auto next = (assumed & ~mask)
+                                    | (static_cast<uint32_t>(*reinterpret_cast<BitsT*>(&sum))
+                                       << shift);
+                        old = atomicCAS(word, assumed, next);
+                    } while(assumed != old);
+                }
+            }
+        };
+
+        // Native single-element atomic add, when the hardware or HIP provides one.
+        template <typename DataT>
+        struct amdgcn_atomic_add
+        {
+            ROCWMMA_DEVICE static inline void exec(DataT* addr, DataT const& value)
+            {
+                if constexpr(is_same_v<DataT, float32_t> || is_same_v<DataT, float64_t>)
+                {
+#if ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+                    // global_atomic_add_f32 / global_atomic_add_f64
+                    unsafeAtomicAdd(addr, value);
+#else
+                    atomicAdd(addr, value);
+#endif // ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+                }
+                else if constexpr(is_same_v<DataT, int32_t> || is_same_v<DataT, uint32_t>)
+                {
+                    atomicAdd(addr, value);
+                }
+                else if constexpr(is_same_v<DataT, int64_t> || is_same_v<DataT, uint64_t>)
+                {
+                    // Two's complement add is sign agnostic
+                    atomicAdd(reinterpret_cast<unsigned long long*>(addr),
+                              static_cast<unsigned long long>(value));
+                }
+                else
+                {
+                    amdgcn_atomic_add_cas<DataT>::exec(addr, value);
+                }
+            }
+        };
+
+        // Packed 2 x 16b atomic add: global_atomic_pk_add_f16 (gfx90a+) and
+        // global_atomic_pk_add_bf16 (gfx940+).
+        template <typename DataT>
+        struct amdgcn_atomic_pk_add
+        {
+            enum : uint32_t
+            {
+#if ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+                PackedF16 = is_same_v<DataT, float16_t> || is_same_v<DataT, hfloat16_t>,
+#else
+                PackedF16 = false,
+#endif
+#if ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+                PackedBF16 = is_same_v<DataT, bfloat16_t>,
+#else
+                PackedBF16 = false,
+#endif
+                PackRatio = (PackedF16 || PackedBF16) ? 2u : 1u
+            };
+
+            // Requires a dword-aligned, global address
+            ROCWMMA_DEVICE static inline void exec(DataT* addr, DataT const* values)
+            {
+                if constexpr((bool)PackedF16)
+                {
+                    using PackedT = _Float16 __attribute__((ext_vector_type(2)));
+                    __builtin_amdgcn_global_atomic_fadd_v2f16(
+                        (__attribute__((address_space(1))) PackedT*)(addr),
+                        *reinterpret_cast<PackedT const*>(values));
+                }
+                else if constexpr((bool)PackedBF16)
+                {
+                    using PackedT = short __attribute__((ext_vector_type(2)));
+                    __builtin_amdgcn_global_atomic_fadd_v2bf16(
+                        (__attribute__((address_space(1))) PackedT*)(addr),
+                        *reinterpret_cast<PackedT const*>(values));
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < PackRatio; i++)
+                    {
+                        amdgcn_atomic_add<DataT>::exec(addr + i, values[i]);
+                    }
+                }
+            }
+        };
+
+        template <typename DataT, uint32_t VectorWidth>
+        struct amdgcn_opaque_atomic_add
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+            static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
+                          "Cannot vectorize output");
+
+            using StoreT = VecT<DataT, VectorWidth>;
+            using PkAdd  = amdgcn_atomic_pk_add<DataT>;
+
+            enum : uint32_t
+            {
+                PackRatio = (VectorWidth % (uint32_t)PkAdd::PackRatio == 0u)
+                                ? (uint32_t)PkAdd::PackRatio
+                                : 1u
+            };
+
+            ROCWMMA_DEVICE static inline void
+                exec(DataT* dataPtr, StoreT const& data, index_t offset = 0)
+            {
+                auto* addr   = &(dataPtr[offset]);
+                auto* values = reinterpret_cast<DataT const*>(&data);
+
+                if constexpr(PackRatio > 1u)
+                {
+                    // Packed atomics need dword alignment, which depends on ldm at run-time.
+                    if((reinterpret_cast<uint64_t>(addr) & 0x3u) == 0u)
+                    {
+#pragma unroll
+                        for(uint32_t i = 0; i < VectorWidth; i += PackRatio)
+                        {
+                            PkAdd::exec(addr + i, values + i);
+                        }
+                        return;
+                    }
+                }
+
+#pragma unroll
+                for(uint32_t i = 0; i < VectorWidth; i++)
+                {
+                    amdgcn_atomic_add<DataT>::exec(addr + i, values[i]);
+                }
+            }
+        };
+
+        // Non-atomic read-modify-write. Accumulation happens in program order,
+        // therefore results are reproducible when contributors are serialized.
+        template <typename DataT, uint32_t VectorWidth>
+        struct amdgcn_opaque_ordered_add
+        {
+            using Loader = amdgcn_opaque_load<DataT, VectorWidth>;
+            using Storer = amdgcn_opaque_store<DataT, VectorWidth>;
+            using StoreT = typename Storer::StoreT;
+
+            ROCWMMA_DEVICE static inline void
+                exec(DataT* dataPtr, StoreT const& data, index_t offset = 0)
+            {
+                typename Loader::LoadT accum;
+                Loader::exec(accum, dataPtr, offset);
+
+                auto*       dst = reinterpret_cast<DataT*>(&accum);
+                auto const* src = reinterpret_cast<DataT const*>(&data);
+#pragma unroll
+                for(uint32_t i = 0; i < VectorWidth; i++)
+                {
+                    dst[i] = accum_add(dst[i], src[i]);
+                }
+
+                Storer::exec(dataPtr, accum, offset);
+            }
+        };
+
+    } // namespace detail
+
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              class VectorAdder = detail::amdgcn_opaque_atomic_add<DataT, VectorWidth>>
+    struct OpaqueAtomicStore
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+        struct Traits
+        {
+            // Raw IO on unpacked register data.
+            using Storer = VectorAdder;
+            using StoreT = typename Storer::StoreT;
+            using InputT = VecT<DataT, IOTraits::UnpackedSize>;
+        };
+
+        using StoreVecTraits = VecTraits<typename Traits::StoreT>;
+
+        // Element offset of the given lane's vector for the given IO iteration.
+        // Each vector covers VectorWidth contiguous elements in memory.
+        // Host-callable so that lane to address mapping can be modeled outside of the device.
+        ROCWMMA_HOST_DEVICE static inline auto
+            dataOffset(uint32_t laneId, uint32_t iteration, uint32_t ldm)
+        {
+            return DataLayout::fromMatrixCoord(MatrixLayout::baseOffset(laneId)
+                                                   + MatrixLayout::cumulativeOffset(iteration),
+                                               ldm);
+        }
+
+        ROCWMMA_DEVICE static void
+            exec(DataT* dataPtr, typename Traits::InputT const& data, uint32_t ldm)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Make sure that the IOCount is consistent with the number of total strides
+            static_assert(IOTraits::IOCount
+                              == apply([](auto... items) { return (items * ...); },
+                                       MatrixLayout::strideCounts()),
+                          "IOCount inconsistent with total strides");
+
+            static_assert((bool)DataLayout::IsLinear,
+                          "Atomic and ordered stores do not support blocked data layouts");
+
+            auto basePtr = dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm);
+
+            // Unroll storing over the flattened stride space.
+            // Outer loop = index 0,
+            // Inner loop = index N-1
+            auto store = [&](uint32_t i) {
+                auto offset2d = to_matrix_space(
+                    MatrixLayout::strides(), inflate_coord_left(i, MatrixLayout::strideCounts()));
+
+                Traits::Storer::exec(basePtr + DataLayout::fromMatrixCoord(offset2d, ldm), *it);
+                it++;
+            };
+
+            unroll_flat<IOTraits::IOCount>(store);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_OPAQUE_ATOMIC_STORE_HPP
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_OPAQUE_BROADCAST_LOAD_HPP
+#define ROCWMMA_OPAQUE_BROADCAST_LOAD_HPP
+
+#include "broadcast.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    // Loads a 1D vector into a fragment, replicating it along the other matrix
+    // dimension. The fragment is filled exactly as a regular load of the
+    // broadcasted matrix, i.e. M(row, col) = data[VectorIndex == 0 ? row : col].
+    //
+    // VectorIndex selects which matrix coordinate indexes the 1D vector:
+    //   0 -> column vector (length BlockHeight), constant along rows
+    //   1 -> row vector (length BlockWidth), constant along columns
+    //
+    // When the fragment's vector width runs along the 1D vector, each IO is a
+    // single vector load of VectorWidth unique elements. Otherwise each IO is
+    // one scalar load replicated over VectorWidth. IOs that stride orthogonally
+    // to the vector read the same elements as an earlier IO: each unique load is
+    // issued once per lane and its registers are copied to the IOs that repeat it.
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              uint32_t VectorIndex>
+    struct OpaqueBroadcastLoad
+    {
+        static_assert(VectorIndex < 2u, "VectorIndex must select a matrix coordinate");
+
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+
+        struct Traits
+        {
+            // Vector width elements are contiguous along the data layout's minor index
+            enum : bool
+            {
+                IsContiguous = ((uint32_t)DataLayout::MinorIndex == VectorIndex)
+            };
+
+            // Raw IO on unpacked register data.
+            using Loader      = detail::amdgcn_opaque_load<DataT, VectorWidth>;
+            using Broadcaster = Broadcast<DataT, VectorWidth>;
+            using LoadT       = typename Loader::LoadT;
+            using OutputT     = VecT<DataT, IOTraits::UnpackedSize>;
+        };
+
+        using LoadVecTraits = VecTraits<typename Traits::LoadT>;
+
+        // Offset into the 1D vector of the first element of the given lane's
+        // vector for the given IO iteration.
+        // Host-callable so that the lane mapping can be modeled outside of the device.
+        ROCWMMA_HOST_DEVICE static inline uint32_t vectorOffset(uint32_t laneId, uint32_t iteration)
+        {
+            return get<VectorIndex>(MatrixLayout::baseOffset(laneId)
+                                    + MatrixLayout::cumulativeOffset(iteration));
+        }
+
+        // Offset into the 1D vector of the given IO iteration, relative to the lane's base offset.
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t iterationOffset(uint32_t iteration)
+        {
+            return get<VectorIndex>(
+                to_matrix_space(MatrixLayout::strides(),
+                                inflate_coord_left(iteration, MatrixLayout::strideCounts())));
+        }
+
+        // First IO iteration that reads the same 1D vector element as the given iteration.
+        // Host-callable so that the element reuse can be modeled outside of the device.
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t sourceIteration(uint32_t iteration)
+        {
+            for(uint32_t i = 0; i < iteration; i++)
+            {
+                if(iterationOffset(i) == iterationOffset(iteration))
+                {
+                    return i;
+                }
+            }
+            return iteration;
+        }
+
+        ROCWMMA_DEVICE static inline void exec(typename Traits::LoadT& data, DataT const* dataPtr)
+        {
+            if constexpr((bool)Traits::IsContiguous)
+            {
+                Traits::Loader::exec(data, dataPtr);
+            }
+            else
+            {
+                Traits::Broadcaster::exec(data, *dataPtr);
+            }
+        }
+
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT& data, DataT const* dataPtr)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto vecIt        = makeVectorIterator<LoadVecTraits::size()>(data);
+            auto it           = vecIt.begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Make sure that the IOCount is consistent with the number of total strides
+            static_assert(IOTraits::IOCount
+                              == apply([](auto... items) { return (items * ...); },
+                                       MatrixLayout::strideCounts()),
+                          "IOCount inconsistent with total strides");
+
+            // Unroll loading over the flattened stride space.
+            // Only the stride component along the vector moves the address.
+            // Outer loop = index 0,
+            // Inner loop = index N-1
+            // IOs that repeat an earlier IO's offset copy its registers instead of
+            // reloading. Iterations are unrolled, so the source resolves at compile time.
+            auto load = [&](uint32_t i) {
+                auto src = sourceIteration(i);
+                if(src == i)
+                {
+                    exec(*it, dataPtr + get<VectorIndex>(baseOffset2d) + iterationOffset(i));
+                }
+                else
+                {
+                    *it = *vecIt.it(src);
+                }
+                it++;
+            };
+
+            unroll_flat<IOTraits::IOCount>(load);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_OPAQUE_BROADCAST_LOAD_HPP
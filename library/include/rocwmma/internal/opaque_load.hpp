@@ -76,44 +76,6 @@ namespace rocwmma
 
         using LoadVecTraits = VecTraits<typename Traits::LoadT>;
 
-        // Outer loop = index 0,
-        // Inner loop = index N-1
-        template <size_t Depth = 0,
-                  typename Iterator,
-                  typename StrideCounts,
-                  typename Strides2d>
-        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&      out,
-                                                       DataT const*   dataPtr,
-                                                       uint32_t       ldm,
-                                                       StrideCounts&& strideCounts,
-                                                       Strides2d&&    strides2d)
-        {
-            auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm);
-            auto strideCount  = get<Depth>(strideCounts);
-
-            // Last depth layer will invoke the load
-            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
-            {
-#pragma unroll
-                for(int i = 0; i < strideCount; i++)
-                {
-                    Traits::Loader::exec(*out, dataPtr);
-                    dataPtr += strideOffset;
-                    out++;
-                }
-            }
-            // Recurse to the next nested layer
-            else
-            {
-#pragma unroll
-                for(int i = 0; i < strideCount; i++)
-                {
-                    unroll_right<Depth + 1>(out, dataPtr, ldm, strideCounts, strides2d);
-                    dataPtr += strideOffset;
-                }
-            }
-        }
-
         ROCWMMA_DEVICE static void
             exec(typename Traits::OutputT& data, DataT const* dataPtr, uint32_t ldm)
         {
@@ -130,12 +92,30 @@ namespace rocwmma
                                        MatrixLayout::strideCounts()),
                           "IOCount inconsistent with total strides");
 
-            // Unroll loading in each strided dimension
-            unroll_right(it,
-                         dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
-                         ldm,
-                         MatrixLayout::strideCounts(),
-                         MatrixLayout::strides());
+            // Linear data layouts offset the wave's base address by each stride offset.
+            // Non-linear data layouts (e.g. blocked) must map each full matrix coordinate.
+            auto basePtr = dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm);
+
+            // Unroll loading over the flattened stride space.
+            // Outer loop = index 0,
+            // Inner loop = index N-1
+            auto load = [&](uint32_t i) {
+                auto offset2d = to_matrix_space(
+                    MatrixLayout::strides(), inflate_coord_left(i, MatrixLayout::strideCounts()));
+
+                if constexpr((bool)DataLayout::IsLinear)
+                {
+                    Traits::Loader::exec(*it, basePtr + DataLayout::fromMatrixCoord(offset2d, ldm));
+                }
+                else
+                {
+                    Traits::Loader::exec(
+                        *it, dataPtr + DataLayout::fromMatrixCoord(baseOffset2d + offset2d, ldm));
+                }
+                it++;
+            };
+
+            unroll_flat<IOTraits::IOCount>(load);
         }
     };
 
@@ -28,6 +28,7 @@
 
 #include "io_traits.hpp"
 #include "layout.hpp"
+#include "tuple.hpp"
 #include "types.hpp"
 #include "vector_iterator.hpp"
 
@@ -73,42 +74,6 @@ namespace rocwmma
 
         using StoreVecTraits = VecTraits<typename Traits::StoreT>;
 
-        template <size_t Depth = 0,
-                  typename Iterator,
-                  typename StrideCounts,
-                  typename Strides2d>
-        ROCWMMA_DEVICE static inline auto unroll_right(DataT*         dataPtr,
-                                                       Iterator&      in,
-                                                       uint32_t       ldm,
-                                                       StrideCounts&& strideCounts,
-                                                       Strides2d&&    strides2d)
-        {
-            auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm);
-            auto strideCount  = get<Depth>(strideCounts);
-
-            // Last depth layer will invoke the load
-            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
-            {
-#pragma unroll
-                for(int i = 0; i < strideCount; i++)
-                {
-                    Traits::Storer::exec(dataPtr, *in);
-                    dataPtr += strideOffset;
-                    in++;
-                }
-            }
-            // Recurse to the next nested layer
-            else
-            {
-#pragma unroll
-                for(int i = 0; i < strideCount; i++)
-                {
-                    unroll_right<Depth + 1>(dataPtr, in, ldm, strideCounts, strides2d);
-                    dataPtr += strideOffset;
-                }
-            }
-        }
-
         ROCWMMA_DEVICE static void
             exec(DataT* dataPtr, typename Traits::InputT const& data, uint32_t ldm)
         {
@@ -125,11 +90,30 @@ namespace rocwmma
                                        MatrixLayout::strideCounts()),
                           "IOCount inconsistent with total strides");
 
-            unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
-                         it,
-                         ldm,
-                         MatrixLayout::strideCounts(),
-                         MatrixLayout::strides());
+            // Linear data layouts offset the wave's base address by each stride offset.
+            // Non-linear data layouts (e.g. blocked) must map each full matrix coordinate.
+            auto basePtr = dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm);
+
+            // Unroll storing over the flattened stride space.
+            // Outer loop = index 0,
+            // Inner loop = index N-1
+            auto store = [&](uint32_t i) {
+                auto offset2d = to_matrix_space(
+                    MatrixLayout::strides(), inflate_coord_left(i, MatrixLayout::strideCounts()));
+
+                if constexpr((bool)DataLayout::IsLinear)
+                {
+                    Traits::Storer::exec(basePtr + DataLayout::fromMatrixCoord(offset2d, ldm), *it);
+                }
+                else
+                {
+                    Traits::Storer::exec(
+                        dataPtr + DataLayout::fromMatrixCoord(baseOffset2d + offset2d, ldm), *it);
+                }
+                it++;
+            };
+
+            unroll_flat<IOTraits::IOCount>(store);
         }
     };
 
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_PACKED_IO_HPP
+#define ROCWMMA_PACKED_IO_HPP
+
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "mapping_util.hpp"
+#include "opaque_load.hpp"
+#include "opaque_store.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+    /*
+    * Pre-packed fragment data, for operands that never change (e.g. weights).
+    *
+    * A packed block holds the unpacked registers of a fragment, in the exact lane and
+    * element order that the fragment's IO layout produces. Loading it back needs neither
+    * layout address math nor LDS: each lane only reads its own contiguous data.
+    *
+    * Per-lane registers are split into chunks of up to 16 bytes, and chunks are
+    * interleaved across lanes so that each chunk load is one fully contiguous wave access:
+    *
+    *   packedOffset(lane, element) = ((element / ChunkSize) * WaveSize + lane) * ChunkSize
+    *                                 + element % ChunkSize
+    *
+    * Packed data is specific to the fragment type (matrix context, block sizes, data type
+    * and data layout) and to the wave size. The host model uses the host compile wave size,
+    * Constants::AMDGCN_WAVE_SIZE, so host packing only matches wave64 targets. Packed
+    * loads and stores are therefore limited to wave64 targets.
+    */
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth>
+    struct PackedIO
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                WaveSize     = IOTraits::ThreadsPerIO,
+                UnpackedSize = IOTraits::UnpackedSize,
+
+                // Largest power of 2 count of elements within 16 bytes that divides UnpackedSize
+                MaxChunkSize = max(16u / (uint32_t)sizeof(DataT), 1u),
+                ChunkSize    = min((uint32_t)MaxChunkSize, UnpackedSize & (~UnpackedSize + 1u)),
+                ChunkCount   = UnpackedSize / ChunkSize,
+
+                // Elements per packed block
+                BlockSize = WaveSize * UnpackedSize
+            };
+
+            using Loader  = detail::amdgcn_opaque_load<DataT, ChunkSize>;
+            using Storer  = detail::amdgcn_opaque_store<DataT, ChunkSize>;
+            using ChunkT  = VecT<DataT, ChunkSize>;
+            using OutputT = VecT<DataT, UnpackedSize>;
+            using InputT  = VecT<DataT, UnpackedSize>;
+        };
+
+        // Offset of the (laneId, elementIdx) register in the packed block
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t packedOffset(uint32_t laneId,
+                                                                          uint32_t elementIdx)
+        {
+            return ((elementIdx / (uint32_t)Traits::ChunkSize) * (uint32_t)Traits::WaveSize
+                    + laneId)
+                       * (uint32_t)Traits::ChunkSize
+                   + elementIdx % (uint32_t)Traits::ChunkSize;
+        }
+
+        // Offset of the (laneId, elementIdx) register in the unpacked block,
+        // from the same layout model as the fragment IO.
+        ROCWMMA_HOST_DEVICE static inline auto
+            dataOffset(uint32_t laneId, uint32_t elementIdx, uint32_t ldm)
+        {
+            return DataLayout::fromMatrixCoord(MatrixLayout::matrixCoord(laneId, elementIdx), ldm);
+        }
+
+        // Host-side packing of one block with leading dimension ldm
+        ROCWMMA_HOST static inline void pack(DataT* packedPtr, DataT const* dataPtr, uint32_t ldm)
+        {
+            for(uint32_t laneId = 0u; laneId < (uint32_t)Traits::WaveSize; laneId++)
+            {
+                for(uint32_t i = 0u; i < (uint32_t)Traits::UnpackedSize; i++)
+                {
+                    packedPtr[packedOffset(laneId, i)] = dataPtr[dataOffset(laneId, i, ldm)];
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void exec(typename Traits::OutputT& data,
+                                               DataT const*              packedPtr)
+        {
+            auto it = makeVectorIterator<(uint32_t)Traits::ChunkSize>(data).begin();
+            packedPtr += packedOffset(detail::laneId(), 0u);
+
+#pragma unroll
+            for(uint32_t i = 0u; i < (uint32_t)Traits::ChunkCount; i++)
+            {
+                Traits::Loader::exec(*it, packedPtr);
+                packedPtr += (uint32_t)Traits::WaveSize * (uint32_t)Traits::ChunkSize;
+                it++;
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void exec(DataT*                          packedPtr,
+                                               typename Traits::InputT const& data)
+        {
+            auto it = makeVectorIterator<(uint32_t)Traits::ChunkSize>(data).begin();
+            packedPtr += packedOffset(detail::laneId(), 0u);
+
+#pragma unroll
+            for(uint32_t i = 0u; i < (uint32_t)Traits::ChunkCount; i++)
+            {
+                Traits::Storer::exec(packedPtr, *it);
+                packedPtr += (uint32_t)Traits::WaveSize * (uint32_t)Traits::ChunkSize;
+                it++;
+            }
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_PACKED_IO_HPP
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REGISTER_MAP_HPP
+#define ROCWMMA_REGISTER_MAP_HPP
+
+#include "constants.hpp"
+#include "layout.hpp"
+#include "mapping_util.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Pulls a B32 multiple (or smaller) value from the given lane.
+        template <typename DataT>
+        ROCWMMA_DEVICE static inline DataT amdgcn_bpermute(DataT const& input, uint32_t laneId)
+        {
+            // NOTE: final address is laneId * 4
+            constexpr uint32_t DwordCount
+                = (sizeof(DataT) + sizeof(uint32_t) - 1u) / sizeof(uint32_t);
+
+            // Widen sub-dword types into B32
+            using B32VecT = VecT<uint32_t, DwordCount>;
+            auto b32      = B32VecT{};
+            reinterpret_cast<DataT&>(b32) = input;
+
+            auto op = [](auto&& idx, auto&& v, auto&& addr) {
+                constexpr auto i = decay_t<decltype(idx)>::value;
+                return (uint32_t)__builtin_amdgcn_ds_bpermute(addr, get<i>(v));
+            };
+
+            auto result = vector_generator<uint32_t, DwordCount>()(op, b32, laneId << 2);
+            return reinterpret_cast<DataT&>(result);
+        }
+
+        // Moves register elements from a source fragment layout into a destination fragment
+        // layout, such that each destination element receives the source element at the same
+        // matrix coordinate, offset by (RowOffset, ColOffset).
+        //
+        // Destination elements whose offset coordinate falls outside of the
+        // SrcHeight x SrcWidth source block keep their current value. Negative offsets are
+        // given in two's complement and wrap out of bounds.
+        //
+        // The source register of each destination element is resolved at compile time over
+        // all lanes of the wave:
+        // - Same lane, same register for every lane: plain register move (no instructions)
+        // - Otherwise: one ds_bpermute per distinct source register, selected per lane.
+        template <typename DstMatrixLayout,
+                  typename SrcMatrixLayout,
+                  uint32_t DstSize,
+                  uint32_t SrcHeight,
+                  uint32_t SrcWidth,
+                  uint32_t RowOffset,
+                  uint32_t ColOffset>
+        struct RegisterMap
+        {
+            enum : uint32_t
+            {
+                WaveSize = Constants::AMDGCN_WAVE_SIZE
+            };
+
+            // Compile-time summary of the source registers of one destination element
+            struct ElementSources
+            {
+                uint32_t count                = 0u;
+                uint32_t elementIdx[WaveSize] = {};
+                bool     isLocal              = true;
+                bool     isComplete           = true;
+            };
+
+            // Matrix coord in the source block for the destination (laneId, elementIdx)
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                srcMatrixCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return DstMatrixLayout::matrixCoord(laneId, elementIdx)
+                       + make_coord2d(RowOffset, ColOffset);
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline bool isInBounds(Coord2d const& coord)
+            {
+                return (get<0>(coord) < SrcHeight) && (get<1>(coord) < SrcWidth);
+            }
+
+            // Source (laneId, elementIdx) for the destination (laneId, elementIdx)
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                srcRegisterCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                return SrcMatrixLayout::registerCoord(srcMatrixCoord(laneId, elementIdx));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline ElementSources
+                elementSources(uint32_t elementIdx)
+            {
+                auto result = ElementSources{};
+                for(uint32_t laneId = 0u; laneId < WaveSize; laneId++)
+                {
+                    if(!isInBounds(srcMatrixCoord(laneId, elementIdx)))
+                    {
+                        result.isComplete = false;
+                        continue;
+                    }
+
+                    auto src = srcRegisterCoord(laneId, elementIdx);
+                    result.isLocal &= (get<0>(src) == laneId);
+
+                    bool isNew = true;
+                    for(uint32_t i = 0u; i < result.count; i++)
+                    {
+                        isNew &= (result.elementIdx[i] != get<1>(src));
+                    }
+
+                    if(isNew)
+                    {
+                        result.elementIdx[result.count++] = get<1>(src);
+                    }
+                }
+                return result;
+            }
+
+            // Moves one source candidate into the destination element
+            template <uint32_t ElementIdx, uint32_t Candidate, typename DataT, typename SrcT>
+            ROCWMMA_DEVICE static inline void
+                select(DataT& result, SrcT const& src, Coord2d const& srcReg, bool isValid)
+            {
+                constexpr auto Sources = elementSources(ElementIdx);
+                constexpr auto SrcIdx  = Sources.elementIdx[Candidate];
+
+                auto value = get<SrcIdx>(src);
+                if constexpr(!Sources.isLocal)
+                {
+                    value = amdgcn_bpermute(value, get<0>(srcReg));
+                }
+
+                if constexpr(Sources.isComplete && Sources.count == 1u)
+                {
+                    result = value;
+                }
+                else
+                {
+                    result = (isValid && get<1>(srcReg) == SrcIdx) ? value : result;
+                }
+            }
+
+            template <uint32_t ElementIdx, typename DstT, typename SrcT, size_t... Candidates>
+            ROCWMMA_DEVICE static inline auto gather(DstT const& dst,
+                                                     SrcT const& src,
+                                                     uint32_t    laneId,
+                                                     index_sequence<Candidates...>)
+            {
+                auto result = get<ElementIdx>(dst);
+
+                // Lane-dependent source register, folds to lane arithmetic for known ElementIdx
+                auto srcCoord = srcMatrixCoord(laneId, ElementIdx);
+                auto srcReg   = SrcMatrixLayout::registerCoord(srcCoord);
+                auto isValid  = isInBounds(srcCoord);
+
+                (select<ElementIdx, Candidates>(result, src, srcReg, isValid), ...);
+
+                return result;
+            }
+
+            template <uint32_t ElementIdx, typename DstT, typename SrcT>
+            ROCWMMA_DEVICE static inline auto
+                gather(DstT const& dst, SrcT const& src, uint32_t laneId)
+            {
+                constexpr auto Sources = elementSources(ElementIdx);
+                return gather<ElementIdx>(dst, src, laneId, make_index_sequence<Sources.count>{});
+            }
+
+            template <typename DataT, uint32_t SrcSize>
+            ROCWMMA_DEVICE static inline auto exec(VecT<DataT, DstSize> const& dst,
+                                                   VecT<DataT, SrcSize> const& src)
+            {
+                auto op = [](auto&& idx, auto&& dst, auto&& src, auto&& laneId) {
+                    constexpr auto i = decay_t<decltype(idx)>::value;
+                    return gather<i>(dst, src, laneId);
+                };
+
+                return vector_generator<DataT, DstSize>()(
+                    op, dst, src, detail::WaveSpace<>::localLaneId());
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_REGISTER_MAP_HPP
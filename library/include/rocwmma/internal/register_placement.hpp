@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REGISTER_PLACEMENT_HPP
+#define ROCWMMA_REGISTER_PLACEMENT_HPP
+
+#include "api_fwd.hpp"
+#include "config.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Empty inline asm that requires its operand to reside in the given
+        // register class ("v" = VGPR, "a" = AccVGPR / AGPR). The register allocator
+        // must materialize the value in that class at this point, which steers
+        // the allocation of the surrounding live range without emitting code.
+        // Values are pinned per dword, as register class constraints are defined
+        // for B32 registers and their tuples.
+        template <typename StorageT>
+        struct amdgcn_register_pin;
+
+        template <>
+        struct amdgcn_register_pin<vgpr_storage>
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE static inline void exec(DataT& data)
+            {
+#if !ROCWMMA_ARCH_HOST
+                static_assert(sizeof(DataT) % sizeof(uint32_t) == 0u,
+                              "Register data must be a multiple of B32");
+
+                constexpr uint32_t DwordCount = sizeof(DataT) / sizeof(uint32_t);
+                auto*              dwords     = reinterpret_cast<uint32_t*>(&data);
+#pragma unroll
+                for(uint32_t i = 0u; i < DwordCount; i++)
+                {
+                    asm("" : "+v"(dwords[i]));
+                }
+#endif // !ROCWMMA_ARCH_HOST
+            }
+        };
+
+        template <>
+        struct amdgcn_register_pin<agpr_storage>
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE static inline void exec(DataT& data)
+            {
+// AccVGPRs are only available on gfx9 MFMA targets.
+// On other targets, the unified VGPR file is the only option.
+#if ROCWMMA_ARCH_GFX9
+                static_assert(sizeof(DataT) % sizeof(uint32_t) == 0u,
+                              "Register data must be a multiple of B32");
+
+                constexpr uint32_t DwordCount = sizeof(DataT) / sizeof(uint32_t);
+                auto*              dwords     = reinterpret_cast<uint32_t*>(&data);
+#pragma unroll
+                for(uint32_t i = 0u; i < DwordCount; i++)
+                {
+                    asm("" : "+a"(dwords[i]));
+                }
+#else
+                amdgcn_register_pin<vgpr_storage>::exec(data);
+#endif // ROCWMMA_ARCH_GFX9
+            }
+        };
+
+    } // namespace detail
+
+    template <typename StorageT>
+    using RegisterPin = detail::amdgcn_register_pin<StorageT>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_REGISTER_PLACEMENT_HPP
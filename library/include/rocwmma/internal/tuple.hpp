@@ -298,6 +298,25 @@ namespace rocwmma
             make_index_sequence<VecTraits<decay_t<Vec0>>::size()>{});
     }
 
+    namespace detail
+    {
+        template <typename Func, size_t... Indices>
+        constexpr static inline void unroll_flat_impl(Func&& func, index_sequence<Indices...>)
+        {
+            (func(static_cast<uint32_t>(Indices)), ...);
+        }
+    }
+
+    // Invokes func(i) for i = [0, Count) in order, as a flat fold over the index space.
+    // Func takes a plain uint32_t so that it is instantiated once regardless of Count,
+    // instead of once per index or per nesting depth. Pair with inflate_coord_left to
+    // iterate a stride space, where index 0 is the outer loop and index N-1 the inner.
+    template <uint32_t Count, typename Func>
+    constexpr static inline void unroll_flat(Func&& func)
+    {
+        detail::unroll_flat_impl(forward<Func>(func), make_index_sequence<Count>{});
+    }
+
 #if !defined(__HIPCC_RTC__)
 
     template <class T, size_t... I>
@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_WMMA_HPP
 #define ROCWMMA_WMMA_HPP
 
+#include "native_format.hpp"
 #include "permute.hpp"
 #include "vector.hpp"
 #include "vector_iterator.hpp"
@@ -49,6 +50,13 @@ namespace rocwmma
         {
             return regsC;
         }
+
+        template <typename InputARegsT, typename InputBRegsT, typename InputCRegsT>
+        ROCWMMA_DEVICE static inline auto
+            execNative(InputARegsT const& regsA, InputBRegsT const& regsB, InputCRegsT const& regsC)
+        {
+            return regsC;
+        }
     };
 
 #if ROCWMMA_ARCH_GFX11
@@ -86,8 +94,12 @@ namespace rocwmma
             >::type>
     {
         // Functional backend
-        using WMMA     = detail::amdgcn_wmma<InputT, ComputeT, BlockM, BlockN>;
-        using PackUtil = PackUtil<ComputeT>;
+        using WMMA = detail::amdgcn_wmma<InputT, ComputeT, BlockM, BlockN>;
+
+        // Native register formats
+        using FormatA   = NativeFormat<matrix_a, BlockM, BlockN, BlockK, InputT>;
+        using FormatB   = NativeFormat<matrix_b, BlockM, BlockN, BlockK, InputT>;
+        using FormatAcc = NativeFormat<accumulator, BlockM, BlockN, BlockK, ComputeT>;
 
         // Full-fragment IO traits
         using IOTraitsA   = IOTraits<BlockM, BlockK, InputT>;
@@ -138,35 +150,41 @@ namespace rocwmma
             // and shift the 16b data to the correct spot (determined by the WMMA backend).
             // The nasty bit is that due of the extended 32b element size, the final accumulation vector
             // is masqueraded as a 'packed' type, but with the same vector size as unpacked.
-            auto accum = PackUtil::template pad<WMMA::Traits::AccumBits>(PackUtil::unpack(regsC));
+            // WMMA inputs are duplicated packed elements, which are formatted on the fly.
+            return FormatAcc::unformat(execNative(
+                FormatA::format(regsA), FormatB::format(regsB), FormatAcc::format(regsC)));
+        }
 
-            // Iterate over packed WMMA inputs
-            auto const aIt = makeVectorIterator<VecTraitsA::size() / 2u>(regsA).begin();
-            auto const bIt = makeVectorIterator<VecTraitsB::size() / 2u>(regsB).begin();
+        // Inputs already in WMMA native format: duplicated A / B and padded accumulator.
+        // Keeping fragments in this format across multiple calls avoids re-formatting.
+        template <typename InputARegsT, typename InputBRegsT, typename InputCRegsT>
+        ROCWMMA_DEVICE static inline auto
+            execNative(InputARegsT const& regsA, InputBRegsT const& regsB, InputCRegsT const& regsC)
+        {
+            static_assert(VecTraits<InputARegsT>::size() == VecTraitsA::size() * Traits::WmmaCount,
+                          "WMMA native input size mismatch");
+            static_assert(VecTraits<InputBRegsT>::size() == VecTraitsB::size() * Traits::WmmaCount,
+                          "WMMA native input size mismatch");
+            static_assert(VecTraits<InputCRegsT>::size() == VecTraitsC::size(),
+                          "WMMA native input size mismatch");
+
+            typename WMMA::Traits::DRegsT accum = regsC;
+
+            // Iterate over native WMMA inputs
+            auto const aIt = makeVectorIterator<VecTraitsA::size()>(regsA).begin();
+            auto const bIt = makeVectorIterator<VecTraitsB::size()>(regsB).begin();
 
             // Accumulate over WMMA count
 #pragma unroll
             for(uint32_t i = 0; i < Traits::WmmaCount; i++)
             {
-                // Create WMMA input registers
-                typename WMMA::Traits::ARegsT regsA_Wmma;
-                typename WMMA::Traits::BRegsT regsB_Wmma;
-
-                auto swappedA = Swizzle::Swap16::exec(*aIt);
-                auto swappedB = Swizzle::Swap16::exec(*bIt);
-
-                // Combine registers for mult/accum.
-                // Evens: non-swapped
-                // Odds: swapped
-                accum = WMMA::exec(concat(unpackLo(*aIt, swappedA), unpackHi(*aIt, swappedA)),
-                                   concat(unpackLo(*bIt, swappedB), unpackHi(*bIt, swappedB)),
-                                   accum);
+                accum = WMMA::exec(*aIt, *bIt, accum);
 
                 aIt++;
                 bIt++;
             }
 
-            return PackUtil::pack(PackUtil::template unpad<WMMA::Traits::AccumBits>(accum));
+            return accum;
         }
     };
 
@@ -28,6 +28,7 @@
 
 #include "internal/accessors.hpp"
 #include "internal/io_traits.hpp"
+#include "internal/native_format.hpp"
 #include "internal/pack_util.hpp"
 #include "internal/types.hpp"
 
@@ -81,6 +82,33 @@ namespace rocwmma
     {
     };
 
+    //! @struct blocked_layout
+    //! @brief Meta-tag indicating 2D in-memory data layout as contiguous TileRows x TileCols tiles.
+    //! Elements within a tile are stored in InnerLayoutT order, and tiles are stored in OuterLayoutT order.
+    //! The leading dimension is that of the whole matrix in OuterLayoutT, and must be a multiple of the tile size.
+    //! @tparam TileRows/TileCols Tile dimensions
+    //! @tparam InnerLayoutT Layout of elements within a tile as row_major or col_major
+    //! @tparam OuterLayoutT Layout of tiles within the matrix as row_major or col_major
+    template <uint32_t TileRows,
+              uint32_t TileCols,
+              typename InnerLayoutT = row_major,
+              typename OuterLayoutT = row_major>
+    struct blocked_layout
+    {
+    };
+
+    //! @struct row_vector
+    //! @brief Meta-tag indicating 1D in-memory data as a row vector, broadcast to every row of a fragment.
+    struct row_vector
+    {
+    };
+
+    //! @struct col_vector
+    //! @brief Meta-tag indicating 1D in-memory data as a column vector, broadcast to every column of a fragment.
+    struct col_vector
+    {
+    };
+
     //! @struct matrix_a
     //! @brief Meta-tag indicating data context is input Matrix A.
     struct matrix_a
@@ -99,6 +127,19 @@ namespace rocwmma
     {
     };
 
+    //! @struct vgpr_storage
+    //! @brief Meta-tag indicating fragment register storage in the vector register file (VGPRs).
+    struct vgpr_storage
+    {
+    };
+
+    //! @struct agpr_storage
+    //! @brief Meta-tag indicating fragment register storage in the accumulation register file (AGPRs).
+    //! Falls back to VGPRs on targets without AccVGPRs.
+    struct agpr_storage
+    {
+    };
+
     //! @struct layout_t
     //! @brief Runtime data layout tags
     //! @var mem_row_major
@@ -201,6 +242,83 @@ namespace rocwmma
         using element_type                     = DataT;
     };
 
+    //! @class native_fragment
+    //! @brief Fragment data held in the register format natively consumed by the mma backend. On gfx11, WMMA inputs A / B
+    //! are duplicated across lane halves and accumulators are unpacked and padded to 32b elements. mma_sync on regular fragments
+    //! performs this formatting on every call; converting once with to_native and keeping the native fragments across
+    //! repeated mma_sync calls (e.g. accumulators over the K loop, or inputs re-used for several blocks) removes that overhead.
+    //! On other targets, the native format is the packed fragment storage and conversions are free.
+    //!
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //!
+    //! @note Native fragments have no element access. Accumulators are converted back with from_native.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT = void>
+    class __align__(4) native_fragment
+    {
+    public:
+        //! Fragment type in regular packed format
+        using FragT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        //! Conversions to and from the native format
+        using Format = NativeFormat<MatrixT, BlockM, BlockN, BlockK, DataT>;
+
+        struct Traits
+        {
+            //! Native data storage
+            using StorageT =
+                typename Format::template NativeRegsT<typename FragT::Traits::StorageT>;
+        };
+
+        //! @returns Mutable native storage vector accessor
+        ROCWMMA_DEVICE inline typename Traits::StorageT& operator*();
+        //! @returns Immutable native storage vector accessor
+        ROCWMMA_DEVICE inline typename Traits::StorageT const& operator*() const;
+
+        typename Traits::StorageT mStorage;
+    };
+
+    //! @struct fragment_coord_map
+    //! @brief Matrix coordinates (row, col) of the register elements of a fragment held by one lane. Coordinates are in the
+    //! geometric space of the fragment (height() x width(), e.g. BlockM x BlockK for matrix_a), and depend on the target
+    //! architecture, matrix context and data layout. Each coordinate is the lane's base coordinate plus an element offset
+    //! that only depends on the element index: for element indices known at compile time, offsets are constants and each
+    //! coordinate costs a single integer add.
+    //!
+    //! @tparam FragT Fragment type, with a static data layout unless it is an accumulator
+    //!
+    //! @note Accumulators without a data layout use the accumulator register mapping, which is independent of data layout.
+    template <typename FragT>
+    struct fragment_coord_map
+    {
+        //! @param laneId Lane index within the wave
+        ROCWMMA_HOST_DEVICE constexpr explicit fragment_coord_map(uint32_t laneId);
+
+        //! @param index Element index
+        //! @returns Matrix coordinate (row, col) of the element at given index
+        ROCWMMA_HOST_DEVICE constexpr inline Coord2d operator[](uint32_t index) const;
+        //! @param index Element index
+        //! @returns Matrix row of the element at given index
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t row(uint32_t index) const;
+        //! @param index Element index
+        //! @returns Matrix column of the element at given index
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t col(uint32_t index) const;
+
+        //! @param index Element index
+        //! @returns Lane-invariant offset of the element at given index from the base coordinate
+        ROCWMMA_HOST_DEVICE constexpr static inline Coord2d offset(uint32_t index);
+
+        //! Matrix coordinate of the lane's first element, from which offset(0) is (0, 0)
+        Coord2d base;
+    };
+
     //! Fills the entire fragment with the desired value.
     //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
     //! @param value Fill value of type DataT
@@ -252,6 +370,70 @@ namespace rocwmma
                                          uint32_t                                          ldm,
                                          layout_t                                          layout);
 
+    //! Loads a row vector into the entire fragment, such that every fragment row holds a copy of the vector (frag(i, j) = data[j]).
+    //! Elements are loaded at most once per IO: contiguous runs are vector loaded, otherwise a single element is replicated.
+    //! Typical use is bias-add or per-channel scaling of accumulators. With matrix_a / matrix_b fragments this is a stride-0 load.
+    //! Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to a vector of BlockWidth elements (BlockN for accumulator and matrix_b, BlockK for matrix_a)
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         row_vector);
+
+    //! Loads a column vector into the entire fragment, such that every fragment column holds a copy of the vector (frag(i, j) = data[i]).
+    //! Elements are loaded at most once per IO: contiguous runs are vector loaded, otherwise a single element is replicated.
+    //! Typical use is bias-add or per-channel scaling of accumulators. With matrix_a / matrix_b fragments this is a stride-0 load.
+    //! Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to a vector of BlockHeight elements (BlockM for accumulator and matrix_a, BlockK for matrix_b)
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         col_vector);
+
+    //! Loads a row vector into the entire accumulator fragment without a data layout (frag(i, j) = data[j]).
+    //! Accumulator register layouts do not depend on the data layout, so this matches the output of mma_sync.
+    //! @param frag Accumulator fragment with its associated block sizes and data type
+    //! @param data Data pointer to a vector of BlockN elements
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<accumulator, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                          data,
+                                         row_vector);
+
+    //! Loads a column vector into the entire accumulator fragment without a data layout (frag(i, j) = data[i]).
+    //! Accumulator register layouts do not depend on the data layout, so this matches the output of mma_sync.
+    //! @param frag Accumulator fragment with its associated block sizes and data type
+    //! @param data Data pointer to a vector of BlockM elements
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<accumulator, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                          data,
+                                         col_vector);
+
     //! Stores the entire fragment to the data pointer according to its matrix and data layouts. Data pointer may point to either local or global memory.
     //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
     //! @param data Data pointer to global/local memory
@@ -287,6 +469,156 @@ namespace rocwmma
                           uint32_t                                                ldm,
                           layout_t                                                layout);
 
+    //! Atomically accumulates the entire fragment into the data pointer (data += frag) according to its matrix and data layouts.
+    //! Data pointer must point to global memory. Uses packed f16 / bf16 and native f32 / f64 atomics where the target supports them,
+    //! otherwise falls back to compare-and-swap loops.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global memory
+    //! @param ldm Leading dimension size
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @note Accumulation order between concurrent contributors is not defined. Use store_matrix_ordered_add for reproducible results.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm);
+
+    //! Atomically accumulates the entire fragment into the data pointer (data += frag) according to its matrix layout.
+    //! This overload provides a run-time ability to choose the data layout of the target fragment.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global memory
+    //! @param ldm Leading dimension size
+    //! @param layout Data layout
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_atomic_add(DataT*                                                  data,
+                                fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                                uint32_t                                                ldm,
+                                layout_t                                                layout);
+
+    //! Accumulates the entire fragment into the data pointer (data += frag) with a non-atomic read-modify-write, according to its matrix and data layouts.
+    //! Results are deterministic as long as contributors to the same data are serialized by the caller. Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_ordered_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm);
+
+    //! Accumulates the entire fragment into the data pointer (data += frag) in a fixed order across contributors.
+    //! The wave waits until the semaphore equals its order ticket, performs a read-modify-write and then releases the semaphore to order + 1.
+    //! Accumulation order is therefore 0, 1, 2 ... and results are bitwise reproducible.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param semaphore Counter shared by all contributors to data, initialized to the first order ticket
+    //! @param order Order ticket of the calling wave
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @note All contributors with lower tickets must be able to make progress (e.g. co-resident) to avoid deadlock.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_ordered_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t*                                                            semaphore,
+        uint32_t                                                             order);
+
+    //! Loads the entire fragment from pre-packed data (see pack_matrix). Packed data holds the fragment registers in lane order,
+    //! so each lane issues fully contiguous loads of up to 16 bytes with no layout address math and no LDS. Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to the packed block in global/local memory
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout of the unpacked data as col_major or row_major
+    //! @note Packed data is only valid for the exact fragment type it was packed for, and is only supported on wave64 targets.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_packed_sync(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag, const DataT* data);
+
+    //! Stores the entire fragment to the data pointer in the pre-packed format read by load_matrix_packed_sync.
+    //! This is the device-side packer. Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to the packed block in global/local memory
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout of the unpacked data as col_major or row_major
+    //! @note Packed data is only supported on wave64 targets.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_packed_sync(
+        DataT* data, fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
+    //! Host-side packer. Reorders one block of FragT's dimensions into the pre-packed format read by load_matrix_packed_sync,
+    //! using the same layout model as the fragment IO. Packed output holds height() x width() elements.
+    //! @param packed Host pointer to the packed output block
+    //! @param data Host pointer to the unpacked input block
+    //! @param ldm Leading dimension size of the unpacked input
+    //! @tparam FragT Fragment type the data is packed for, with a static data layout
+    //! @note The host model assumes a wave size of 64. Packed data is only supported on wave64 targets.
+    template <typename FragT>
+    ROCWMMA_HOST void
+        pack_matrix(GetDataType_t<FragT>* packed, GetDataType_t<FragT> const* data, uint32_t ldm);
+
+    //! Host-side data layout conversion. Copies an m x n matrix from SrcLayoutT to DstLayoutT order, e.g. from row_major
+    //! into blocked_layout tiles for fragments declared with a blocked_layout.
+    //! @param dst Host pointer to the output matrix
+    //! @param src Host pointer to the input matrix
+    //! @param m Matrix rows
+    //! @param n Matrix columns
+    //! @param ldDst Leading dimension size of the output matrix
+    //! @param ldSrc Leading dimension size of the input matrix
+    //! @tparam DstLayoutT Output layout as col_major, row_major or blocked_layout
+    //! @tparam SrcLayoutT Input layout as col_major, row_major or blocked_layout
+    //! @tparam DataT Datatype
+    template <typename DstLayoutT, typename SrcLayoutT, typename DataT>
+    ROCWMMA_HOST void convert_matrix_layout(DataT*       dst,
+                                            DataT const* src,
+                                            uint32_t     m,
+                                            uint32_t     n,
+                                            uint32_t     ldDst,
+                                            uint32_t     ldSrc);
+
     //! Performs the Multiply-Accumulate operation on the fragments A, B, C and D (D = A * B + C)
     //! @param d Accumulator output D
     //! @param a Input fragment A
@@ -312,6 +644,166 @@ namespace rocwmma
                  fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
                  fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
 
+    //! Converts a fragment into the native register format of the mma backend.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @returns Native fragment holding the same data
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>
+        to_native(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
+    //! Converts a native accumulator back into a regular fragment, e.g. for fused operations or storing.
+    //! @param frag Native accumulator fragment
+    //! @returns Accumulator fragment holding the same data
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> from_native(
+        native_fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
+    //! Performs the Multiply-Accumulate operation on native fragments A, B, C and D (D = A * B + C).
+    //! No formatting of inputs or accumulators is done in between mma calls.
+    //! @param d Native accumulator output D
+    //! @param a Native input fragment A
+    //! @param b Native input fragment B
+    //! @param c Native input accumulator fragment C
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam InputT Datatype of input frags A and B
+    //! @tparam ComputeT Datatype of accumulator fragment C / D
+    //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(native_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 native_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                 native_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 native_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
+
+    //! Steers the registers of a fragment into the given register file at this point of the program.
+    //! On gfx908 / gfx90a, this can keep accumulators in AGPRs and mma inputs in VGPRs. Whether that reduces
+    //! v_accvgpr_read / write traffic depends on the kernel and must be checked in its assembly.
+    //! The hint itself emits no instructions, it only constrains register allocation.
+    //! @param frag Fragment whose registers are placed
+    //! @tparam StorageT Register file as vgpr_storage or agpr_storage
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename StorageT,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        place_registers(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag);
+
+    //! Steers the registers of a native fragment into the given register file at this point of the program.
+    //! @param frag Native fragment whose registers are placed
+    //! @tparam StorageT Register file as vgpr_storage or agpr_storage
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename StorageT,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        place_registers(native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag);
+
+    //! Matrix coordinates (row, col) of the fragment elements held by the current lane, such that frag[i] is the matrix element
+    //! at coordinate fragment_coords(frag)[i]. Masking, positional biases or custom epilogues may be written against these
+    //! coordinates, independent of the target architecture and layout.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @returns Coordinate map of the current lane
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE fragment_coord_map<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>>
+        fragment_coords(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
+    //! Host-evaluable matrix coordinates (row, col) of the fragment elements held by the given lane.
+    //! @param laneId Lane index within the wave
+    //! @returns Coordinate map of the given lane
+    //! @tparam FragT Fragment type
+    //! @note The host model assumes a wave size of 64, as does pack_matrix.
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr fragment_coord_map<FragT> fragment_coords(uint32_t laneId);
+
+    //! Calls f(row, col, value) for each fragment element held by the current lane, where value is a mutable reference to the
+    //! element at matrix coordinate (row, col). Elements are visited in register order and the loop is fully unrolled, such that
+    //! coordinates resolve to the lane's base coordinate plus constant offsets.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param f Element function, callable as f(uint32_t row, uint32_t col, DataT& value)
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam FuncT element function type
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename FuncT>
+    ROCWMMA_DEVICE void
+        for_each_element(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         FuncT&&                                                        f);
+
+    //! Calls f(row, col, value) for each fragment element held by the current lane, where value is an immutable reference to
+    //! the element at matrix coordinate (row, col).
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param f Element function, callable as f(uint32_t row, uint32_t col, DataT const& value)
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam FuncT element function type
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename FuncT>
+    ROCWMMA_DEVICE void
+        for_each_element(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                         FuncT&&                                                              f);
+
     //! Synchronization point for all wavefronts in a workgroup. Guarantees pending reads / writes to LDS are flushed.
     ROCWMMA_DEVICE void synchronize_workgroup();
 
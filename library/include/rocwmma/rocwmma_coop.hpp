@@ -193,6 +193,37 @@ namespace rocwmma
                               uint32_t waveIndex);
     // @endcond
 
+    //! Loads a single chunk of the current wave's share of a cooperative fragment load.
+    //! The wave's share is split into SplitCount chunks. Chunk SplitIndex fills only its own registers of the fragment,
+    //! so chunks may be issued and waited on separately, and interleaved with mma or LDS work.
+    //! Loading chunks [0, SplitCount) is equivalent to load_matrix_coop_sync<WaveCount>.
+    //!
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @tparam uint32_t WaveCount
+    //! @tparam uint32_t SplitCount Number of chunks of the current wave's share. Must evenly divide the wave's IO count
+    //! @tparam uint32_t SplitIndex Chunk to load, in the range of [0, SplitCount)
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <uint32_t WaveCount,
+              uint32_t SplitCount,
+              uint32_t SplitIndex,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex);
+
     //! Loads the fragment from memory address cooperatively across wavefronts.
     //! Each cooperating wavefront is responsible in loading a portion of the final fragment.
     //! This function may be paired with store_matrix_coop_sync to move a single fragment collaboratively between memory locations.
@@ -374,6 +405,37 @@ namespace rocwmma
             uint32_t                                                             waveIndex);
     // @endcond
 
+    //! Stores a single chunk of the current wave's share of a cooperative fragment store.
+    //! The wave's share is split into SplitCount chunks. Chunk SplitIndex reads only its own registers of the fragment,
+    //! so chunks may be issued separately, e.g. interleaved with mma work while writing LDS.
+    //! Storing chunks [0, SplitCount) is equivalent to store_matrix_coop_sync<WaveCount>.
+    //!
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @tparam WaveCount Number of waves participating
+    //! @tparam SplitCount Number of chunks of the current wave's share. Must evenly divide the wave's IO count
+    //! @tparam SplitIndex Chunk to store, in the range of [0, SplitCount)
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <uint32_t WaveCount,
+              uint32_t SplitCount,
+              uint32_t SplitIndex,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex);
+
     //! Cooperative Store Matrix - Stores the entire fragment to data address cooperatively across waves.
     //! Each cooperative wave is responsible in storing a portion of the final fragment.
     //! @note The full fragment data is not required to be cohesive for individual waves as they
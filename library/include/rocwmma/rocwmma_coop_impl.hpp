@@ -127,6 +127,40 @@ namespace rocwmma
     }
     // @endcond
 
+    template <uint32_t WaveCount,
+              uint32_t SplitCount,
+              uint32_t SplitIndex,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Loader = typename GetCoopIOConfig_t<FragT, WaveCount>::Loader;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and coop load output types do not match");
+
+        // Load a single chunk of the wave's share into its own registers.
+        // Note: the frag will only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Loader::template exec<WaveCount, SplitCount, SplitIndex>(
+            frag.mAccess, data, ldm, waveIndex);
+    }
+
     template <uint32_t WaveCount,
               typename MatrixT,
               uint32_t BlockM,
@@ -252,6 +286,40 @@ namespace rocwmma
     }
     // @endcond
 
+    template <uint32_t WaveCount,
+              uint32_t SplitCount,
+              uint32_t SplitIndex,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Storer = typename GetCoopIOConfig_t<FragT, WaveCount>::Storer;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and coop store input types do not match");
+
+        // Store a single chunk of the wave's share from its own registers.
+        // Note: the frag is only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Storer::template exec<WaveCount, SplitCount, SplitIndex>(
+            data, frag.mAccess, ldm, waveIndex);
+    }
+
     template <uint32_t WaveCount,
               typename MatrixT,
               uint32_t BlockM,
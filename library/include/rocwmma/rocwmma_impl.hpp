@@ -42,10 +42,13 @@
 #include "internal/layout.hpp"
 #include "internal/mapping_util.hpp"
 #include "internal/mfma.hpp"
+#include "internal/opaque_atomic_store.hpp"
+#include "internal/opaque_broadcast_load.hpp"
 #include "internal/opaque_load.hpp"
 #include "internal/opaque_store.hpp"
 #include "internal/pack_util.hpp"
 #include "internal/permute.hpp"
+#include "internal/register_placement.hpp"
 #include "internal/swizzle.hpp"
 #include "internal/transforms.hpp"
 #include "internal/types.hpp"
@@ -195,6 +198,32 @@ namespace rocwmma
         return num_elements;
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE inline auto
+        native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>::operator*() ->
+        typename Traits::StorageT&
+    {
+        return mStorage;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE inline auto
+        native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>::operator*() const ->
+        typename Traits::StorageT const&
+    {
+        return mStorage;
+    }
+
     template <typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -263,6 +292,93 @@ namespace rocwmma
         }
     }
 
+    namespace detail
+    {
+        template <typename VectorT>
+        struct VectorIndex;
+
+        // Row vectors are indexed by column, column vectors by row
+        template <>
+        struct VectorIndex<row_vector> : public integral_constant<uint32_t, 1u>
+        {
+        };
+
+        template <>
+        struct VectorIndex<col_vector> : public integral_constant<uint32_t, 0u>
+        {
+        };
+
+        template <typename VectorT, typename FragT, typename DataT>
+        ROCWMMA_DEVICE static inline void load_broadcast(FragT& frag, const DataT* data)
+        {
+            using Loader = typename GetIOConfig_t<FragT>::template BroadcastLoader<
+                VectorIndex<VectorT>::value>;
+
+            static_assert(
+                is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+                "Fragment access and load output types do not match");
+
+            Loader::exec(frag.mAccess, data);
+        }
+
+    } // namespace detail
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         row_vector)
+    {
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Statically assign data layout in "
+                      "fragment declaration.");
+
+        detail::load_broadcast<row_vector>(frag, data);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         col_vector)
+    {
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Statically assign data layout in "
+                      "fragment declaration.");
+
+        detail::load_broadcast<col_vector>(frag, data);
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<accumulator, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                          data,
+                                         row_vector)
+    {
+        // Accumulator register mapping is independent of data layout
+        using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+        detail::load_broadcast<row_vector>(reinterpret_cast<FragRowMajor&>(frag), data);
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<accumulator, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                          data,
+                                         col_vector)
+    {
+        // Accumulator register mapping is independent of data layout
+        using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+        detail::load_broadcast<col_vector>(reinterpret_cast<FragRowMajor&>(frag), data);
+    }
+
     template <typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -311,6 +427,199 @@ namespace rocwmma
         }
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Storer = typename GetIOConfig_t<FragT>::AtomicStorer;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Implicit unpack and then atomic add
+        Storer::exec(data, frag.mAccess, ldm);
+    }
+
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_atomic_add(DataT*                                                  data,
+                                fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                                uint32_t                                                ldm,
+                                layout_t                                                layout)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_atomic_add(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+        }
+        else
+        {
+            store_matrix_atomic_add(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+        }
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_ordered_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Storer = typename GetIOConfig_t<FragT>::OrderedStorer;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Statically assign data layout in "
+                      "fragment declaration.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Implicit unpack and then read-modify-write
+        Storer::exec(data, frag.mAccess, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_ordered_add(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t*                                                            semaphore,
+        uint32_t                                                             order)
+    {
+        // Wait for our turn. Acquire makes previous contributions visible to our reads.
+        while(__hip_atomic_load(semaphore, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_AGENT) != order)
+        {
+            __builtin_amdgcn_s_sleep(1);
+        }
+
+        store_matrix_ordered_add(data, frag, ldm);
+
+        // Every lane releases its own stores before lane 0 publishes the ticket,
+        // so the next ticket holder observes the whole wave's contribution.
+        __builtin_amdgcn_fence(__ATOMIC_RELEASE, "agent");
+        if(__lane_id() == 0u)
+        {
+            __hip_atomic_store(semaphore, order + 1u, __ATOMIC_RELEASE, __HIP_MEMORY_SCOPE_AGENT);
+        }
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_packed_sync(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag, const DataT* data)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Packer = typename GetIOConfig_t<FragT>::Packer;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Packed data is specific to the data layout.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Packer::Traits::OutputT>::value,
+            "Fragment access and packed load output types do not match");
+
+        static_assert((uint32_t)Packer::Traits::WaveSize == 64u,
+                      "Packed data is only supported on wave64 targets");
+
+        // Packed data is already in register order
+        Packer::exec(frag.mAccess, data);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_packed_sync(
+        DataT* data, fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Packer = typename GetIOConfig_t<FragT>::Packer;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Packed data is specific to the data layout.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Packer::Traits::InputT>::value,
+            "Fragment access and packed store input types do not match");
+
+        static_assert((uint32_t)Packer::Traits::WaveSize == 64u,
+                      "Packed data is only supported on wave64 targets");
+
+        Packer::exec(data, frag.mAccess);
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST void
+        pack_matrix(GetDataType_t<FragT>* packed, GetDataType_t<FragT> const* data, uint32_t ldm)
+    {
+        using Packer = typename GetIOConfig_t<FragT>::Packer;
+
+        // Sanity check
+        static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                      "Must provide data layout. Packed data is specific to the data layout.");
+
+        Packer::pack(packed, data, ldm);
+    }
+
+    template <typename DstLayoutT, typename SrcLayoutT, typename DataT>
+    ROCWMMA_HOST void convert_matrix_layout(DataT*       dst,
+                                            DataT const* src,
+                                            uint32_t     m,
+                                            uint32_t     n,
+                                            uint32_t     ldDst,
+                                            uint32_t     ldSrc)
+    {
+        using DstLayout = DataLayout::template Array1d<DstLayoutT>;
+        using SrcLayout = DataLayout::template Array1d<SrcLayoutT>;
+
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t col = 0u; col < n; col++)
+            {
+                auto coord = make_coord2d(row, col);
+                dst[DstLayout::fromMatrixCoord(coord, ldDst)]
+                    = src[SrcLayout::fromMatrixCoord(coord, ldSrc)];
+            }
+        }
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -363,6 +672,234 @@ namespace rocwmma
         (*d) = MMA::exec(*a, *b, *c);
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>
+        to_native(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using NativeFragT = native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        NativeFragT result;
+        (*result) = NativeFragT::Format::format(*frag);
+        return result;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> from_native(
+        native_fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using NativeFragT = decay_t<decltype(frag)>;
+
+        typename NativeFragT::FragT result;
+        (*result) = NativeFragT::Format::unformat(*frag);
+        return result;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(native_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 native_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                 native_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 native_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
+    {
+        using IOConfigA = GetIOConfig_t<typename decay_t<decltype(a)>::FragT>;
+        using IOConfigB = GetIOConfig_t<typename decay_t<decltype(b)>::FragT>;
+
+        // Native fragments must satisfy the same mma requirements as regular fragments
+        static_assert(IOConfigA::IOShape::KDim == IOConfigB::IOShape::KDim,
+                      "KDim of input fragments must match");
+
+        static_assert(is_orthogonal_v<typename IOConfigA::IOLayout::MatrixLayout,
+                                      typename IOConfigB::IOLayout::MatrixLayout>,
+                      "Input fragment matrix layouts are not orthogonal");
+
+        static_assert(is_same_v<typename IOConfigA::IOLayout::RegisterLayout,
+                                RegisterLayout::template Soa<IOConfigA::IOShape::BlockDim,
+                                                             IOConfigA::IOLayout::MaxVW>>,
+                      "Input fragment register layouts are not mfma friendly");
+
+        // Gfx9 MFMA consumes packed vectors, which are its native format.
+        // Gfx11 WMMA skips formatting of the native inputs.
+        if constexpr((bool)ROCWMMA_ARCH_GFX9)
+        {
+            (*d) = Mfma<InputT, ComputeT, BlockM, BlockN, BlockK>::exec(*a, *b, *c);
+        }
+        else
+        {
+            (*d) = Wmma<InputT, ComputeT, BlockM, BlockN, BlockK>::execNative(*a, *b, *c);
+        }
+    }
+
+    template <typename StorageT,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        place_registers(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag)
+    {
+        static_assert(is_same_v<StorageT, vgpr_storage> || is_same_v<StorageT, agpr_storage>,
+                      "Register storage must be vgpr_storage or agpr_storage");
+
+        // Placement applies to the packed register storage
+        RegisterPin<StorageT>::exec(*frag);
+    }
+
+    template <typename StorageT,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        place_registers(native_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag)
+    {
+        static_assert(is_same_v<StorageT, vgpr_storage> || is_same_v<StorageT, agpr_storage>,
+                      "Register storage must be vgpr_storage or agpr_storage");
+
+        // Placement applies to the native register storage
+        RegisterPin<StorageT>::exec(*frag);
+    }
+
+    namespace detail
+    {
+        template <typename FragT>
+        struct FragmentMatrixLayout
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide data layout. Register mapping is specific to the data "
+                          "layout.");
+
+            using Type = typename GetIOConfig_t<FragT>::IOLayout::MatrixLayout;
+        };
+
+        // Accumulator register mapping is independent of data layout
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+        struct FragmentMatrixLayout<fragment<accumulator, BlockM, BlockN, BlockK, DataT, void>>
+            : public FragmentMatrixLayout<
+                  fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>>
+        {
+        };
+
+        template <typename FragT>
+        using FragmentMatrixLayout_t = typename FragmentMatrixLayout<FragT>::Type;
+
+    } // namespace detail
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr fragment_coord_map<FragT>::fragment_coord_map(uint32_t laneId)
+        : base(detail::FragmentMatrixLayout_t<FragT>::baseOffset(laneId))
+    {
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr inline Coord2d
+        fragment_coord_map<FragT>::operator[](uint32_t index) const
+    {
+        return base + offset(index);
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr inline uint32_t
+        fragment_coord_map<FragT>::row(uint32_t index) const
+    {
+        return get<0>(base) + get<0>(offset(index));
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr inline uint32_t
+        fragment_coord_map<FragT>::col(uint32_t index) const
+    {
+        return get<1>(base) + get<1>(offset(index));
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr inline Coord2d
+        fragment_coord_map<FragT>::offset(uint32_t index)
+    {
+        return detail::FragmentMatrixLayout_t<FragT>::elementOffset(index);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE fragment_coord_map<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>>
+        fragment_coords(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using FragT = decay_t<decltype(frag)>;
+
+        // Lane id is wrapped to the wave size by the matrix layout
+        return fragment_coord_map<FragT>(threadIdx.x);
+    }
+
+    template <typename FragT>
+    ROCWMMA_HOST_DEVICE constexpr fragment_coord_map<FragT> fragment_coords(uint32_t laneId)
+    {
+        return fragment_coord_map<FragT>(laneId);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename FuncT>
+    ROCWMMA_DEVICE void
+        for_each_element(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         FuncT&&                                                        f)
+    {
+        auto coords = fragment_coords(frag);
+
+#pragma unroll
+        for(uint32_t i = 0u; i < frag.num_elements; i++)
+        {
+            f(coords.row(i), coords.col(i), frag[i]);
+        }
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename FuncT>
+    ROCWMMA_DEVICE void
+        for_each_element(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                         FuncT&&                                                              f)
+    {
+        auto coords = fragment_coords(frag);
+
+#pragma unroll
+        for(uint32_t i = 0u; i < frag.num_elements; i++)
+        {
+            f(coords.row(i), coords.col(i), frag[i]);
+        }
+    }
+
     ROCWMMA_DEVICE void synchronize_workgroup()
     {
         __syncthreads();
@@ -27,6 +27,7 @@
 #define ROCWMMA_TRANSFORMS_API_HPP
 
 #include "rocwmma.hpp"
+#include "rocwmma_coop.hpp"
 #include "rocwmma_transforms_impl.hpp"
 
 namespace rocwmma
@@ -65,6 +66,137 @@ namespace rocwmma
     template <typename DataLayoutT, uint32_t WaveCount = 1, typename FragT>
     ROCWMMA_DEVICE static inline decltype(auto) applyDataLayout(FragT&& frag);
 
+    //! Extracts a sub-block of the fragment into a smaller fragment of the same matrix context, data type and data layout.
+    //! The input fragment is viewed as a grid of SubFragT sized tiles (BlockHeight x BlockWidth), of which tile (TileRow, TileCol) is returned.
+    //! Register movement is resolved at compile time from the known register layouts: tiles already held by the same lanes
+    //! are register renames without instructions, others are gathered with cross-lane permutes.
+    //! E.g. slice<fragment<accumulator, 16, 16, 16, float, row_major>, 1, 0>(fragment<accumulator, 32, 32, 16, float, row_major>)
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @tparam SubFragT The desired sub-fragment type
+    //! @tparam TileRow Tile row index, in units of SubFragT height
+    //! @tparam TileCol Tile column index, in units of SubFragT width
+    //! @tparam FragT The incoming fragment type
+    //! @returns Sub-fragment of type SubFragT
+    template <typename SubFragT, uint32_t TileRow, uint32_t TileCol, typename FragT>
+    ROCWMMA_DEVICE static inline SubFragT slice(FragT const& frag);
+
+    //! Inserts a smaller fragment into a sub-block of the fragment. The inverse of slice().
+    //! The fragment is viewed as a grid of SubFragT sized tiles (BlockHeight x BlockWidth), of which tile (TileRow, TileCol) is overwritten.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param subFrag Sub-fragment of the same matrix context, data type and layout
+    //! @tparam TileRow Tile row index, in units of SubFragT height
+    //! @tparam TileCol Tile column index, in units of SubFragT width
+    //! @tparam FragT The target fragment type
+    //! @tparam SubFragT The incoming sub-fragment type
+    template <uint32_t TileRow, uint32_t TileCol, typename FragT, typename SubFragT>
+    ROCWMMA_DEVICE static inline void insert(FragT& frag, SubFragT const& subFrag);
+
+    //! @class lazy_fragment
+    //! @brief Fragment with pending layout transforms. applyTranspose and applyDataLayout on a lazy fragment only change its type,
+    //! while the registers keep the layout of the source fragment. Because every transform is a fixed register permutation between
+    //! known layouts, the pending chain composes at compile time into a single permutation from the source layout to the final layout.
+    //! It is materialized once, as at most one aos<->soa pass (or none), when the fragment is consumed by materialize, store_matrix_sync,
+    //! store_matrix_coop_sync or mma_sync.
+    //! E.g. applyDataLayout<row_major>(applyTranspose(applyDataLayout<col_major>(deferTransforms(frag)))) issues one aos<->soa pass instead of two.
+    //!
+    //! @tparam FragT Fragment type after the pending transforms
+    //! @tparam SourceFragT Fragment type of the held registers
+    //! @tparam WaveCount The number of cooperative waves for cooperative fragments (defaults to 1, or non-cooperative)
+    template <typename FragT, typename SourceFragT = FragT, uint32_t WaveCount = 1>
+    struct lazy_fragment
+    {
+        //! Fragment type after the pending transforms
+        using Type = FragT;
+        //! Fragment type of the held registers
+        using SourceType = SourceFragT;
+
+        SourceFragT mSource;
+    };
+
+    //! Starts a lazy chain of layout transforms on the input fragment.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @tparam WaveCount The number of cooperative waves for cooperative fragments (defaults to 1, or non-cooperative)
+    //! @tparam FragT The incoming fragment type
+    //! @returns Lazy fragment without pending transforms
+    template <uint32_t WaveCount = 1, typename FragT>
+    ROCWMMA_DEVICE static inline lazy_fragment<FragT, FragT, WaveCount>
+        deferTransforms(FragT const& frag);
+
+    //! Regular fragments have no pending transforms, and are returned as they are.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @tparam FragT The incoming fragment type
+    //! @returns The input fragment
+    template <typename FragT>
+    ROCWMMA_DEVICE static inline decltype(auto) materialize(FragT const& frag);
+
+    //! Applies the pending transforms of a lazy fragment as a single fused permutation.
+    //! @param frag Lazy fragment
+    //! @tparam FragT Fragment type after the pending transforms
+    //! @tparam SourceFragT Fragment type of the held registers
+    //! @tparam WaveCount The number of cooperative waves for cooperative fragments
+    //! @returns Fragment of type FragT
+    template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline decltype(auto)
+        materialize(lazy_fragment<FragT, SourceFragT, WaveCount> const& frag);
+
+    //! Stores a lazy fragment after materializing its pending transforms.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Lazy fragment
+    //! @param ldm Leading dimension size
+    template <typename DataT, typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_sync(DataT*                                               data,
+                          lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                          uint32_t                                             ldm);
+
+    //! Stores a lazy fragment cooperatively after materializing its pending transforms.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Lazy fragment
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param waveCount Number of waves assigned for collaboration
+    template <typename DataT, typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_coop_sync(DataT*                                               data,
+                               lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                               uint32_t                                             ldm,
+                               uint32_t                                             waveIndex,
+                               uint32_t                                             waveCount);
+
+    //! Stores a lazy fragment cooperatively after materializing its pending transforms.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Lazy fragment
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @tparam CoopWaveCount Number of waves participating
+    template <uint32_t CoopWaveCount,
+              typename DataT,
+              typename FragT,
+              typename SourceFragT,
+              uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_coop_sync(DataT*                                               data,
+                               lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                               uint32_t                                             ldm,
+                               uint32_t                                             waveIndex);
+
+    //! Performs the Multiply-Accumulate operation on fragments A, B, C and D (D = A * B + C), where any of
+    //! A, B or C may be lazy fragments. Pending transforms are materialized before the mma.
+    //! @param d Accumulator output D
+    //! @param a Input fragment A, or lazy fragment of matrix_a type
+    //! @param b Input fragment B, or lazy fragment of matrix_b type
+    //! @param c Input accumulator fragment C, or lazy fragment of accumulator type
+    template <typename FragD,
+              typename FragA,
+              typename FragB,
+              typename FragC,
+              enable_if_t<detail::is_lazy_fragment_v<FragA> || detail::is_lazy_fragment_v<FragB>
+                              || detail::is_lazy_fragment_v<FragC>,
+                          int>
+              = 0>
+    ROCWMMA_DEVICE static inline void
+        mma_sync(FragD& d, FragA const& a, FragB const& b, FragC const& c);
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_TRANSFORMS_API_HPP
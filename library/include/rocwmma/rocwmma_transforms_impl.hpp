@@ -26,11 +26,15 @@
 #ifndef ROCWMMA_TRANSFORMS_API_IMPL_HPP
 #define ROCWMMA_TRANSFORMS_API_IMPL_HPP
 
+#include "internal/register_map.hpp"
 #include "internal/transforms.hpp"
 #include "rocwmma_transforms.hpp"
 
 namespace rocwmma
 {
+    template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+    struct lazy_fragment;
+
     namespace detail
     {
         ///
@@ -287,6 +291,250 @@ namespace rocwmma
             using Type = fragment<matrix_b, 1, registerFileWidth, FragT::size(), DataT, DataLayout>;
         };
 
+        // Below are defined sub-block transforms:
+        // - A fragment is viewed as a grid of smaller fragment tiles of the same
+        //   matrix context, data type and data layout.
+        // - Elements are matched by matrix coordinate through the register layout
+        //   model of each fragment, so any pair of supported block sizes works.
+        // - Accumulators without data layout share the register layout of row_major.
+        // Example:
+        // - A 32x32 accumulator tile (1, 0) is the 16x16 accumulator of rows [16, 32)
+        //   and cols [0, 16).
+        template <typename FragT, typename SubFragT, uint32_t TileRow, uint32_t TileCol>
+        struct ApplySubBlock;
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  uint32_t SubBlockM,
+                  uint32_t SubBlockN,
+                  uint32_t SubBlockK,
+                  typename DataT,
+                  typename DataLayoutT,
+                  uint32_t TileRow,
+                  uint32_t TileCol>
+        struct ApplySubBlock<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>,
+                             fragment<MatrixT, SubBlockM, SubBlockN, SubBlockK, DataT, DataLayoutT>,
+                             TileRow,
+                             TileCol>
+        {
+        private:
+            static_assert(!is_same_v<DataLayoutT, void> || is_same_v<MatrixT, accumulator>,
+                          "Must provide data layout information for matrix_a and matrix_b");
+
+            // Accumulator register layouts do not depend on data layout
+            using LayoutT = conditional_t<is_same_v<DataLayoutT, void>, row_major, DataLayoutT>;
+
+            using IOConfig
+                = GetIOConfig_t<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, LayoutT>>;
+            using SubIOConfig
+                = GetIOConfig_t<fragment<MatrixT, SubBlockM, SubBlockN, SubBlockK, DataT, LayoutT>>;
+
+            using IOShape    = typename IOConfig::IOShape;
+            using SubIOShape = typename SubIOConfig::IOShape;
+
+            static_assert(IOShape::BlockHeight % SubIOShape::BlockHeight == 0u
+                              && IOShape::BlockWidth % SubIOShape::BlockWidth == 0u,
+                          "Sub-fragment must tile the fragment");
+            static_assert(TileRow < IOShape::BlockHeight / SubIOShape::BlockHeight
+                              && TileCol < IOShape::BlockWidth / SubIOShape::BlockWidth,
+                          "Tile index out of range");
+
+            enum : uint32_t
+            {
+                RowOrigin = TileRow * SubIOShape::BlockHeight,
+                ColOrigin = TileCol * SubIOShape::BlockWidth,
+            };
+
+        public:
+            // Sub-fragment elements read the fragment at (row + RowOrigin, col + ColOrigin)
+            using SliceMap = RegisterMap<typename SubIOConfig::IOLayout::MatrixLayout,
+                                         typename IOConfig::IOLayout::MatrixLayout,
+                                         SubIOConfig::IOTraits::UnpackedSize,
+                                         IOShape::BlockHeight,
+                                         IOShape::BlockWidth,
+                                         RowOrigin,
+                                         ColOrigin>;
+
+            // Fragment elements read the sub-fragment at (row - RowOrigin, col - ColOrigin)
+            using InsertMap = RegisterMap<typename IOConfig::IOLayout::MatrixLayout,
+                                          typename SubIOConfig::IOLayout::MatrixLayout,
+                                          IOConfig::IOTraits::UnpackedSize,
+                                          SubIOShape::BlockHeight,
+                                          SubIOShape::BlockWidth,
+                                          0u - (uint32_t)RowOrigin,
+                                          0u - (uint32_t)ColOrigin>;
+
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using SubFragT = fragment<MatrixT, SubBlockM, SubBlockN, SubBlockK, DataT, DataLayoutT>;
+
+            ROCWMMA_DEVICE static inline SubFragT slice(FragT const& frag)
+            {
+                auto result    = SubFragT{};
+                result.mAccess = SliceMap::exec(result.mAccess, frag.mAccess);
+                return result;
+            }
+
+            ROCWMMA_DEVICE static inline void insert(FragT& frag, SubFragT const& subFrag)
+            {
+                frag.mAccess = InsertMap::exec(frag.mAccess, subFrag.mAccess);
+            }
+        };
+
+        // Below are defined lazy (deferred) layout transforms:
+        // - Transposes and data layout changes on a lazy fragment only change its type.
+        //   The registers keep the layout of the source fragment.
+        // - Every transform is a fixed register permutation between known layouts:
+        //   transposes are re-casts, and data layout changes move each element to the
+        //   register holding the same matrix coordinate in the new layout.
+        // - A chain of such permutations composes into a single permutation between the
+        //   source and final layouts, with coordinates swapped for an odd number of
+        //   transposes (matrix_a <-> matrix_b).
+        // - With the same register layout at both ends, the composition is a re-cast.
+        //   Otherwise it is one aos<->soa pass.
+        // Example:
+        // - applyDataLayout<row_major>(applyTranspose(applyDataLayout<col_major>(fragA)))
+        //   issues two aos<->soa passes, while the lazy chain issues none.
+        template <typename FragT>
+        struct is_lazy_fragment : public false_type
+        {
+        };
+
+        template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+        struct is_lazy_fragment<lazy_fragment<FragT, SourceFragT, WaveCount>> : public true_type
+        {
+        };
+
+        template <typename FragT>
+        constexpr static bool is_lazy_fragment_v = is_lazy_fragment<decay_t<FragT>>::value;
+
+        template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+        struct ApplyTranspose<lazy_fragment<FragT, SourceFragT, WaveCount>>
+        {
+            // Interface
+            using Type
+                = lazy_fragment<typename ApplyTranspose<FragT>::Type, SourceFragT, WaveCount>;
+
+            // Pending transpose only: the source registers are unchanged.
+            ROCWMMA_DEVICE static inline Type const&
+                exec(lazy_fragment<FragT, SourceFragT, WaveCount> const& frag)
+            {
+                return reinterpret_cast<Type const&>(frag);
+            }
+        };
+
+        template <typename FragT, typename SourceFragT, uint32_t WaveCount, typename NewDataLayoutT>
+        struct ApplyDataLayout<lazy_fragment<FragT, SourceFragT, WaveCount>, NewDataLayoutT>
+        {
+            // Interface
+            using Type = lazy_fragment<typename ApplyDataLayout<FragT, NewDataLayoutT>::Type,
+                                       SourceFragT,
+                                       WaveCount>;
+
+            // Pending data layout change only: the source registers are unchanged.
+            template <uint32_t WaveCountIn = 1>
+            ROCWMMA_DEVICE constexpr static inline Type const&
+                exec(lazy_fragment<FragT, SourceFragT, WaveCount> const& frag)
+            {
+                static_assert(WaveCountIn == 1u || WaveCountIn == WaveCount,
+                              "WaveCount does not match the lazy fragment WaveCount");
+                return reinterpret_cast<Type const&>(frag);
+            }
+        };
+
+        template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+        struct ApplyLazy;
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayoutT,
+                  typename SrcMatrixT,
+                  uint32_t SrcBlockM,
+                  uint32_t SrcBlockN,
+                  uint32_t SrcBlockK,
+                  typename SrcDataLayoutT,
+                  uint32_t WaveCount>
+        struct ApplyLazy<
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>,
+            fragment<SrcMatrixT, SrcBlockM, SrcBlockN, SrcBlockK, DataT, SrcDataLayoutT>,
+            WaveCount>
+        {
+        private:
+            using FragOut = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using FragIn
+                = fragment<SrcMatrixT, SrcBlockM, SrcBlockN, SrcBlockK, DataT, SrcDataLayoutT>;
+
+            using IOConfigIn  = GetCoopIOConfig_t<FragIn, WaveCount>;
+            using IOConfigOut = GetCoopIOConfig_t<FragOut, WaveCount>;
+
+            using RegisterLayoutIn  = typename IOConfigIn::IOLayout::RegisterLayout;
+            using RegisterLayoutOut = typename IOConfigOut::IOLayout::RegisterLayout;
+
+            static_assert(IOConfigIn::IOShape::BlockDim == IOConfigOut::IOShape::BlockDim
+                              && IOConfigIn::IOShape::KDim == IOConfigOut::IOShape::KDim,
+                          "Lazy transforms must keep BlockDim and KDim");
+
+        public:
+            using MatrixLayoutIn  = typename IOConfigIn::IOLayout::MatrixLayout;
+            using MatrixLayoutOut = typename IOConfigOut::IOLayout::MatrixLayout;
+
+            enum : bool
+            {
+                // Odd number of transposes: matrix coordinates are swapped
+                IsTransposed = !is_same_v<MatrixT, SrcMatrixT>,
+
+                // Same register layout at both ends: the composition is a re-cast
+                IsIdentity = is_same_v<RegisterLayoutIn, RegisterLayoutOut>
+            };
+
+            // (laneId, elementIdx) of the source register that the materialized
+            // (laneId, elementIdx) receives, over the whole pending chain.
+            // Host-callable so that the fused permutation can be modeled outside of the device.
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                srcRegisterCoord(uint32_t laneId, uint32_t elementIdx)
+            {
+                auto coord = MatrixLayoutOut::matrixCoord(laneId, elementIdx);
+                return MatrixLayoutIn::registerCoord(IsTransposed ? swap(coord) : coord);
+            }
+
+            ROCWMMA_DEVICE static inline decltype(auto) exec(FragIn const& frag)
+            {
+                if constexpr((bool)IsIdentity)
+                {
+                    return reinterpret_cast<FragOut const&>(frag);
+                }
+                else
+                {
+                    constexpr uint32_t BlockDim = IOConfigIn::IOShape::BlockDim;
+                    constexpr uint32_t MaxVW    = IOConfigIn::IOLayout::MaxVW;
+
+                    using AosLayout = RegisterLayout::template Aos<BlockDim, MaxVW>;
+                    using SoaLayout = RegisterLayout::template Soa<BlockDim, MaxVW>;
+
+                    static_assert((is_same_v<RegisterLayoutIn, AosLayout>
+                                   && is_same_v<RegisterLayoutOut, SoaLayout>)
+                                      || (is_same_v<RegisterLayoutIn, SoaLayout>
+                                          && is_same_v<RegisterLayoutOut, AosLayout>),
+                                  "Lazy transforms support aos<->soa register layouts only");
+
+                    auto result = FragOut{};
+                    if constexpr(is_same_v<RegisterLayoutIn, AosLayout>)
+                    {
+                        result.mAccess = Transforms::AosToSoa<BlockDim, MaxVW>::exec(frag.mAccess);
+                    }
+                    else
+                    {
+                        result.mAccess = Transforms::SoaToAos<BlockDim, MaxVW>::exec(frag.mAccess);
+                    }
+                    return result;
+                }
+            }
+        };
+
     } // namespace detail
 
     /// These wrappers must perfect-forward and perfect-return because the return types and
@@ -304,6 +552,85 @@ namespace rocwmma
         return detail::template ApplyDataLayout<decay_t<FragT>, DataLayoutT>::template exec<
             WaveCount>(forward<FragT>(frag));
     }
+
+    template <typename SubFragT, uint32_t TileRow, uint32_t TileCol, typename FragT>
+    ROCWMMA_DEVICE static inline SubFragT slice(FragT const& frag)
+    {
+        return detail::template ApplySubBlock<FragT, SubFragT, TileRow, TileCol>::slice(frag);
+    }
+
+    template <uint32_t TileRow, uint32_t TileCol, typename FragT, typename SubFragT>
+    ROCWMMA_DEVICE static inline void insert(FragT& frag, SubFragT const& subFrag)
+    {
+        detail::template ApplySubBlock<FragT, SubFragT, TileRow, TileCol>::insert(frag, subFrag);
+    }
+
+    template <uint32_t WaveCount /*=1*/, typename FragT>
+    ROCWMMA_DEVICE static inline lazy_fragment<FragT, FragT, WaveCount>
+        deferTransforms(FragT const& frag)
+    {
+        return lazy_fragment<FragT, FragT, WaveCount>{frag};
+    }
+
+    template <typename FragT>
+    ROCWMMA_DEVICE static inline decltype(auto) materialize(FragT const& frag)
+    {
+        return frag;
+    }
+
+    template <typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline decltype(auto)
+        materialize(lazy_fragment<FragT, SourceFragT, WaveCount> const& frag)
+    {
+        return detail::template ApplyLazy<FragT, SourceFragT, WaveCount>::exec(frag.mSource);
+    }
+
+    template <typename DataT, typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_sync(DataT*                                               data,
+                          lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                          uint32_t                                             ldm)
+    {
+        store_matrix_sync(data, materialize(frag), ldm);
+    }
+
+    template <typename DataT, typename FragT, typename SourceFragT, uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_coop_sync(DataT*                                               data,
+                               lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                               uint32_t                                             ldm,
+                               uint32_t                                             waveIndex,
+                               uint32_t                                             waveCount)
+    {
+        store_matrix_coop_sync(data, materialize(frag), ldm, waveIndex, waveCount);
+    }
+
+    template <uint32_t CoopWaveCount,
+              typename DataT,
+              typename FragT,
+              typename SourceFragT,
+              uint32_t WaveCount>
+    ROCWMMA_DEVICE static inline void
+        store_matrix_coop_sync(DataT*                                               data,
+                               lazy_fragment<FragT, SourceFragT, WaveCount> const& frag,
+                               uint32_t                                             ldm,
+                               uint32_t                                             waveIndex)
+    {
+        store_matrix_coop_sync<CoopWaveCount>(data, materialize(frag), ldm, waveIndex);
+    }
+
+    template <typename FragD,
+              typename FragA,
+              typename FragB,
+              typename FragC,
+              enable_if_t<detail::is_lazy_fragment_v<FragA> || detail::is_lazy_fragment_v<FragB>
+                              || detail::is_lazy_fragment_v<FragC>,
+                          int> /*= 0*/>
+    ROCWMMA_DEVICE static inline void
+        mma_sync(FragD& d, FragA const& a, FragB const& b, FragC const& c)
+    {
+        mma_sync(d, materialize(a), materialize(b), materialize(c));
+    }
     // @endcond
 
 } // namespace rocwmma
@@ -0,0 +1,89 @@
+#!/usr/bin/env bash
+# Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+
+# Reports accvgpr traffic and register usage of the gemm kernels, from the
+# assembly produced by building with -DROCWMMA_BUILD_ASSEMBLY=ON.
+#
+# Report one build:
+#   ./AccVgprReport.sh ../../build > report.csv
+#
+# Compare register placement before / after, per kernel and in total, on
+# builds for the same target (gfx908, gfx90a) configured with
+# -DROCWMMA_GEMM_PLACE_REGISTERS=OFF and =ON:
+#   ./AccVgprReport.sh ../../build-off ../../build-on > compare.csv
+#
+# ROCWMMA_GEMM_PLACE_REGISTERS should only default to ON once the ON build
+# issues fewer accvgpr instructions in total, with no kernel gaining scratch.
+
+set -eu
+
+# ensure this script is in the cwd
+cd "$(dirname "${BASH_SOURCE[0]}")"
+
+report() {
+  local asm_dir=$1/test/gemm/
+
+  if [ ! -d "$asm_dir" ]; then
+    echo "No gemm build found in $asm_dir" >&2
+    exit 1
+  fi
+
+  echo "File,Kernel,AccVgprRead,AccVgprWrite,AccVgprMov,NumVgprs,NumAgprs,ScratchSize"
+
+  find "$asm_dir" -path "*/assembly/*" -name "*.s" | sort | while read -r f; do
+    awk -v file="$(basename "$f")" '
+      /^[[:space:]]*\.type[[:space:]]+.*,@function/ {
+        kernel = $2; sub(/,.*/, "", kernel)
+        order[++count] = kernel
+      }
+      /v_accvgpr_read/  { read[kernel]++ }
+      /v_accvgpr_write/ { write[kernel]++ }
+      /v_accvgpr_mov/   { mov[kernel]++ }
+      /^; NumVgprs:/    { vgprs[kernel] = $3 }
+      /^; NumAgprs:/    { agprs[kernel] = $3 }
+      /^; ScratchSize:/ { scratch[kernel] = $3 }
+      END {
+        for(i = 1; i <= count; i++) {
+          k = order[i]
+          # Only report kernels that use accvgprs
+          if(read[k] + write[k] + mov[k] + agprs[k] == 0) continue
+          printf "%s,%s,%d,%d,%d,%d,%d,%d\n", file, k, read[k], write[k], mov[k], \
+                 vgprs[k], agprs[k], scratch[k]
+        }
+      }' "$f"
+  done
+}
+
+if [ $# -lt 2 ]; then
+  report "${1:-../../build}"
+  exit 0
+fi
+
+before=$(mktemp)
+after=$(mktemp)
+trap 'rm -f "$before" "$after"' EXIT
+
+report "$1" > "$before"
+report "$2" > "$after"
+
+# Match kernels by (File, Kernel). Kernels missing from one build count as zero.
+awk -F, '
+  FNR == 1 { next }
+  {
+    key = $1 "," $2
+    if(!(key in seen)) { seen[key] = 1; order[++count] = key }
+  }
+  NR == FNR { ops0[key] = $3 + $4 + $5; agprs0[key] = $7; scratch0[key] = $8; next }
+            { ops1[key] = $3 + $4 + $5; agprs1[key] = $7; scratch1[key] = $8 }
+  END {
+    print "File,Kernel,AccVgprOpsBefore,AccVgprOpsAfter,AccVgprOpsDelta,NumAgprsBefore,NumAgprsAfter,ScratchBefore,ScratchAfter"
+    for(i = 1; i <= count; i++) {
+      k = order[i]
+      printf "%s,%d,%d,%d,%d,%d,%d,%d\n", k, ops0[k], ops1[k], ops1[k] - ops0[k], \
+             agprs0[k], agprs1[k], scratch0[k], scratch1[k]
+      total0 += ops0[k]; total1 += ops1[k]
+      if(scratch1[k] > scratch0[k]) grew++
+    }
+    printf "Total,%d kernels,%d,%d,%d,,,%d gained scratch,\n", count, total0, total1, \
+           total1 - total0, grew
+  }' "$before" "$after"
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+# Measures the compiler front-end time per kernel instance of the fragment IO
+# paths in test/compile_time/io_unroll_instance.cpp. Instances are compiled with
+# -fsyntax-only, so only parsing and template instantiation are timed.
+#
+# Compare the current headers against the headers of a baseline git ref:
+#   ./BenchmarkCompileTime.sh HEAD~1 > compile_time.csv
+#
+# Environment:
+#   HIPCC   - compiler (default /opt/rocm/bin/hipcc)
+#   ARCH    - offload arch (default gfx90a)
+#   REPEATS - timed runs per instance, the best is reported (default 3)
+
+set -eu
+
+script_dir=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+repo_dir=$(cd "$script_dir/../.." && pwd)
+source_file=$repo_dir/test/compile_time/io_unroll_instance.cpp
+
+hipcc=${HIPCC:-/opt/rocm/bin/hipcc}
+arch=${ARCH:-gfx90a}
+repeats=${REPEATS:-3}
+baseline=${1:-}
+
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+if [ -n "$baseline" ]; then
+  git -C "$repo_dir" archive "$baseline" library/include | tar -x -C "$work_dir"
+fi
+
+# BlockM BlockN BlockK
+blocks=("16 16 16" "16 16 32" "32 32 8" "32 32 16" "64 64 16" "128 128 16")
+types=("rocwmma::float16_t" "rocwmma::bfloat16_t" "rocwmma::float32_t")
+layouts=("rocwmma::row_major" "rocwmma::col_major")
+
+# Best wall time in ms, compiling the instance against the given include dir
+time_instance() {
+  local include_dir=$1
+  shift
+  local best=""
+  for ((r = 0; r < repeats; r++)); do
+    local start end ms
+    start=$(date +%s%N)
+    "$hipcc" -std=c++17 --offload-arch="$arch" -fsyntax-only -I"$include_dir" "$@" "$source_file"
+    end=$(date +%s%N)
+    ms=$(((end - start) / 1000000))
+    if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then
+      best=$ms
+    fi
+  done
+  echo "$best"
+}
+
+if [ -n "$baseline" ]; then
+  echo "BlockM,BlockN,BlockK,DataT,Layout,BaselineMs,CurrentMs,Speedup"
+else
+  echo "BlockM,BlockN,BlockK,DataT,Layout,CurrentMs"
+fi
+
+for block in "${blocks[@]}"; do
+  read -r m n k <<< "$block"
+  for type in "${types[@]}"; do
+    for layout in "${layouts[@]}"; do
+      defines=(-DROCWMMA_CT_BLOCK_M="$m" -DROCWMMA_CT_BLOCK_N="$n" -DROCWMMA_CT_BLOCK_K="$k"
+               -DROCWMMA_CT_DATA_T="$type" -DROCWMMA_CT_LAYOUT="$layout")
+
+      current=$(time_instance "$repo_dir/library/include" "${defines[@]}")
+      if [ -n "$baseline" ]; then
+        before=$(time_instance "$work_dir/library/include" "${defines[@]}")
+        speedup=$(awk -v b="$before" -v c="$current" 'BEGIN { printf "%.2f", (c > 0 ? b / c : 0) }')
+        echo "$m,$n,$k,$type,$layout,$before,$current,$speedup"
+      else
+        echo "$m,$n,$k,$type,$layout,$current"
+      fi
+    done
+  done
+done
@@ -0,0 +1,51 @@
+#!/usr/bin/env bash
+# Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+
+# Reports the memory instructions issued by the io_bandwidth_test kernels, from the
+# assembly produced by building with -DROCWMMA_BUILD_ASSEMBLY=ON.
+#
+# Instruction widths (e.g. global_load_dwordx4 vs. global_load_ushort) show the
+# vector width that each block size, type and layout reaches on each IO path:
+#   ./IoInstructionReport.sh ../../build > io_instructions.csv
+#
+# Other tests are reported with a test directory and a kernel name pattern, e.g. the
+# staged vs. direct D stores of the lds_epilogue gemm target (_LE). Staged kernels
+# have WithLdsEpilogue in their name:
+#   ./IoInstructionReport.sh ../../build test/gemm/gemm_PGR1_LB2_MP0_MB_CP \
+#       gemm_PGR1_LB2_MP0_MB_CP > le_instructions.csv
+
+set -eu
+
+# ensure this script is in the cwd
+cd "$(dirname "${BASH_SOURCE[0]}")"
+
+build_dir=${1:-../../build}
+test_dir=${2:-test/unit/io_bandwidth_test}
+kernel_pattern=${3:-IoBandwidth}
+asm_dir=$build_dir/$test_dir/
+
+if [ ! -d "$asm_dir" ]; then
+  echo "No $test_dir build found in $asm_dir" >&2
+  exit 1
+fi
+
+echo "File,Kernel,Instruction,Count"
+
+find "$asm_dir" -path "*/assembly/*" -name "*.s" | sort | while read -r f; do
+  awk -v file="$(basename "$f")" -v pattern="$kernel_pattern" '
+    /^[[:space:]]*\.type[[:space:]]+.*,@function/ {
+      kernel = $2; sub(/,.*/, "", kernel)
+    }
+    kernel ~ pattern && $1 ~ /^(global|buffer|flat)_(load|store)|^ds_(read|write|load|store)/ {
+      if(!((kernel, $1) in count)) {
+        order[++total] = kernel SUBSEP $1
+      }
+      count[kernel, $1]++
+    }
+    END {
+      for(i = 1; i <= total; i++) {
+        split(order[i], key, SUBSEP)
+        printf "%s,%s,%s,%d\n", file, key[1], key[2], count[key[1], key[2]]
+      }
+    }' "$f"
+done
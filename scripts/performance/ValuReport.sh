@@ -0,0 +1,84 @@
+#!/usr/bin/env bash
+# Copyright (C) 2022-2024 Advanced Micro Devices, Inc. All rights reserved.
+
+# Reports the VALU work around the mma instructions of the gemm kernels, from the
+# assembly produced by building with -DROCWMMA_BUILD_ASSEMBLY=ON.
+#
+# On gfx11, formatting WMMA inputs and padding accumulators is VALU work
+# (v_perm_b32, v_permlane*, v_and / v_or, v_cvt).
+#
+# Report one build:
+#   ./ValuReport.sh ../../build > report.csv
+#
+# Compare the VALU per mma of two commits, per kernel and in total, on builds
+# for the same gfx11 target (e.g. before / after native_fragment):
+#   ./ValuReport.sh ../../build-before ../../build-after > compare.csv
+
+set -eu
+
+# ensure this script is in the cwd
+cd "$(dirname "${BASH_SOURCE[0]}")"
+
+report() {
+  local asm_dir=$1/test/gemm/
+
+  if [ ! -d "$asm_dir" ]; then
+    echo "No gemm build found in $asm_dir" >&2
+    exit 1
+  fi
+
+  echo "File,Kernel,Mma,Valu,Perm,ValuPerMma"
+
+  find "$asm_dir" -path "*/assembly/*" -name "*.s" | sort | while read -r f; do
+    awk -v file="$(basename "$f")" '
+      /^[[:space:]]*\.type[[:space:]]+.*,@function/ {
+        kernel = $2; sub(/,.*/, "", kernel)
+        order[++count] = kernel
+      }
+      $1 ~ /^v_(mfma|wmma)/ { mma[kernel]++; next }
+      $1 ~ /^v_accvgpr/     { next }
+      $1 ~ /^v_perm/        { perm[kernel]++ }
+      $1 ~ /^v_/            { valu[kernel]++ }
+      END {
+        for(i = 1; i <= count; i++) {
+          k = order[i]
+          # Only report kernels that issue mma
+          if(mma[k] == 0) continue
+          printf "%s,%s,%d,%d,%d,%.2f\n", file, k, mma[k], valu[k], perm[k], valu[k] / mma[k]
+        }
+      }' "$f"
+  done
+}
+
+if [ $# -lt 2 ]; then
+  report "${1:-../../build}"
+  exit 0
+fi
+
+before=$(mktemp)
+after=$(mktemp)
+trap 'rm -f "$before" "$after"' EXIT
+
+report "$1" > "$before"
+report "$2" > "$after"
+
+# Match kernels by (File, Kernel). Only kernels present in both builds are compared.
+awk -F, '
+  FNR == 1 { next }
+  NR == FNR { mma0[$1 "," $2] = $3; valu0[$1 "," $2] = $4; order[++count] = $1 "," $2; next }
+            { mma1[$1 "," $2] = $3; valu1[$1 "," $2] = $4 }
+  END {
+    print "File,Kernel,Mma,ValuBefore,ValuAfter,ValuPerMmaBefore,ValuPerMmaAfter,ValuPerMmaDelta"
+    for(i = 1; i <= count; i++) {
+      k = order[i]
+      if(!(k in mma1)) continue
+      before = valu0[k] / mma0[k]; after = valu1[k] / mma1[k]
+      printf "%s,%d,%d,%d,%.2f,%.2f,%.2f\n", k, mma0[k], valu0[k], valu1[k], \
+             before, after, after - before
+      kernels++; totalMma += mma0[k]; total0 += valu0[k]; total1 += valu1[k]
+    }
+    if(kernels > 0) {
+      printf "Total,%d kernels,%d,%d,%d,%.2f,%.2f,%.2f\n", kernels, totalMma, total0, total1, \
+             total0 / totalMma, total1 / totalMma, (total1 - total0) / totalMma
+    }
+  }' "$before" "$after"
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compile-time benchmark instance for the fragment IO paths.
+// Each compilation instantiates one (BlockM, BlockN, BlockK, DataT, DataLayout) configuration
+// of load / store and cooperative load / store so that front-end time can be measured per
+// kernel instance. See scripts/performance/BenchmarkCompileTime.sh.
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+
+#ifndef ROCWMMA_CT_BLOCK_M
+#define ROCWMMA_CT_BLOCK_M 32
+#endif
+#ifndef ROCWMMA_CT_BLOCK_N
+#define ROCWMMA_CT_BLOCK_N 32
+#endif
+#ifndef ROCWMMA_CT_BLOCK_K
+#define ROCWMMA_CT_BLOCK_K 16
+#endif
+#ifndef ROCWMMA_CT_DATA_T
+#define ROCWMMA_CT_DATA_T rocwmma::float16_t
+#endif
+#ifndef ROCWMMA_CT_LAYOUT
+#define ROCWMMA_CT_LAYOUT rocwmma::row_major
+#endif
+#ifndef ROCWMMA_CT_WAVE_COUNT
+#define ROCWMMA_CT_WAVE_COUNT 4
+#endif
+
+namespace rocwmma
+{
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t WaveCount>
+    __global__ void __launch_bounds__(256) ioUnrollInstance(DataT const* a,
+                                                            DataT const* b,
+                                                            DataT*       c,
+                                                            uint32_t     lda,
+                                                            uint32_t     ldb,
+                                                            uint32_t     ldc,
+                                                            uint32_t     waveIndex,
+                                                            uint32_t     waveCount)
+    {
+        fragment<matrix_a, BlockM, BlockN, BlockK, DataT, DataLayoutT>    fragA;
+        fragment<matrix_b, BlockM, BlockN, BlockK, DataT, DataLayoutT>    fragB;
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> fragC;
+
+        // Wave-wide IO
+        load_matrix_sync(fragA, a, lda);
+        load_matrix_sync(fragB, b, ldb);
+        load_matrix_sync(fragC, c, ldc);
+        store_matrix_sync(c, fragC, ldc);
+
+        // Cooperative IO, with run-time and compile-time wave counts
+        load_matrix_coop_sync(fragA, a, lda, waveIndex, waveCount);
+        store_matrix_coop_sync(c, fragA, ldc, waveIndex, waveCount);
+        load_matrix_coop_sync<WaveCount>(fragB, b, ldb, waveIndex);
+        store_matrix_coop_sync<WaveCount>(c, fragB, ldc, waveIndex);
+    }
+
+    template __global__ void ioUnrollInstance<ROCWMMA_CT_BLOCK_M,
+                                              ROCWMMA_CT_BLOCK_N,
+                                              ROCWMMA_CT_BLOCK_K,
+                                              ROCWMMA_CT_DATA_T,
+                                              ROCWMMA_CT_LAYOUT,
+                                              ROCWMMA_CT_WAVE_COUNT>(ROCWMMA_CT_DATA_T const*,
+                                                                     ROCWMMA_CT_DATA_T const*,
+                                                                     ROCWMMA_CT_DATA_T*,
+                                                                     uint32_t,
+                                                                     uint32_t,
+                                                                     uint32_t,
+                                                                     uint32_t,
+                                                                     uint32_t);
+
+} // namespace rocwmma
@@ -0,0 +1,340 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_MLP_DETAIL_HPP
+#define DLRM_MLP_DETAIL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "device/dlrm_mlp_fwd.hpp"
+#include "dlrm_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Fused bottom / top MLP: Layers x (GEMM + bias + ReLU) over a batch of b rows.
+    // Problem size is interpreted as (M, K, B) = (hidden width, input width, batch).
+    // Layer 0 maps K -> M and every further layer maps M -> M.
+    template <uint32_t TileSize, typename DataT, uint32_t Layers>
+    struct DlrmMlpKernel final : public DlrmKernelBase<TileSize, DataT>
+    {
+    private:
+        using Base = DlrmKernelBase<TileSize, DataT>;
+
+        template <typename T>
+        using DevicePtrT = typename Base::DataStorage::template DevicePtrT<T>;
+
+        template <typename T>
+        using HostPtrT = typename Base::DataStorage::template HostPtrT<T>;
+
+        // Accumulator registers per wave. Wider layers are tiled across waves and passes.
+        static constexpr uint32_t MaxWidth = 256u;
+
+        using KernelMlpFunc = void (*)(const DataT* __restrict, // input
+                                       const DataT* __restrict, // weights
+                                       const DataT* __restrict, // bias
+                                       DataT* __restrict, // output
+                                       uint32_t, // m
+                                       uint32_t, // k
+                                       uint32_t, // b
+                                       uint32_t); // layers
+
+    public:
+        DlrmMlpKernel()
+            : mDeviceWeights(Base::DataStorage::template allocDevice<DataT>(0))
+            , mDeviceBias(Base::DataStorage::template allocDevice<DataT>(0))
+            , mHostWeights(Base::DataStorage::template allocHost<DataT>(0))
+            , mHostBias(Base::DataStorage::template allocHost<DataT>(0))
+        {
+        }
+        ~DlrmMlpKernel() final {}
+
+        // The fused MLP has its own launch interface, see exec()
+        typename Base::KernelFwdFunc kernelFwdImpl() const final
+        {
+            return nullptr;
+        }
+
+        typename Base::KernelBwdFunc kernelBwdImpl() const final
+        {
+            return nullptr;
+        }
+
+        typename Base::KernelTrilFunc kernelTrilImpl() const final
+        {
+            return nullptr;
+        }
+
+        KernelMlpFunc kernelMlpImpl() const
+        {
+            return KernelMlpFunc(dlrmMlpFwd<DataT, TileSize, MaxWidth>);
+        }
+
+        uint32_t weightCount() const
+        {
+            return this->mK * this->mM + (Layers - 1u) * this->mM * this->mM;
+        }
+
+        uint32_t ldsUsage() const final
+        {
+            // Activation rows shared by every wave
+            auto ldAct = std::max(this->mM, this->mK);
+            return sizeof(DataT) * TileSize * ldAct;
+        }
+
+        dim3 gridDim() const final
+        {
+            return dim3(ceilDiv(this->mB, TileSize));
+        }
+
+        bool checkSizes() const final
+        {
+            // Forward pass only. Every workgroup must own a full tile of batch rows.
+            auto warpSize = Base::DeviceInfo::instance()->warpSize();
+            return (this->passDirection == DlrmDirection_t::Forward) && Base::checkSizes()
+                   && (this->mTBlockX % warpSize == 0) && (this->mB % TileSize == 0);
+        }
+
+        void setup(ProblemParams const& problem) final
+        {
+            // Reset the flags in case of multiple runs
+            this->mRunFlag = true;
+
+            std::tie(this->mTBlockX, this->mTBlockY)
+                = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
+                           static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
+            std::tie(this->mM, this->mK, this->mB)
+                = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.problemSize)),
+                           static_cast<uint32_t const&>(std::get<1>(problem.problemSize)),
+                           static_cast<uint32_t const&>(std::get<2>(problem.problemSize)));
+
+            this->mMPadded      = ceilDiv(this->mM, TileSize) * TileSize;
+            this->mKPadded      = ceilDiv(this->mK, TileSize) * TileSize;
+            this->passDirection = problem.passDirection;
+
+            this->mRunFlag &= this->checkDevice();
+            this->mRunFlag &= checkSizes();
+            this->mRunFlag &= this->checkLds();
+
+            if(this->mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+
+                // Input: B x K, Output: B x M
+                dataInstance->resizeFwdStorage(
+                    std::make_tuple(static_cast<int64_t>(this->mB) * this->mK,
+                                    static_cast<int64_t>(this->mB) * this->mM,
+                                    static_cast<int64_t>(0),
+                                    typename Base::DataStorage::DummyT()));
+
+                Base::DataStorage::reallocDeviceHostPair(
+                    mDeviceWeights, mHostWeights, weightCount());
+                Base::DataStorage::reallocDeviceHostPair(mDeviceBias, mHostBias, Layers * this->mM);
+
+                // Integer fills saturate after a couple of layers, so use He-uniform
+                // weights that keep activations in range through the ReLU chain.
+                std::mt19937                          rng(5489u);
+                std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+                for(uint32_t i = 0; i < this->mB * this->mK; i++)
+                {
+                    dataInstance->hostInput()[i] = static_cast<DataT>(unit(rng));
+                }
+
+                auto inDim  = this->mK;
+                auto offset = 0u;
+                for(uint32_t l = 0; l < Layers; l++)
+                {
+                    auto scale = std::sqrt(6.0f / static_cast<float>(inDim));
+                    for(uint32_t i = 0; i < inDim * this->mM; i++)
+                    {
+                        mHostWeights[offset + i] = static_cast<DataT>(scale * unit(rng));
+                    }
+                    offset += inDim * this->mM;
+                    inDim  = this->mM;
+                }
+
+                for(uint32_t i = 0; i < Layers * this->mM; i++)
+                {
+                    mHostBias[i] = static_cast<DataT>(0.1f * unit(rng));
+                }
+
+                dataInstance->copyHostToDeviceFwdAll();
+                Base::DataStorage::copyData(mDeviceWeights, mHostWeights, weightCount());
+                Base::DataStorage::copyData(mDeviceBias, mHostBias, Layers * this->mM);
+            }
+        }
+
+        void exec() final
+        {
+            if(this->mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+
+                auto mlpKernel = [this, &dataInstance]() {
+                    hipExtLaunchKernelGGL((this->kernelMlpImpl()),
+                                          (this->gridDim()),
+                                          (this->blockDim()),
+                                          (this->ldsUsage()),
+                                          0,
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          dataInstance->deviceInput().get(),
+                                          mDeviceWeights.get(),
+                                          mDeviceBias.get(),
+                                          dataInstance->deviceOutput().get(),
+                                          this->mM,
+                                          this->mK,
+                                          this->mB,
+                                          Layers);
+                };
+
+                hipEvent_t startEvent, stopEvent;
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < this->mRepeats; ++i)
+                {
+                    mlpKernel();
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+                // Calculate efficiency
+                auto& deviceInfo = Base::DeviceInfo::instance();
+
+                // Every layer is a B x M x inDim GEMM
+                auto devicePeakGFlopsPerSec = deviceInfo->template peakGFlopsPerSec<DataT>();
+                auto reductionSize          = this->mK + (Layers - 1u) * this->mM;
+
+                this->mElapsedTimeMs = float64_t(timeMs);
+                this->mTotalGFlops   = calculateGFlops(this->mB, this->mM, reductionSize);
+                this->mMeasuredTFlopsPerSec
+                    = calculateTFlopsPerSec(this->mB, this->mM, reductionSize, this->mElapsedTimeMs)
+                      * static_cast<float64_t>(this->mRepeats);
+
+                this->mEfficiency
+                    = round(this->mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+#if ROCWMMA_VALIDATION_TESTS
+                dlrm_mlp_fwd_CPU<DataT>(dataInstance->hostInput().get(),
+                                        mHostWeights.get(),
+                                        mHostBias.get(),
+                                        dataInstance->hostOutputRef().get(),
+                                        this->mM,
+                                        this->mK,
+                                        Layers,
+                                        this->mB);
+#endif // ROCWMMA_VALIDATION_TESTS
+            }
+        }
+
+        void validateResults() final
+        {
+#if ROCWMMA_VALIDATION_TESTS
+            if(this->mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+
+                auto outputSize = this->mM * this->mB;
+                auto reference  = dataInstance->template allocDevice<DataT>(outputSize);
+                dataInstance->copyData(reference, dataInstance->hostOutputRef(), outputSize);
+
+                std::tie(this->mValidationResult, this->mMaxRelativeError)
+                    = compareEqualLaunchKernel<DataT, DataT>(dataInstance->deviceOutput().get(),
+                                                             reference.get(),
+                                                             1,
+                                                             this->mM,
+                                                             this->mB,
+                                                             10.0);
+
+                EXPECT_TRUE(this->mValidationResult)
+                    << "Max relative error: " << this->mMaxRelativeError;
+            }
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+
+        void tearDown() final
+        {
+            // Weights are not shared with other kernels
+            Base::DataStorage::reallocDeviceHostPair(mDeviceWeights, mHostWeights, 0);
+            Base::DataStorage::reallocDeviceHostPair(mDeviceBias, mHostBias, 0);
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "Layers, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << Layers << ", ");
+        }
+
+    private:
+        DevicePtrT<DataT> mDeviceWeights, mDeviceBias;
+        HostPtrT<DataT>   mHostWeights, mHostBias;
+    };
+
+    // This is the GeneratorImpl class
+    struct DlrmMlpGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT    = 0,
+            TileSize = 1,
+            Layers   = 2
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = DlrmMlpKernel<std::tuple_element_t<TileSize, TestParamsT>::value,
+                                          std::tuple_element_t<DataT, TestParamsT>,
+                                          std::tuple_element_t<Layers, TestParamsT>::value>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // DLRM_MLP_DETAIL_HPP
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_MLP_FWD_HPP
+#define DLRM_MLP_FWD_HPP
+
+#include <rocwmma/internal/utils.hpp>
+
+#include "./common.hpp"
+
+namespace rocwmma
+{
+
+    // Fused MLP forward pass: output = relu(... relu(relu(input * W0 + b0) * W1 + b1) ...).
+    // Input is b x k, layer 0 weights are k x m and every further layer is m x m, all row major.
+    // Weight layers are packed back to back, biases are packed as layers x m.
+    //
+    // Each workgroup owns TILE_DIM batch rows and keeps them in LDS for the whole chain,
+    // so activations are shared by every wave and never leave the workgroup between layers.
+    // The output width is tiled across waves: each wave holds MAX_WIDTH columns of
+    // accumulators in registers and streams its own weight columns from global memory.
+    // Layers wider than waves * MAX_WIDTH take several passes over the same activations.
+    //
+    // Single pass layers overwrite the activations in place once every wave has read them.
+    // Multi pass layers park each pass in the workgroup's own output rows, which the last
+    // layer overwrites anyway, and reload them into LDS after the final pass.
+    //
+    // LDS layout (DataT):
+    // Activations: TILE_DIM x max(k, m)
+    template <typename DataT, uint TILE_DIM, uint MAX_WIDTH>
+    __global__ void __launch_bounds__(128, 1) dlrmMlpFwd(const DataT* __restrict input,
+                                                         const DataT* __restrict weights,
+                                                         const DataT* __restrict bias,
+                                                         DataT* __restrict output,
+                                                         uint m,
+                                                         uint k,
+                                                         uint b,
+                                                         uint layers)
+    {
+        using FragA    = fragment<matrix_a, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragB    = fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragAcc  = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, float32_t>;
+        using FragBias = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, DataT>;
+        using FragOut  = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, DataT>;
+
+        constexpr uint MaxTiles = MAX_WIDTH / TILE_DIM;
+
+        auto waveCount = blockDim.x / Constants::AMDGCN_WAVE_SIZE;
+        auto waveIdx   = threadIdx.x / Constants::AMDGCN_WAVE_SIZE;
+        auto blockRow  = blockIdx.x * TILE_DIM;
+        auto ldAct     = (k > m) ? k : m;
+        auto tilesN    = m / TILE_DIM;
+        auto passTiles = waveCount * MaxTiles;
+        auto passCount = (tilesN + passTiles - 1u) / passTiles;
+
+        if(blockRow >= b)
+        {
+            return;
+        }
+
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsAct = reinterpret_cast<DataT*>(localMemPtr);
+
+        // Stage the workgroup's input rows into the LDS activations
+        auto* inputBlock = input + blockRow * k;
+        for(uint i = threadIdx.x; i < TILE_DIM * k; i += blockDim.x)
+        {
+            ldsAct[(i / k) * ldAct + (i % k)] = inputBlock[i];
+        }
+
+        auto* outputBlock  = output + blockRow * m;
+        auto* weightsLayer = weights;
+        auto  inDim        = k;
+        for(uint layer = 0; layer < layers; layer++)
+        {
+            auto  lastLayer = (layer + 1u == layers);
+            auto  inPlace   = !lastLayer && (passCount == 1u);
+            auto* biasLayer = bias + layer * m;
+
+            // Wait for the activation writes of the previous layer
+            synchronize_workgroup();
+
+            for(uint pass = 0; pass < passCount; pass++)
+            {
+                auto tileBase = pass * passTiles + waveIdx * MaxTiles;
+
+                FragAcc fragAcc[MaxTiles];
+#pragma unroll
+                for(uint j = 0; j < MaxTiles; j++)
+                {
+                    if(tileBase + j < tilesN)
+                    {
+                        fill_fragment(fragAcc[j], static_cast<float32_t>(0));
+                    }
+                }
+
+                for(uint kk = 0; kk < inDim; kk += TILE_DIM)
+                {
+                    auto fragA = FragA();
+                    load_matrix_sync(fragA, ldsAct + kk, ldAct);
+
+                    // Weight rows [kk, kk + TILE_DIM) of this wave's columns
+                    auto* weightsPanel = weightsLayer + kk * m;
+#pragma unroll
+                    for(uint j = 0; j < MaxTiles; j++)
+                    {
+                        if(tileBase + j < tilesN)
+                        {
+                            auto fragB = FragB();
+                            load_matrix_sync(fragB, weightsPanel + (tileBase + j) * TILE_DIM, m);
+                            mma_sync(fragAcc[j], fragA, fragB, fragAcc[j]);
+                        }
+                    }
+                }
+
+                // Wait until every wave has consumed the activations
+                if(inPlace)
+                {
+                    synchronize_workgroup();
+                }
+
+                // Bias + ReLU epilogue
+#pragma unroll
+                for(uint j = 0; j < MaxTiles; j++)
+                {
+                    if(tileBase + j < tilesN)
+                    {
+                        auto col      = (tileBase + j) * TILE_DIM;
+                        auto fragBias = FragBias();
+                        auto fragOut  = FragOut();
+                        load_matrix_sync(fragBias, biasLayer + col, row_vector{});
+
+                        for(uint i = 0; i < fragOut.num_elements; i++)
+                        {
+                            auto value = fragAcc[j].x[i] + static_cast<float32_t>(fragBias.x[i]);
+                            fragOut.x[i]
+                                = static_cast<DataT>(value > static_cast<float32_t>(0)
+                                                         ? value
+                                                         : static_cast<float32_t>(0));
+                        }
+
+                        if(inPlace)
+                        {
+                            store_matrix_sync(ldsAct + col, fragOut, ldAct, mem_row_major);
+                        }
+                        else
+                        {
+                            store_matrix_sync(outputBlock + col, fragOut, m, mem_row_major);
+                        }
+                    }
+                }
+            }
+
+            // Reload the parked passes as the next layer's activations
+            if(!lastLayer && !inPlace)
+            {
+                synchronize_workgroup();
+                for(uint i = threadIdx.x; i < TILE_DIM * m; i += blockDim.x)
+                {
+                    ldsAct[(i / m) * ldAct + (i % m)] = outputBlock[i];
+                }
+            }
+
+            weightsLayer += inDim * m;
+            inDim        = m;
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // DLRM_MLP_FWD_HPP
@@ -81,3 +81,6 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
                        ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
                        ::testing::ValuesIn(rocwmma::TestParams::passDirections())));
+
+// The --kernel filter may remove every kernel of the suite
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DlrmDotLdsTestBasic);
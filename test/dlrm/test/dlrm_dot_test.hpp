@@ -35,12 +35,12 @@
 namespace rocwmma
 {
     struct DlrmDotTest
-        : public ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelT,
+        : public ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelFactoryT,
                                                      typename DlrmTestParams::ThreadBlockT,
                                                      typename DlrmTestParams::ProblemSizeT,
                                                      typename DlrmTestParams::PassDirectionT>>
     {
-        using Base = ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelT,
+        using Base = ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelFactoryT,
                                                          typename DlrmTestParams::ThreadBlockT,
                                                          typename DlrmTestParams::ProblemSizeT,
                                                          typename DlrmTestParams::PassDirectionT>>;
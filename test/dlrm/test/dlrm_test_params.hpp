@@ -43,6 +43,7 @@ namespace rocwmma
     {
         // Types of parameters
         using KernelT        = std::shared_ptr<KernelI>;
+        using KernelFactoryT = KernelFactory<KernelT>;
         using ThreadBlockT   = std::pair<int64_t, int64_t>;
         using ProblemSizeT   = std::tuple<int64_t, int64_t, int64_t>;
         using PassDirectionT = DlrmDirection_t;
@@ -191,9 +191,18 @@ namespace rocwmma
                     load_matrix_sync(fragA, globalAddrsA[i], lda);
                     globalAddrsA[i] += incrA;
 
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+                    // Accumulators in AGPRs, inputs in VGPRs
+                    place_registers<vgpr_storage>(fragA);
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
+
                     //#pragma unroll
                     for(int j = 0; j < BlocksY; j++)
                     {
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+                        place_registers<agpr_storage>(fragsAccum[i][j]);
+                        place_registers<vgpr_storage>(cachedFragsB[j]);
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
                         mma_sync(fragsAccum[i][j], fragA, cachedFragsB[j], fragsAccum[i][j]);
                     }
                 }
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL_FIXED_SHAPE
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL_FIXED_SHAPE
+
+#include "device/kernel_device_func_fixed_shape.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// Problem shape policies.
+    /// GemmShapeRuntime: M, N, K and leading dims are kernel arguments.
+    /// GemmShapeFixed: M, N, K and leading dims are baked into the kernel.
+    ///
+    struct GemmShapeRuntime
+    {
+        constexpr static bool IsFixed = false;
+    };
+
+    template <uint32_t M, uint32_t N, uint32_t K>
+    struct GemmShapeFixed
+    {
+        constexpr static bool     IsFixed = true;
+        constexpr static uint32_t FixedM  = M;
+        constexpr static uint32_t FixedN  = N;
+        constexpr static uint32_t FixedK  = K;
+    };
+
+    ///
+    /// Runs gemm_PGR0_LB0_MP0_SB_NC either with a runtime shape, or
+    /// specialized for a fixed shape, so that both may be benchmarked
+    /// side by side on the same problems.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename ShapeT>
+    struct Kernel_PGR0_LB0_MP0_SB_NC_FixedShape final : public GemmKernelBase<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR0_LB0_MP0_SB_NC_guard<BlockM,
+                                                        BlockN,
+                                                        BlockK,
+                                                        InputT,
+                                                        OutputT,
+                                                        ComputeT,
+                                                        TBlockX,
+                                                        TBlockY,
+                                                        WaveSize,
+                                                        ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static constexpr auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(!TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return typename Base::KernelFunc(nullptr);
+                }
+                else if constexpr(ShapeT::IsFixed)
+                {
+                    return typename Base::KernelFunc(
+                        gemm_PGR0_LB0_MP0_SB_NC_fixed_shape<BlockM,
+                                                            BlockN,
+                                                            BlockK,
+                                                            InputT,
+                                                            OutputT,
+                                                            ComputeT,
+                                                            LayoutA,
+                                                            LayoutB,
+                                                            LayoutC,
+                                                            LayoutD,
+                                                            ShapeT::FixedM,
+                                                            ShapeT::FixedN,
+                                                            ShapeT::FixedK,
+                                                            TBlockX,
+                                                            TBlockY,
+                                                            WaveSize,
+                                                            ArchId>);
+                }
+                else
+                {
+                    return typename Base::KernelFunc(gemm_PGR0_LB0_MP0_SB_NC<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             TBlockX,
+                                                                             TBlockY,
+                                                                             WaveSize,
+                                                                             ArchId>);
+                }
+            }
+        };
+
+    public:
+        Kernel_PGR0_LB0_MP0_SB_NC_FixedShape() {}
+        ~Kernel_PGR0_LB0_MP0_SB_NC_FixedShape() final {}
+
+        bool checkSizes() const final
+        {
+            if constexpr(ShapeT::IsFixed)
+            {
+                // Fixed-shape kernels only run the problem they were built for
+                using LeadingDims = FixedShapeLeadingDims<ShapeT::FixedM,
+                                                          ShapeT::FixedN,
+                                                          ShapeT::FixedK,
+                                                          LayoutA,
+                                                          LayoutB,
+                                                          LayoutC,
+                                                          LayoutD>;
+
+                return Base::checkSizes() && (Base::mM == ShapeT::FixedM)
+                       && (Base::mN == ShapeT::FixedN) && (Base::mK == ShapeT::FixedK)
+                       && (Base::mLda == LeadingDims::Lda) && (Base::mLdb == LeadingDims::Ldb)
+                       && (Base::mLdc == LeadingDims::Ldc) && (Base::mLdd == LeadingDims::Ldd);
+            }
+            else
+            {
+                return Base::checkSizes();
+            }
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        std::ostream& printHeader(std::ostream& stream) const final
+        {
+            stream << "Shape, ";
+            return Base::printHeader(stream);
+        }
+
+        std::ostream& printKernel(std::ostream& stream) const final
+        {
+            stream << (ShapeT::IsFixed ? "fixed" : "runtime") << ", ";
+            return Base::printKernel(stream);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL_FIXED_SHAPE
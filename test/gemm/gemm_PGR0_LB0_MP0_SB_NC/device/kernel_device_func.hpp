@@ -144,6 +144,14 @@ namespace rocwmma
                 // Load and multiply
                 load_matrix_sync(fragA, addrA, lda);
                 load_matrix_sync(fragB, addrB, ldb);
+
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+                // Accumulators in AGPRs, inputs in VGPRs
+                place_registers<agpr_storage>(fragAcc);
+                place_registers<vgpr_storage>(fragA);
+                place_registers<vgpr_storage>(fragB);
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
+
                 mma_sync(fragAcc, fragA, fragB, fragAcc);
 
                 addrA += incrA;
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC_FIXED_SHAPE
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC_FIXED_SHAPE
+
+#include "kernel_device_func.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// Packed leading dimensions of a fixed M x N x K problem,
+    /// following the convention of the gemm test resources.
+    ///
+    template <uint32_t FixedM,
+              uint32_t FixedN,
+              uint32_t FixedK,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    struct FixedShapeLeadingDims
+    {
+        constexpr static uint32_t Lda = std::is_same_v<LayoutA, row_major> ? FixedK : FixedM;
+        constexpr static uint32_t Ldb = std::is_same_v<LayoutB, row_major> ? FixedN : FixedK;
+        constexpr static uint32_t Ldc = std::is_same_v<LayoutC, row_major> ? FixedN : FixedM;
+        constexpr static uint32_t Ldd = std::is_same_v<LayoutD, row_major> ? FixedN : FixedM;
+    };
+
+    ///
+    /// Fixed-shape variant of gemm_PGR0_LB0_MP0_SB_NC for
+    /// model GEMMs whose shape is known at build time.
+    ///
+    /// M, N, K and the leading dimensions are template constants, so that:
+    /// - The K loop has a constant trip count and is fully unrolled
+    /// - Address offsets and increments fold to immediates
+    /// - Bound checks are dropped; the host guarantees exact grid coverage
+    ///
+    /// The runtime m, n, k and ld arguments are kept to match the test
+    /// interface, but are ignored.
+    ///
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              uint32_t FixedM,
+              uint32_t FixedN,
+              uint32_t FixedK,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256)
+        gemm_PGR0_LB0_MP0_SB_NC_fixed_shape(uint32_t /*m*/,
+                                            uint32_t /*n*/,
+                                            uint32_t /*k*/,
+                                            InputT const*  a,
+                                            InputT const*  b,
+                                            OutputT const* c,
+                                            OutputT*       d,
+                                            uint32_t /*lda*/,
+                                            uint32_t /*ldb*/,
+                                            uint32_t /*ldc*/,
+                                            uint32_t /*ldd*/,
+                                            ComputeT alpha,
+                                            ComputeT beta)
+    {
+        static_assert(FixedM % BlockM == 0u, "FixedM must be a multiple of BlockM");
+        static_assert(FixedN % BlockN == 0u, "FixedN must be a multiple of BlockN");
+        static_assert(FixedK % BlockK == 0u, "FixedK must be a multiple of BlockK");
+
+        if constexpr(gemm_PGR0_LB0_MP0_SB_NC_guard<BlockM,
+                                                   BlockN,
+                                                   BlockK,
+                                                   InputT,
+                                                   OutputT,
+                                                   ComputeT,
+                                                   TBlockX,
+                                                   TBlockY,
+                                                   WaveSize,
+                                                   ArchId>::enableBuild())
+        {
+            using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+            using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+            using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
+            using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>;
+
+            using MappingA = MappingUtil<BlockM, BlockK, InputT, LayoutA>;
+            using MappingB = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
+            using MappingC = MappingUtil<BlockM, BlockN, OutputT, LayoutC>;
+            using MappingD = MappingUtil<BlockM, BlockN, OutputT, LayoutD>;
+
+            using LeadingDims = FixedShapeLeadingDims<FixedM,
+                                                      FixedN,
+                                                      FixedK,
+                                                      LayoutA,
+                                                      LayoutB,
+                                                      LayoutC,
+                                                      LayoutD>;
+
+            constexpr uint32_t Lda   = LeadingDims::Lda;
+            constexpr uint32_t Ldb   = LeadingDims::Ldb;
+            constexpr uint32_t Ldc   = LeadingDims::Ldc;
+            constexpr uint32_t Ldd   = LeadingDims::Ldd;
+            constexpr uint32_t Count = FixedK / BlockK;
+
+            // Target C / D block on 2D grid.
+            // The grid exactly covers FixedM x FixedN, so no bound checks.
+            auto matrixCoordC = MappingC::matrixCoord();
+
+            // Initialize accumulator
+            auto fragAcc = FragAcc();
+            fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+            // Setup starting addresses
+            // Offset A to col 0
+            // Offset B to row 0
+            auto* addrA = MappingA::dataCoord(a, MappingC::matrixCoordN(0), Lda);
+            auto* addrB = MappingB::dataCoord(b, MappingC::matrixCoordM(0), Ldb);
+
+            // Address increments are compile-time constants.
+            // A steps BlockK through m x k
+            // B steps BlockK through k x n
+            constexpr uint32_t IncrA = std::is_same_v<LayoutA, row_major> ? BlockK : BlockK * Lda;
+            constexpr uint32_t IncrB = std::is_same_v<LayoutB, row_major> ? BlockK * Ldb : BlockK;
+
+            // Accumulate A * B
+#pragma unroll
+            for(uint32_t i = 0; i < Count; i++)
+            {
+                // Keep waves in sync for cache hits on re-used A and B data.
+                synchronize_workgroup();
+
+                auto fragA = FragA();
+                auto fragB = FragB();
+
+                // Load and multiply
+                load_matrix_sync(fragA, addrA + i * IncrA, Lda);
+                load_matrix_sync(fragB, addrB + i * IncrB, Ldb);
+
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+                // Accumulators in AGPRs, inputs in VGPRs
+                place_registers<agpr_storage>(fragAcc);
+                place_registers<vgpr_storage>(fragA);
+                place_registers<vgpr_storage>(fragB);
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
+
+                mma_sync(fragAcc, fragA, fragB, fragAcc);
+            }
+
+            auto fragC = FragC();
+
+            // Setup address and load C
+            auto* addrC = MappingC::dataCoord(c, matrixCoordC, Ldc);
+            load_matrix_sync(fragC, addrC, Ldc);
+
+            // D = alpha * accumAB + beta * C
+#pragma unroll
+            for(int i = 0; i < fragC.num_elements; ++i)
+            {
+                fragC.x[i] = OutputT(alpha * ComputeT(fragAcc.x[i]) + beta * ComputeT(fragC.x[i]));
+            }
+
+            // Output addresss
+            auto* addrD = MappingD::dataCoord(d, matrixCoordC, Ldd);
+
+            // Store the output
+            store_matrix_sync(addrD, fragC, Ldd);
+        }
+    }
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC_FIXED_SHAPE
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "detail/kernel_generator_fixed_shape_impl.hpp"
+#include "test/test_includes.hpp"
+
+///
+/// Fixed-shape kernels benchmarked against the runtime-shape kernel
+/// on the same model GEMM shapes.
+///
+
+namespace rocwmma
+{
+
+    struct TestParams : public CommonTestParams
+    {
+        using Base = CommonTestParams;
+
+        // Model GEMM shapes, baked into the fixed-shape kernels.
+        // BERT-base projections with 1024 tokens:
+        // QKV, attention output, FFN up and FFN down.
+        using FixedShapes = std::tuple<GemmShapeFixed<1024u, 2304u, 768u>,
+                                       GemmShapeFixed<1024u, 768u, 768u>,
+                                       GemmShapeFixed<1024u, 3072u, 768u>,
+                                       GemmShapeFixed<1024u, 768u, 3072u>>;
+
+        // Runtime-shape kernel as the baseline
+        using Shapes = typename Concat<GemmShapeRuntime, FixedShapes>::Result;
+
+        // Types: f16, bf16 (+ f32 extended)
+        // Block Sizes: 16 x 16 x 32, 32 x 32 x 16
+        // Layouts: NN, TN
+        using Types = std::tuple<
+#if ROCWMMA_EXTENDED_TESTS
+            std::tuple<float32_t, float32_t, float32_t>,
+#endif // ROCWMMA_EXTENDED_TESTS
+            std::tuple<float16_t, float32_t, float32_t>,
+            std::tuple<bfloat16_t, float32_t, float32_t>>;
+        using BlockSizes
+            = std::tuple<std::tuple<I<16>, I<16>, I<32>>, std::tuple<I<32>, I<32>, I<16>>>;
+        using Layouts =
+            typename Concat<typename Base::TestLayoutsNN, typename Base::TestLayoutsTN>::Result;
+
+        using KernelParams = typename CombineLists<Types, BlockSizes, Layouts, Shapes>::Result;
+
+        // Assemble the kernel generator
+        // Kernel: PGR0_LB0_MP0_SB_NC, runtime and fixed shapes
+        using GeneratorImpl   = KernelGenerator_PGR0_LB0_MP0_SB_NC_FixedShape;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        // Fixed-shape kernels skip every problem but their own
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return GeneratorImpl::problemSizes<ProblemSizeT>(FixedShapes());
+        }
+    };
+
+} // namespace rocwmma
+
+// Instantiate kernels as a test suite
+ROCWMMA_INSTANTIATE_GEMM_GTEST_SUITE(Gemm_PGR0_LB0_MP0_SB_NC, FixedShapeTest, rocwmma::TestParams);
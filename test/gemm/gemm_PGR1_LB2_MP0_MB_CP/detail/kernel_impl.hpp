@@ -27,6 +27,10 @@
 #ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
 #define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
 
+#include <functional>
+#include <numeric>
+#include <vector>
+
 #include "device/kernel_device_func.hpp"
 #include "gemm_kernel_base.hpp"
 #include "helper_macros.hpp"
@@ -72,78 +76,242 @@ namespace rocwmma
                                     LayoutC,
                                     LayoutD>;
 
-        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
-        using TestGuard = gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
-                                                        BlockN,
-                                                        BlockK,
-                                                        InputT,
-                                                        OutputT,
-                                                        ComputeT,
-                                                        LayoutA,
-                                                        LayoutB,
-                                                        LayoutC,
-                                                        LayoutD,
-                                                        LayoutLds,
-                                                        GemmConfig,
-                                                        BlocksX,
-                                                        BlocksY,
-                                                        TBlockX,
-                                                        TBlockY,
-                                                        WaveSize,
-                                                        ArchId>;
-
-        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
-        struct TestKernelFunc
-        {
-            static constexpr auto generate()
-            {
-                // Avoid attempting to reference kernel functions that haven't passed
-                // predicate tests, as they won't be built!
-                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+        // Kernel configuration built for the given epilogue mode.
+        // The General mode keeps the incoming configuration as-is.
+        template <CooperativeGemm::EpilogueMode Mode>
+        using EpilogueConfig
+            = std::conditional_t<Mode == CooperativeGemm::EpilogueMode::General,
+                                 GemmConfig,
+                                 CooperativeGemm::WithEpilogueMode<GemmConfig, Mode>>;
+
+        template <CooperativeGemm::EpilogueMode Mode>
+        struct EpilogueDispatch
+        {
+            using Config = EpilogueConfig<Mode>;
+
+            template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+            using TestGuard = gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
+                                                            BlockN,
+                                                            BlockK,
+                                                            InputT,
+                                                            OutputT,
+                                                            ComputeT,
+                                                            LayoutA,
+                                                            LayoutB,
+                                                            LayoutC,
+                                                            LayoutD,
+                                                            LayoutLds,
+                                                            Config,
+                                                            BlocksX,
+                                                            BlocksY,
+                                                            TBlockX,
+                                                            TBlockY,
+                                                            WaveSize,
+                                                            ArchId>;
+
+            template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+            struct TestKernelFunc
+            {
+                static constexpr auto generate()
                 {
-                    return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_CP<BlockM,
-                                                                             BlockN,
-                                                                             BlockK,
-                                                                             InputT,
-                                                                             OutputT,
-                                                                             ComputeT,
-                                                                             LayoutA,
-                                                                             LayoutB,
-                                                                             LayoutC,
-                                                                             LayoutD,
-                                                                             LayoutLds,
-                                                                             GemmConfig,
-                                                                             BlocksX,
-                                                                             BlocksY,
-                                                                             TBlockX,
-                                                                             TBlockY,
-                                                                             WaveSize,
-                                                                             ArchId>);
+                    // Avoid attempting to reference kernel functions that haven't passed
+                    // predicate tests, as they won't be built!
+                    if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun()
+                                 && CooperativeGemm::is_weight_stationary_v<Config>)
+                    {
+                        return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_CP_WS<BlockM,
+                                                                                    BlockN,
+                                                                                    BlockK,
+                                                                                    InputT,
+                                                                                    OutputT,
+                                                                                    ComputeT,
+                                                                                    LayoutA,
+                                                                                    LayoutB,
+                                                                                    LayoutC,
+                                                                                    LayoutD,
+                                                                                    LayoutLds,
+                                                                                    Config,
+                                                                                    BlocksX,
+                                                                                    BlocksY,
+                                                                                    TBlockX,
+                                                                                    TBlockY,
+                                                                                    WaveSize,
+                                                                                    ArchId>);
+                    }
+                    else if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun()
+                                      && CooperativeGemm::is_producer_consumer_v<Config>)
+                    {
+                        return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_CP_PC<BlockM,
+                                                                                    BlockN,
+                                                                                    BlockK,
+                                                                                    InputT,
+                                                                                    OutputT,
+                                                                                    ComputeT,
+                                                                                    LayoutA,
+                                                                                    LayoutB,
+                                                                                    LayoutC,
+                                                                                    LayoutD,
+                                                                                    LayoutLds,
+                                                                                    Config,
+                                                                                    BlocksX,
+                                                                                    BlocksY,
+                                                                                    TBlockX,
+                                                                                    TBlockY,
+                                                                                    WaveSize,
+                                                                                    ArchId>);
+                    }
+                    else if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                    {
+                        return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_CP<BlockM,
+                                                                                 BlockN,
+                                                                                 BlockK,
+                                                                                 InputT,
+                                                                                 OutputT,
+                                                                                 ComputeT,
+                                                                                 LayoutA,
+                                                                                 LayoutB,
+                                                                                 LayoutC,
+                                                                                 LayoutD,
+                                                                                 LayoutLds,
+                                                                                 Config,
+                                                                                 BlocksX,
+                                                                                 BlocksY,
+                                                                                 TBlockX,
+                                                                                 TBlockY,
+                                                                                 WaveSize,
+                                                                                 ArchId>);
+                    }
+                    else
+                    {
+                        return typename Base::KernelFunc(nullptr);
+                    }
                 }
-                else
+            };
+        };
+
+        // Epilogue selected on the host from alpha / beta, if the config opts in
+        CooperativeGemm::EpilogueMode epilogueMode() const
+        {
+            if constexpr(CooperativeGemm::is_epilogue_dispatch_v<GemmConfig>)
+            {
+                return CooperativeGemm::selectEpilogueMode(Base::mAlpha, Base::mBeta);
+            }
+            else
+            {
+                return CooperativeGemm::EpilogueMode::General;
+            }
+        }
+
+        bool dispatchEpilogueGuard() const
+        {
+            using CooperativeGemm::EpilogueMode;
+            using General = EpilogueDispatch<EpilogueMode::General>;
+
+            if constexpr(CooperativeGemm::is_epilogue_dispatch_v<GemmConfig>)
+            {
+                using BetaZero   = EpilogueDispatch<EpilogueMode::BetaZero>;
+                using Accumulate = EpilogueDispatch<EpilogueMode::Accumulate>;
+
+                switch(epilogueMode())
                 {
-                    return typename Base::KernelFunc(nullptr);
+                case EpilogueMode::BetaZero:
+                    return Base::template dispatchGuard<BetaZero::template TestGuard>();
+                case EpilogueMode::Accumulate:
+                    return Base::template dispatchGuard<Accumulate::template TestGuard>();
+                default:;
                 }
             }
-        };
+
+            return Base::template dispatchGuard<General::template TestGuard>();
+        }
+
+        // Dropout of the test runs
+        static constexpr float32_t DropoutProbability = 0.1f;
+        static constexpr uint64_t  DropoutSeed        = 0x2545F4914F6CDD1Dull;
+        static constexpr uint64_t  DropoutOffset      = 0x100000000ull;
+
+        CooperativeGemm::DropoutParams dropoutParams() const
+        {
+            auto* mask = CooperativeGemm::dropout_mask_v<GemmConfig> ? mDropoutMask.get() : nullptr;
+            return CooperativeGemm::makeDropoutParams(
+                DropoutProbability, DropoutSeed, DropoutOffset, mask, Base::mN);
+        }
+
+        // Applies the dropout to the reference result in place, and returns its mask
+        template <typename RefLayout>
+        std::vector<uint32_t> dropoutReference(OutputT* refResult) const
+        {
+            auto  params   = dropoutParams();
+            auto  elements = static_cast<size_t>(Base::mM) * Base::mN;
+            auto  hostRef  = std::vector<OutputT>(elements);
+            auto  hostMask = std::vector<uint32_t>(
+                CooperativeGemm::dropout_mask_v<GemmConfig> ? Base::mM * params.ldMask : 0u);
+            auto* mask     = hostMask.empty() ? nullptr : hostMask.data();
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                hostRef.data(), refResult, elements * sizeof(OutputT), hipMemcpyDeviceToHost));
+            CooperativeGemm::dropout_CPU<OutputT, RefLayout>(
+                hostRef.data(), mask, Base::mM, Base::mN, params);
+            CHECK_HIP_ERROR(hipMemcpy(
+                refResult, hostRef.data(), elements * sizeof(OutputT), hipMemcpyHostToDevice));
+
+            return hostMask;
+        }
 
     public:
-        Kernel_PGR1_LB2_MP0_MB_CP() {}
+        Kernel_PGR1_LB2_MP0_MB_CP()
+            : mDropoutMask(Base::DataStorage::template allocDevice<uint32_t>(0))
+        {
+        }
         ~Kernel_PGR1_LB2_MP0_MB_CP() final {}
 
         dim3 gridDim() const final
         {
-            return dim3(ceilDiv(Base::mM,
-                                BlockM * BlocksX * Base::mTBlockX
-                                    / Base::DeviceInfo::instance()->warpSize()),
-                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
+            auto tilesX = ceilDiv(Base::mM,
+                                  BlockM * BlocksX * Base::mTBlockX
+                                      / Base::DeviceInfo::instance()->warpSize());
+            auto tilesY = ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY);
+
+            // Weight-stationary workgroups are persistent in the M direction.
+            // Launch just enough of them for each B panel to fill the device once.
+            if constexpr(CooperativeGemm::is_weight_stationary_v<GemmConfig>)
+            {
+                auto cuCount = static_cast<uint32_t>(Base::DeviceInfo::instance()->cuCount());
+                tilesX       = std::max(1u, std::min(tilesX, cuCount / tilesY));
+            }
+
+            return dim3(tilesX, tilesY);
+        }
+
+        dim3 blockDim() const final
+        {
+            // Producer / consumer kernels add a slab of producer waves in z
+            auto blockDims = Base::blockDim();
+            if constexpr(CooperativeGemm::is_producer_consumer_v<GemmConfig>)
+            {
+                blockDims.z = 2u;
+            }
+            return blockDims;
         }
 
         bool checkSizes() const final
         {
-            return ((BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize())
-                    <= Base::mM)
-                   && ((BlockN * BlocksY * Base::mTBlockY) <= Base::mN) && (BlockK <= Base::mK);
+            auto macroTileM
+                = BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize();
+            auto macroTileN = BlockN * BlocksY * Base::mTBlockY;
+
+            // Weight-stationary kernels walk whole M tiles and hold whole K steps of
+            // the B panel, with no tail cleanup of remainders.
+            if constexpr(CooperativeGemm::is_weight_stationary_v<GemmConfig>)
+            {
+                if((Base::mM % macroTileM != 0u) || (Base::mN % macroTileN != 0u)
+                   || (Base::mK % BlockK != 0u))
+                {
+                    return false;
+                }
+            }
+
+            return (macroTileM <= Base::mM) && (macroTileN <= Base::mN) && (BlockK <= Base::mK);
         }
 
         bool checkQuirks() const final
@@ -154,10 +322,13 @@ namespace rocwmma
             // Don't run the kernel if the threadblock size is not supported
             auto kernelImplCheck = (kernelImpl() != nullptr);
 
+            // Configuration quirks are independent of launch bounds
+            using BaseConfig = CooperativeGemm::GetBaseConfig_t<GemmConfig>;
+
             // Cooperative workgroup kernels quirks
             auto wgQuirksCheck = true;
-            if(std::is_same<GemmConfig, CooperativeGemm::WorkgroupLevel::LdsNT>::value
-               || std::is_same<GemmConfig, CooperativeGemm::WorkgroupLevel::LdsTN>::value)
+            if(std::is_same<BaseConfig, CooperativeGemm::WorkgroupLevel::LdsNT>::value
+               || std::is_same<BaseConfig, CooperativeGemm::WorkgroupLevel::LdsTN>::value)
             {
                 // TODO: Fp64 fails validation for BlockK > 16 for 16 x 16.
                 wgQuirksCheck &= !(std::is_same<InputT, float64_t>::value && (BlockM == 16)
@@ -166,8 +337,8 @@ namespace rocwmma
 
             // Cooperative wave kernels quirks
             auto waveQuirksCheck = true;
-            if(std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsNT>::value
-               || std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsTN>::value)
+            if(std::is_same<BaseConfig, CooperativeGemm::WaveLevel::LdsNT>::value
+               || std::is_same<BaseConfig, CooperativeGemm::WaveLevel::LdsTN>::value)
             {
                 // TODO: On gfx90a, TN config with 4x4 blocks of 32 x 32 x 8
                 // Produces compile time issues
@@ -179,23 +350,172 @@ namespace rocwmma
                                      (BlocksX == BlocksY == 4)); // BlocksX = 4, BlocksY = 4
             }
 
-            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>()
-                   && kernelImplCheck && wgQuirksCheck && waveQuirksCheck;
+            return Base::checkQuirks() && dispatchEpilogueGuard() && kernelImplCheck
+                   && wgQuirksCheck && waveQuirksCheck;
         }
 
         // Lds memory usage in bytes
         uint32_t ldsUsage() const final
         {
-            // Uses 2 lds blocks for prefetch loop
-            return 2 * sizeof(InputT)
-                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
-                      + Base::mTBlockY * BlocksY * BlockN)
-                   * BlockK;
+            auto wavesX = Base::mTBlockX / Base::DeviceInfo::instance()->warpSize();
+
+            // Uses 2 lds blocks of A and B for prefetch loop.
+            // Weight-stationary kernels hold one B block per K step instead.
+            uint32_t ldsBlocksA = 2u;
+            uint32_t ldsBlocksB = CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                                      ? Base::mK / BlockK
+                                      : 2u;
+            uint32_t ldsFlags   = 0u;
+
+            // Producer / consumer kernels hold a ring of blocks, followed by the ring flags
+            if constexpr(CooperativeGemm::is_producer_consumer_v<GemmConfig>)
+            {
+                using RingBuffer = CooperativeGemm::RingBuffer<GemmConfig::RingSlots>;
+                ldsBlocksA       = GemmConfig::RingSlots;
+                ldsBlocksB       = GemmConfig::RingSlots;
+                ldsFlags         = sizeof(uint32_t) * RingBuffer::flagCount();
+            }
+
+            uint32_t prefetchUsage = sizeof(InputT)
+                                         * (ldsBlocksA * wavesX * BlocksX * BlockM
+                                            + ldsBlocksB * Base::mTBlockY * BlocksY * BlockN)
+                                         * BlockK
+                                     + ldsFlags;
+
+            // Staged epilogue re-uses the same lds with one D block per wave
+            if constexpr(CooperativeGemm::is_lds_epilogue_v<GemmConfig>)
+            {
+                uint32_t epilogueUsage
+                    = sizeof(OutputT) * wavesX * Base::mTBlockY * BlockM * BlockN;
+                return std::max(prefetchUsage, epilogueUsage);
+            }
+
+            return prefetchUsage;
         }
 
         typename Base::KernelFunc kernelImpl() const final
         {
-            return Base::template dispatchKernelFunc<TestKernelFunc>();
+            using CooperativeGemm::EpilogueMode;
+            using General = EpilogueDispatch<EpilogueMode::General>;
+
+            // Only configs opted into epilogue dispatch build the specialized kernels
+            if constexpr(CooperativeGemm::is_epilogue_dispatch_v<GemmConfig>)
+            {
+                using BetaZero   = EpilogueDispatch<EpilogueMode::BetaZero>;
+                using Accumulate = EpilogueDispatch<EpilogueMode::Accumulate>;
+
+                switch(epilogueMode())
+                {
+                case EpilogueMode::BetaZero:
+                    return Base::template dispatchKernelFunc<BetaZero::template TestKernelFunc>();
+                case EpilogueMode::Accumulate:
+                    return Base::template dispatchKernelFunc<
+                        Accumulate::template TestKernelFunc>();
+                default:;
+                }
+            }
+
+            return Base::template dispatchKernelFunc<General::template TestKernelFunc>();
+        }
+
+        void exec() final
+        {
+            // Reset the ABFT status counts, which accumulate over all runs
+            if constexpr(CooperativeGemm::is_abft_v<GemmConfig>)
+            {
+                uint32_t statusCounts[(uint32_t)CooperativeGemm::AbftStatus::Count] = {};
+                CHECK_HIP_ERROR(hipMemcpyToSymbol(HIP_SYMBOL(CooperativeGemm::abftStatusCounts),
+                                                  statusCounts,
+                                                  sizeof(statusCounts)));
+            }
+
+            // Runs OR into the keep mask, so clear it before setting the dropout params
+            if constexpr(CooperativeGemm::is_dropout_v<GemmConfig>)
+            {
+                if(Base::mRunFlag)
+                {
+                    auto params = dropoutParams();
+                    if constexpr(CooperativeGemm::dropout_mask_v<GemmConfig>)
+                    {
+                        auto maskSize = Base::mM * params.ldMask;
+                        Base::DataStorage::template reallocDevice<uint32_t>(mDropoutMask, maskSize);
+                        CHECK_HIP_ERROR(
+                            hipMemset(mDropoutMask.get(), 0, maskSize * sizeof(uint32_t)));
+                        params.mask = mDropoutMask.get();
+                    }
+                    CHECK_HIP_ERROR(hipMemcpyToSymbol(
+                        HIP_SYMBOL(CooperativeGemm::dropoutParams), &params, sizeof(params)));
+                }
+            }
+
+            Base::exec();
+        }
+
+        void validateResults() final
+        {
+            // Dropout is applied to the reference result on host,
+            // which also reproduces the exact keep mask.
+            std::vector<uint32_t> refMask;
+            if constexpr(CooperativeGemm::is_dropout_v<GemmConfig>)
+            {
+                if(Base::mRunFlag && (bool)ROCWMMA_VALIDATION_TESTS)
+                {
+                    auto& dataInstance = Base::DataStorage::instance();
+
+                    // CPU reference is in device C with LayoutD, rocBLAS in device D as col_major
+                    refMask = Base::mIsCpuRef
+                                  ? dropoutReference<LayoutD>(dataInstance->deviceC().get())
+                                  : dropoutReference<col_major>(dataInstance->deviceD().get());
+                }
+            }
+
+            Base::validateResults();
+
+            // Device mask must match the reference bit for bit
+            if constexpr(CooperativeGemm::dropout_mask_v<GemmConfig>)
+            {
+                if(!refMask.empty())
+                {
+                    auto deviceMask = std::vector<uint32_t>(refMask.size());
+                    CHECK_HIP_ERROR(hipMemcpy(deviceMask.data(),
+                                              mDropoutMask.get(),
+                                              deviceMask.size() * sizeof(uint32_t),
+                                              hipMemcpyDeviceToHost));
+
+                    auto mismatches = static_cast<uint32_t>(
+                        std::inner_product(deviceMask.begin(),
+                                           deviceMask.end(),
+                                           refMask.begin(),
+                                           0u,
+                                           std::plus<uint32_t>(),
+                                           std::not_equal_to<uint32_t>()));
+                    Base::mValidationResult &= (mismatches == 0u);
+                    EXPECT_EQ(mismatches, 0u) << "Dropout mask word mismatches: " << mismatches;
+                }
+            }
+
+            // Uncorrectable faults fail the run, even if D happens to validate
+            if constexpr(CooperativeGemm::is_abft_v<GemmConfig>)
+            {
+                if(Base::mRunFlag)
+                {
+                    uint32_t statusCounts[(uint32_t)CooperativeGemm::AbftStatus::Count];
+                    CHECK_HIP_ERROR(
+                        hipMemcpyFromSymbol(statusCounts,
+                                            HIP_SYMBOL(CooperativeGemm::abftStatusCounts),
+                                            sizeof(statusCounts)));
+
+                    auto uncorrectable
+                        = statusCounts[(uint32_t)CooperativeGemm::AbftStatus::Uncorrectable];
+                    Base::mValidationResult &= (uncorrectable == 0u);
+                    EXPECT_EQ(uncorrectable, 0u) << "ABFT uncorrectable lanes: " << uncorrectable;
+                }
+            }
+        }
+
+        bool isInPlace() const final
+        {
+            return CooperativeGemm::is_in_place_v<GemmConfig>;
         }
 
         std::ostream& printHeader(std::ostream& stream = std::cout) const final
@@ -205,10 +525,53 @@ namespace rocwmma
 
         std::ostream& printKernel(std::ostream& stream = std::cout) const final
         {
-            return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
-                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
-                                            << ", " << BlocksY << ", ");
+            using BaseConfig = CooperativeGemm::GetBaseConfig_t<GemmConfig>;
+
+            // Launch bounds and epilogue overrides are appended to the config name
+            stream << dataTypeToString<BaseConfig>();
+            constexpr bool isLaunchBoundsOverride
+                = ((uint32_t)GemmConfig::MaxThreadsPerBlock
+                   != (uint32_t)BaseConfig::MaxThreadsPerBlock)
+                  || ((uint32_t)GemmConfig::WavesPerEu != (uint32_t)BaseConfig::WavesPerEu);
+            if(isLaunchBoundsOverride)
+            {
+                stream << "_LB" << GemmConfig::MaxThreadsPerBlock << "_WPE"
+                       << GemmConfig::WavesPerEu;
+            }
+            if(CooperativeGemm::is_lds_epilogue_v<GemmConfig>)
+            {
+                stream << "_LdsEpi";
+            }
+            if(CooperativeGemm::is_in_place_v<GemmConfig>)
+            {
+                stream << "_InPlace";
+            }
+            if(CooperativeGemm::is_abft_v<GemmConfig>)
+            {
+                stream << "_Abft";
+            }
+            if(CooperativeGemm::is_dropout_v<GemmConfig>)
+            {
+                stream << "_Dropout"
+                       << (CooperativeGemm::dropout_mask_v<GemmConfig> ? "Mask" : "");
+            }
+            if(CooperativeGemm::split_count_v<GemmConfig> > 1u)
+            {
+                stream << "_Split" << CooperativeGemm::split_count_v<GemmConfig>;
+            }
+            if(CooperativeGemm::is_epilogue_dispatch_v<GemmConfig>)
+            {
+                constexpr const char* modeNames[] = {"General", "BetaZero", "Accumulate"};
+                stream << "_Epi" << modeNames[static_cast<uint32_t>(epilogueMode())];
+            }
+
+            return Base::printKernel(stream << ", " << dataTypeToString<LayoutLds>() << ", "
+                                            << BlocksX << ", " << BlocksY << ", ");
         }
+
+    private:
+        // Bit-packed dropout keep mask
+        typename Base::DataStorage::template DevicePtrT<uint32_t> mDropoutMask;
     };
 
 } // namespace rocwmma
@@ -67,19 +67,20 @@ namespace rocwmma
               uint32_t TBlockY = 0,
               uint32_t WaveSize,
               uint32_t ArchId>
-    __global__ void __launch_bounds__(256) gemm_PGR1_LB2_MP0_MB_CP(uint32_t       m,
-                                                                   uint32_t       n,
-                                                                   uint32_t       k,
-                                                                   InputT const*  a,
-                                                                   InputT const*  b,
-                                                                   OutputT const* c,
-                                                                   OutputT*       d,
-                                                                   uint32_t       lda,
-                                                                   uint32_t       ldb,
-                                                                   uint32_t       ldc,
-                                                                   uint32_t       ldd,
-                                                                   ComputeT       alpha,
-                                                                   ComputeT       beta)
+    __global__ void __ROCWMMA_GEMM_LAUNCH_BOUNDS__(GemmConfig)
+        gemm_PGR1_LB2_MP0_MB_CP(uint32_t       m,
+                                uint32_t       n,
+                                uint32_t       k,
+                                InputT const*  a,
+                                InputT const*  b,
+                                OutputT const* c,
+                                OutputT*       d,
+                                uint32_t       lda,
+                                uint32_t       ldb,
+                                uint32_t       ldc,
+                                uint32_t       ldd,
+                                ComputeT       alpha,
+                                ComputeT       beta)
     {
         if constexpr(gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
                                                    BlockN,
@@ -212,8 +213,29 @@ namespace rocwmma
             ///
             /// Initialize accumulation frags
             ///
-            typename GlobalMapping::MfmaBuffAcc fragsAcc;
-            GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+            typename GlobalMapping::MfmaBuffAccNative fragsAccNative;
+            GemmDriver::fill(fragsAccNative, static_cast<ComputeT>(0));
+
+            ///
+            /// Initialize ABFT row / col checksums of the acc blocks
+            ///
+            using Abft = CooperativeGemm::Abft<InputT, ComputeT, BlocksX, BlocksY>;
+
+            MfmaFragAcc abftRows[BlocksX];
+            MfmaFragAcc abftCols[BlocksY];
+            if constexpr(CooperativeGemm::is_abft_v<GemmConfig>)
+            {
+#pragma unroll
+                for(uint32_t i = 0u; i < BlocksX; i++)
+                {
+                    GemmDriver::fill(abftRows[i], static_cast<ComputeT>(0));
+                }
+#pragma unroll
+                for(uint32_t j = 0u; j < BlocksY; j++)
+                {
+                    GemmDriver::fill(abftCols[j], static_cast<ComputeT>(0));
+                }
+            }
 
             ///
             /// Synchronize waves and memory
@@ -241,10 +263,32 @@ namespace rocwmma
                 globalReadOffsetB += kStepOffsetB;
 
                 // accum(A * B)
-                GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
-
-                GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
-                GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
+                GemmDriver::placeRegisters(fragsAccNative, fragsA, fragsB);
+                if constexpr(CooperativeGemm::is_abft_v<GemmConfig>)
+                {
+                    Abft::mma(abftRows, abftCols, fragsA, fragsB);
+                }
+
+                if constexpr(CooperativeGemm::split_count_v<GemmConfig> > 1u)
+                {
+                    // Interleave chunks of the next local writes with the mfma
+                    GemmDriver::mfmaLocalWriteCoop(fragsAccNative,
+                                                   fragsA,
+                                                   fragsB,
+                                                   fragsAccNative,
+                                                   ldsPtrHi + ldsWriteOffsetA,
+                                                   grBuffA,
+                                                   ldsPtrHi + ldsWriteOffsetB,
+                                                   grBuffB,
+                                                   ldlds);
+                }
+                else
+                {
+                    GemmDriver::mfma(fragsAccNative, fragsA, fragsB, fragsAccNative);
+
+                    GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
+                    GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
+                }
 
                 // Make sure that all waves have finished reading / writing to lds.
                 GemmDriver::syncWorkgroup();
@@ -256,11 +300,17 @@ namespace rocwmma
             }
 
             ///
-            /// Start loading C
+            /// Start loading C, unless the epilogue doesn't need it.
+            /// C may alias D: the whole C tile is read before any D write
+            /// from this wave, and no other wave touches this tile.
             ///
+            constexpr auto epilogueMode = CooperativeGemm::epilogue_mode_v<GemmConfig>;
 
             typename GlobalMapping::MfmaBuffC fragsC;
-            GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+            if constexpr(epilogueMode != CooperativeGemm::EpilogueMode::BetaZero)
+            {
+                GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+            }
 
             ///
             /// Clean up tail A * B
@@ -271,14 +321,600 @@ namespace rocwmma
 
             GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
             GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
-            GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+            GemmDriver::placeRegisters(fragsAccNative, fragsA, fragsB);
+            GemmDriver::mfma(fragsAccNative, fragsA, fragsB, fragsAccNative);
+
+            // Leave the native accumulator format once, before the epilogue
+            typename GlobalMapping::MfmaBuffAcc fragsAcc;
+            GemmDriver::fromNative(fragsAcc, fragsAccNative);
+
+            ///
+            /// Verify the checksums, correcting single faulty elements
+            ///
+            if constexpr(CooperativeGemm::is_abft_v<GemmConfig>)
+            {
+                Abft::mma(abftRows, abftCols, fragsA, fragsB);
+                Abft::verify(fragsAcc, abftRows, abftCols, k);
+            }
 
             ///
             /// D = alpha * accum + beta * C
             ///
             typename GlobalMapping::MfmaBuffD fragsD;
-            GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
-            GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+            if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::BetaZero)
+            {
+                GemmDriver::uniformScale(fragsD, alpha, fragsAcc);
+            }
+            else if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::Accumulate)
+            {
+                GemmDriver::uniformAdd(fragsD, fragsAcc, fragsC);
+            }
+            else
+            {
+                GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+            }
+
+            ///
+            /// Dropout on D, keyed by the global coordinates of the elements
+            ///
+            if constexpr(CooperativeGemm::is_dropout_v<GemmConfig>)
+            {
+                CooperativeGemm::Dropout::template apply<
+                    CooperativeGemm::dropout_mask_v<GemmConfig>>(fragsD,
+                                                                 GlobalMapping::writeCoordD(),
+                                                                 GlobalMapping::blockOffsetA(),
+                                                                 GlobalMapping::blockOffsetB(),
+                                                                 n);
+            }
+
+            if constexpr(CooperativeGemm::is_lds_epilogue_v<GemmConfig>)
+            {
+                ///
+                /// Stage D through LDS, once all waves are done reading A / B.
+                /// Each wave gets a private BlockM x BlockN scratch tile.
+                ///
+                using WaveSpace = typename GlobalMapping::WaveSpace;
+
+                auto waveCoord = WaveSpace::localWaveCoord();
+                auto waveIndex = get<0>(waveCoord) * get<1>(WaveSpace::workgroupDim())
+                                 + get<1>(waveCoord);
+                auto* ldsPtrD
+                    = reinterpret_cast<OutputT*>(localMemPtr) + waveIndex * BlockM * BlockN;
+
+                GemmDriver::syncWorkgroup();
+                GemmDriver::globalWriteDStaged(d + globalWriteOffsetD, fragsD, ldd, ldsPtrD);
+            }
+            else
+            {
+                GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+            }
+        }
+    }
+
+    ///
+    /// Weight-stationary variant of the above:
+    ///
+    /// WS = Weight-stationary, B panel resident in LDS
+    ///
+    /// Each persistent workgroup loads its entire K x MacroTileY panel of B into
+    /// LDS once, with one B block per K step. It then walks its M tiles and
+    /// streams A through the resident panel in two double-buffered A blocks,
+    /// prefetching the next K step of A while the current one feeds the mfma.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __ROCWMMA_GEMM_LAUNCH_BOUNDS__(GemmConfig)
+        gemm_PGR1_LB2_MP0_MB_CP_WS(uint32_t       m,
+                                   uint32_t       n,
+                                   uint32_t       k,
+                                   InputT const*  a,
+                                   InputT const*  b,
+                                   OutputT const* c,
+                                   OutputT*       d,
+                                   uint32_t       lda,
+                                   uint32_t       ldb,
+                                   uint32_t       ldc,
+                                   uint32_t       ldd,
+                                   ComputeT       alpha,
+                                   ComputeT       beta)
+    {
+        if constexpr(gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
+                                                   BlockN,
+                                                   BlockK,
+                                                   InputT,
+                                                   OutputT,
+                                                   ComputeT,
+                                                   LayoutA,
+                                                   LayoutB,
+                                                   LayoutC,
+                                                   LayoutD,
+                                                   LayoutLds,
+                                                   GemmConfig,
+                                                   BlocksX,
+                                                   BlocksY,
+                                                   TBlockX,
+                                                   TBlockY,
+                                                   WaveSize,
+                                                   ArchId>::enableBuild())
+        {
+            ///
+            /// Assemble the gemm driver from the incoming gemm configuration
+            ///
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY>;
+
+            using LdsMapping = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+            using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+            using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+            using GemmDriver     = typename GemmConfig::
+                template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+            // Fragments for mfma
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using MfmaFragC = typename GlobalMapping::MfmaFragC;
+            using MfmaFragD = typename GlobalMapping::MfmaFragD;
+
+            // Mapping utils for each fragment type
+            using DataMappingA   = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB   = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC   = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD   = GetDataLayout_t<MfmaFragD>;
+            using DataMappingLds = typename LdsMapping::DataLayout;
+
+            // Bounds check on the whole B panel, so that the workgroup stays together
+            auto macroTileBound
+                = GlobalMapping::macroTileCoordC() + GlobalMapping::macroTileSizeC();
+            if((get<1>(macroTileBound) > n) || (BlockK > k))
+            {
+                return;
+            }
+
+            ///
+            /// Setup global addressing offsets in 1D for the first M tile
+            ///
+            auto globalReadOffsetA
+                = DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(), lda);
+            auto globalReadOffsetB
+                = DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(), ldb);
+            auto globalReadOffsetC
+                = DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(), ldc);
+            auto globalWriteOffsetD
+                = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), ldd);
+
+            auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
+            auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
+
+            // Offsets to the next M tile of this workgroup
+            auto mTileStepOffsetA
+                = DataMappingA::fromMatrixCoord(GlobalMapping::mTileStepA(), lda);
+            auto mTileStepOffsetC
+                = DataMappingC::fromMatrixCoord(GlobalMapping::mTileStepC(), ldc);
+            auto mTileStepOffsetD
+                = DataMappingD::fromMatrixCoord(GlobalMapping::mTileStepC(), ldd);
+
+            ///
+            /// Setup LDS addressing
+            /// The B panel holds one B block per K step and is written once.
+            /// A follows in two double-buffered blocks, written once per K step of each M tile.
+            ///
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            auto  sizeLdsA    = LdsMapping::sizeLdsA();
+            auto  sizeLdsB    = LdsMapping::sizeLdsB();
+            auto  blockElemsA = get<0>(sizeLdsA) * get<1>(sizeLdsA);
+            auto  blockElemsB = get<0>(sizeLdsB) * get<1>(sizeLdsB);
+            auto  kSteps      = k / BlockK;
+            auto* ldsPtrB     = reinterpret_cast<InputT*>(localMemPtr);
+            auto* ldsPtrA     = ldsPtrB + kSteps * blockElemsB;
+
+            auto ldldsA = LdsMapping::ldLdsA();
+            auto ldldsB = LdsMapping::ldLdsB();
+            auto ldsWriteOffsetA
+                = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldldsA);
+            auto ldsWriteOffsetB = DataMappingLds::fromMatrixCoord(
+                LdsMapping::writeCoordB() - LdsMapping::baseOffsetB(), ldldsB);
+            auto ldsReadOffsetA
+                = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldldsA);
+            auto ldsReadOffsetB = DataMappingLds::fromMatrixCoord(
+                LdsMapping::readCoordB() - LdsMapping::baseOffsetB(), ldldsB);
+
+            ///
+            /// Load the stationary B panel
+            ///
+            typename GlobalMapping::GRBuffB grBuffB;
+            for(uint32_t kStep = 0; kStep < kSteps; kStep++)
+            {
+                GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+                GemmDriver::localWriteCoopB(
+                    ldsPtrB + kStep * blockElemsB + ldsWriteOffsetB, grBuffB, ldldsB);
+                globalReadOffsetB += kStepOffsetB;
+            }
+
+            constexpr auto epilogueMode = CooperativeGemm::epilogue_mode_v<GemmConfig>;
+
+            ///
+            /// Walk the M tiles of this workgroup.
+            /// The loop condition is uniform across the workgroup.
+            ///
+            auto mTileStep = get<0>(GlobalMapping::mTileStepC());
+            for(auto mTile = get<0>(GlobalMapping::macroTileCoordC()); mTile < m;
+                mTile += mTileStep)
+            {
+                auto* ldsPtrLo = ldsPtrA;
+                auto* ldsPtrHi = ldsPtrA + blockElemsA;
+                auto* ldsPtrBk = ldsPtrB;
+
+                ///
+                /// Prefetch the first K step of A.
+                /// Sync first, as the previous tile may still be reading the same LDS block.
+                ///
+                typename GlobalMapping::GRBuffA grBuffA;
+                GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
+                GemmDriver::syncWorkgroup();
+                GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldldsA);
+
+                auto kReadOffsetA = globalReadOffsetA + kStepOffsetA;
+
+                ///
+                /// Initialize accumulation frags
+                ///
+                typename GlobalMapping::MfmaBuffAccNative fragsAccNative;
+                GemmDriver::fill(fragsAccNative, static_cast<ComputeT>(0));
+
+                GemmDriver::syncWorkgroup();
+
+                ///
+                /// Accumulate A * B
+                ///
+                for(auto currentK = BlockK; currentK < k; currentK += BlockK)
+                {
+                    typename GlobalMapping::MfmaBuffA fragsA;
+                    typename GlobalMapping::MfmaBuffB fragsB;
+
+                    // Local read mfma frags
+                    GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldldsA);
+                    GemmDriver::localReadB(fragsB, ldsPtrBk + ldsReadOffsetB, ldldsB);
+
+                    // Start fetching next round of A
+                    GemmDriver::globalReadCoopA(grBuffA, a + kReadOffsetA, lda);
+                    kReadOffsetA += kStepOffsetA;
+
+                    // accum(A * B)
+                    GemmDriver::placeRegisters(fragsAccNative, fragsA, fragsB);
+                    GemmDriver::mfma(fragsAccNative, fragsA, fragsB, fragsAccNative);
+
+                    GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldldsA);
+
+                    // Make sure that all waves have finished reading / writing to lds.
+                    GemmDriver::syncWorkgroup();
+
+                    // Swap A buffers, and move to the next K step of the B panel
+                    auto* tmp = ldsPtrLo;
+                    ldsPtrLo  = ldsPtrHi;
+                    ldsPtrHi  = tmp;
+                    ldsPtrBk += blockElemsB;
+                }
+
+                ///
+                /// Start loading C, unless the epilogue doesn't need it.
+                ///
+                typename GlobalMapping::MfmaBuffC fragsC;
+                if constexpr(epilogueMode != CooperativeGemm::EpilogueMode::BetaZero)
+                {
+                    GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+                }
+
+                ///
+                /// Clean up tail A * B
+                ///
+                typename GlobalMapping::MfmaBuffA fragsA;
+                typename GlobalMapping::MfmaBuffB fragsB;
+
+                GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldldsA);
+                GemmDriver::localReadB(fragsB, ldsPtrBk + ldsReadOffsetB, ldldsB);
+                GemmDriver::placeRegisters(fragsAccNative, fragsA, fragsB);
+                GemmDriver::mfma(fragsAccNative, fragsA, fragsB, fragsAccNative);
+
+                // Leave the native accumulator format once, before the epilogue
+                typename GlobalMapping::MfmaBuffAcc fragsAcc;
+                GemmDriver::fromNative(fragsAcc, fragsAccNative);
+
+                ///
+                /// D = alpha * accum + beta * C
+                ///
+                typename GlobalMapping::MfmaBuffD fragsD;
+                if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::BetaZero)
+                {
+                    GemmDriver::uniformScale(fragsD, alpha, fragsAcc);
+                }
+                else if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::Accumulate)
+                {
+                    GemmDriver::uniformAdd(fragsD, fragsAcc, fragsC);
+                }
+                else
+                {
+                    GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+                }
+
+                GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+
+                // Advance to the next M tile
+                globalReadOffsetA += mTileStepOffsetA;
+                globalReadOffsetC += mTileStepOffsetC;
+                globalWriteOffsetD += mTileStepOffsetD;
+            }
+        }
+    }
+
+    ///
+    /// Wave-specialized variant of the above:
+    ///
+    /// PC = Producer / consumer waves
+    ///
+    /// The workgroup is launched with blockDim.z = 2. Producer waves (z = 1) stream
+    /// A / B K steps from global into a ring of LDS blocks, while consumer waves
+    /// (z = 0) read them back and run the mfma. Each ring slot is handed over with
+    /// LDS counters (see RingBuffer), so neither role waits on a workgroup barrier
+    /// inside the K loop.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __ROCWMMA_GEMM_LAUNCH_BOUNDS__(GemmConfig)
+        gemm_PGR1_LB2_MP0_MB_CP_PC(uint32_t       m,
+                                   uint32_t       n,
+                                   uint32_t       k,
+                                   InputT const*  a,
+                                   InputT const*  b,
+                                   OutputT const* c,
+                                   OutputT*       d,
+                                   uint32_t       lda,
+                                   uint32_t       ldb,
+                                   uint32_t       ldc,
+                                   uint32_t       ldd,
+                                   ComputeT       alpha,
+                                   ComputeT       beta)
+    {
+        if constexpr(gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
+                                                   BlockN,
+                                                   BlockK,
+                                                   InputT,
+                                                   OutputT,
+                                                   ComputeT,
+                                                   LayoutA,
+                                                   LayoutB,
+                                                   LayoutC,
+                                                   LayoutD,
+                                                   LayoutLds,
+                                                   GemmConfig,
+                                                   BlocksX,
+                                                   BlocksY,
+                                                   TBlockX,
+                                                   TBlockY,
+                                                   WaveSize,
+                                                   ArchId>::enableBuild())
+        {
+            ///
+            /// Assemble the gemm driver from the incoming gemm configuration
+            ///
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY>;
+
+            using LdsMapping = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+            using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+            using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+            using GemmDriver     = typename GemmConfig::
+                template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+            // Fragments for mfma
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using MfmaFragC = typename GlobalMapping::MfmaFragC;
+            using MfmaFragD = typename GlobalMapping::MfmaFragD;
+
+            // Mapping utils for each fragment type
+            using DataMappingA   = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB   = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC   = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD   = GetDataLayout_t<MfmaFragD>;
+            using DataMappingLds = typename LdsMapping::DataLayout;
+
+            using RingBuffer = CooperativeGemm::RingBuffer<GemmConfig::RingSlots>;
+
+            ///
+            /// Roles are uniform per wave, and both slabs see the same wave coords.
+            ///
+            constexpr uint32_t ConsumerSlab = 0u;
+            constexpr uint32_t ProducerSlab = 1u;
+            auto               roleWaves    = CoopSchedulerA::waveCount();
+
+            ///
+            /// Bounds check on the whole macro tile, so that the workgroup stays together
+            ///
+            auto macroTileBound
+                = GlobalMapping::macroTileCoordC() + GlobalMapping::macroTileSizeC();
+            if((get<0>(macroTileBound) > m) || (get<1>(macroTileBound) > n) || (BlockK > k))
+            {
+                return;
+            }
+
+            ///
+            /// Setup LDS addressing
+            /// This kernel uses a ring of RingSlots LDS blocks, followed by the ring flags.
+            ///
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            auto  sizeLds    = LdsMapping::sizeLds();
+            auto  blockElems = get<0>(sizeLds) * get<1>(sizeLds);
+            auto* ldsPtrBase = reinterpret_cast<InputT*>(localMemPtr);
+            auto* ringFlags
+                = reinterpret_cast<uint32_t*>(ldsPtrBase + GemmConfig::RingSlots * blockElems);
+            auto kSteps = k / BlockK;
+
+            auto ldlds = LdsMapping::ldLds();
+
+            // The only workgroup barrier: flags are zero before either role starts
+            auto threadIndex = (threadIdx.z * blockDim.y + threadIdx.y) * blockDim.x + threadIdx.x;
+            RingBuffer::init(ringFlags, threadIndex);
+            GemmDriver::syncWorkgroup();
+
+            if(threadIdx.z == ProducerSlab)
+            {
+                ///
+                /// Producer: global -> LDS copies only
+                ///
+                auto globalReadOffsetA
+                    = DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(), lda);
+                auto globalReadOffsetB
+                    = DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(), ldb);
+
+                auto kStepOffsetA
+                    = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
+                auto kStepOffsetB
+                    = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
+
+                auto ldsWriteOffsetA
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
+                auto ldsWriteOffsetB
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
+
+                typename GlobalMapping::GRBuffA grBuffA;
+                typename GlobalMapping::GRBuffB grBuffB;
+
+                for(uint32_t step = 0; step < kSteps; step++)
+                {
+                    // Issue global reads before waiting on the slot
+                    GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
+                    GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+                    globalReadOffsetA += kStepOffsetA;
+                    globalReadOffsetB += kStepOffsetB;
+
+                    auto* ldsPtr = ldsPtrBase + RingBuffer::slot(step) * blockElems;
+
+                    RingBuffer::waitEmpty(ringFlags, step, roleWaves);
+                    GemmDriver::localWriteCoopA(ldsPtr + ldsWriteOffsetA, grBuffA, ldlds);
+                    GemmDriver::localWriteCoopB(ldsPtr + ldsWriteOffsetB, grBuffB, ldlds);
+                    RingBuffer::signalFull(ringFlags, step);
+                }
+            }
+            else if(threadIdx.z == ConsumerSlab)
+            {
+                ///
+                /// Consumer: LDS reads and mfma only
+                ///
+                auto globalReadOffsetC
+                    = DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(), ldc);
+                auto globalWriteOffsetD
+                    = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), ldd);
+
+                auto ldsReadOffsetA
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
+                auto ldsReadOffsetB
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
+
+                typename GlobalMapping::MfmaBuffAccNative fragsAccNative;
+                GemmDriver::fill(fragsAccNative, static_cast<ComputeT>(0));
+
+                for(uint32_t step = 0; step < kSteps; step++)
+                {
+                    typename GlobalMapping::MfmaBuffA fragsA;
+                    typename GlobalMapping::MfmaBuffB fragsB;
+
+                    auto* ldsPtr = ldsPtrBase + RingBuffer::slot(step) * blockElems;
+
+                    // Hand the slot back as soon as the frags are in registers
+                    RingBuffer::waitFull(ringFlags, step, roleWaves);
+                    GemmDriver::localReadA(fragsA, ldsPtr + ldsReadOffsetA, ldlds);
+                    GemmDriver::localReadB(fragsB, ldsPtr + ldsReadOffsetB, ldlds);
+                    RingBuffer::signalEmpty(ringFlags, step);
+
+                    // accum(A * B)
+                    GemmDriver::placeRegisters(fragsAccNative, fragsA, fragsB);
+                    GemmDriver::mfma(fragsAccNative, fragsA, fragsB, fragsAccNative);
+                }
+
+                // Leave the native accumulator format once, before the epilogue
+                typename GlobalMapping::MfmaBuffAcc fragsAcc;
+                GemmDriver::fromNative(fragsAcc, fragsAccNative);
+
+                ///
+                /// D = alpha * accum + beta * C
+                ///
+                constexpr auto epilogueMode = CooperativeGemm::epilogue_mode_v<GemmConfig>;
+
+                typename GlobalMapping::MfmaBuffC fragsC;
+                typename GlobalMapping::MfmaBuffD fragsD;
+                if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::BetaZero)
+                {
+                    GemmDriver::uniformScale(fragsD, alpha, fragsAcc);
+                }
+                else if constexpr(epilogueMode == CooperativeGemm::EpilogueMode::Accumulate)
+                {
+                    GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+                    GemmDriver::uniformAdd(fragsD, fragsAcc, fragsC);
+                }
+                else
+                {
+                    GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+                    GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+                }
+
+                GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+            }
         }
     }
 } // namespace rocwmma
@@ -60,7 +60,9 @@ namespace rocwmma
                                                                      TBlockX,
                                                                      TBlockY,
                                                                      WaveSize,
-                                                                     ArchId>
+                                                                     ArchId,
+                                                                     GemmConfig::MaxThreadsPerBlock,
+                                                                     GemmConfig::WavesPerEu>
     {
         using Base = GemmPredicatesBase<BlockM,
                                         BlockN,
@@ -73,11 +75,24 @@ namespace rocwmma
                                         TBlockX,
                                         TBlockY,
                                         WaveSize,
-                                        ArchId>;
+                                        ArchId,
+                                        GemmConfig::MaxThreadsPerBlock,
+                                        GemmConfig::WavesPerEu>;
 
         using TestTraits = typename Base::TestTraits;
 
     private:
+        // The tail holds both C and D tiles, unless the epilogue skips reading C
+        static constexpr uint32_t TailTilesCD = (CooperativeGemm::epilogue_mode_v<GemmConfig>
+                                                 == CooperativeGemm::EpilogueMode::BetaZero)
+                                                    ? 1u
+                                                    : 2u;
+
+        // ABFT checksums add BlocksX + BlocksY acc frags to the BlocksX * BlocksY of the C tile
+        static constexpr uint32_t AbftCostC
+            = ((uint32_t)TestTraits::Cost::TileC * (BlocksX * BlocksY + BlocksX + BlocksY))
+              / (BlocksX * BlocksY);
+
         enum struct Gfx9Predicates : bool
         {
             // Valid for gfx9 only
@@ -87,18 +102,52 @@ namespace rocwmma
             // for correctness.
             // Second part is that the ldsRF layout supports only one wave due to MaxVW considerations.
             // This unfortunately limits applicability in cooperative environment.
-            LdsRFTest = !(std::is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
+            LdsRFTest = !(std::is_same_v<CooperativeGemm::GetBaseConfig_t<GemmConfig>,
+                                         typename CooperativeGemm::BlockLevel::LdsRF>)
                         || (((TBlockX / WaveSize) * TBlockY) == 1),
 
+            // Register costs must fit the budget under the launch bounds
             CostABTest
             = ((2u * ((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB))
-               <= 256u),
-            CostAccTest  = ((uint32_t)TestTraits::Cost::TileC <= 256u),
+               <= (uint32_t)Base::LaunchParams::RegisterBudget),
+            CostAccTest
+            = ((uint32_t)TestTraits::Cost::TileC <= (uint32_t)Base::LaunchParams::RegisterBudget),
             CostTailTest = (((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB
-                             + 2u * (uint32_t)TestTraits::Cost::TileD)
-                            <= 256u),
+                             + TailTilesCD * (uint32_t)TestTraits::Cost::TileD)
+                            <= (uint32_t)Base::LaunchParams::RegisterBudget),
+
+            // In-place runs alias C and D, which must then share the same layout
+            InPlaceTest = !CooperativeGemm::is_in_place_v<GemmConfig>
+                          || std::is_same_v<LayoutC, LayoutD>,
+
+            // Weight-stationary kernels keep B resident in LDS, which the staged
+            // epilogue would overwrite
+            StationaryBTest = !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                              || !CooperativeGemm::is_lds_epilogue_v<GemmConfig>,
+
+            // Producer / consumer kernels launch twice the threads of the consumer block,
+            // and have no workgroup-wide barrier for the staged epilogue
+            ProducerConsumerTest = !CooperativeGemm::is_producer_consumer_v<GemmConfig>
+                                   || ((2u * TBlockX * TBlockY <= GemmConfig::MaxThreadsPerBlock)
+                                       && !CooperativeGemm::is_lds_epilogue_v<GemmConfig>),
+
+            // ABFT checksums need floating point inputs, are only accumulated by the
+            // cooperative kernel and hold BlocksX + BlocksY extra acc frags
+            AbftTest = !CooperativeGemm::is_abft_v<GemmConfig>
+                       || (!std::is_integral_v<InputT> && (sizeof(InputT) >= 2u)
+                           && !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                           && !CooperativeGemm::is_producer_consumer_v<GemmConfig>
+                           && (AbftCostC <= (uint32_t)Base::LaunchParams::RegisterBudget)),
 
-            Enable = (ArchTest && LdsRFTest && CostABTest && CostAccTest && CostTailTest)
+            // Dropout scales floating point D in the epilogue of the cooperative kernel
+            DropoutTest = !CooperativeGemm::is_dropout_v<GemmConfig>
+                          || (!std::is_integral_v<OutputT>
+                              && !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                              && !CooperativeGemm::is_producer_consumer_v<GemmConfig>),
+
+            Enable = (ArchTest && LdsRFTest && CostABTest && CostAccTest && CostTailTest
+                      && InPlaceTest && StationaryBTest && ProducerConsumerTest && AbftTest
+                      && DropoutTest)
         };
 
 #if !NDEBUG
@@ -110,6 +159,13 @@ namespace rocwmma
             std::cout << "CostABTest: " << (bool)Gfx9Predicates::CostABTest << std::endl;
             std::cout << "CostAccTest: " << (bool)Gfx9Predicates::CostAccTest << std::endl;
             std::cout << "CostTailTest: " << (bool)Gfx9Predicates::CostTailTest << std::endl;
+            std::cout << "InPlaceTest: " << (bool)Gfx9Predicates::InPlaceTest << std::endl;
+            std::cout << "StationaryBTest: " << (bool)Gfx9Predicates::StationaryBTest
+                      << std::endl;
+            std::cout << "ProducerConsumerTest: " << (bool)Gfx9Predicates::ProducerConsumerTest
+                      << std::endl;
+            std::cout << "AbftTest: " << (bool)Gfx9Predicates::AbftTest << std::endl;
+            std::cout << "DropoutTest: " << (bool)Gfx9Predicates::DropoutTest << std::endl;
             std::cout << "Enable: " << (bool)Gfx9Predicates::Enable << std::endl;
         }
 #endif // !NDEBUG
@@ -124,13 +180,44 @@ namespace rocwmma
             // Tail requires A, B, C & D tiles + FMA
             CostABTest
             = ((4u * ((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB))
-               <= 256u),
-            CostAccTest  = ((2u * (uint32_t)TestTraits::Cost::TileC) <= 256u),
+               <= (uint32_t)Base::LaunchParams::RegisterBudget),
+            CostAccTest = ((2u * (uint32_t)TestTraits::Cost::TileC)
+                           <= (uint32_t)Base::LaunchParams::RegisterBudget),
             CostTailTest = (((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB
-                             + 2u * (uint32_t)TestTraits::Cost::TileD)
-                            <= 256u),
+                             + TailTilesCD * (uint32_t)TestTraits::Cost::TileD)
+                            <= (uint32_t)Base::LaunchParams::RegisterBudget),
+
+            // In-place runs alias C and D, which must then share the same layout
+            InPlaceTest = !CooperativeGemm::is_in_place_v<GemmConfig>
+                          || std::is_same_v<LayoutC, LayoutD>,
+
+            // Weight-stationary kernels keep B resident in LDS, which the staged
+            // epilogue would overwrite
+            StationaryBTest = !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                              || !CooperativeGemm::is_lds_epilogue_v<GemmConfig>,
+
+            // Producer / consumer kernels launch twice the threads of the consumer block,
+            // and have no workgroup-wide barrier for the staged epilogue
+            ProducerConsumerTest = !CooperativeGemm::is_producer_consumer_v<GemmConfig>
+                                   || ((2u * TBlockX * TBlockY <= GemmConfig::MaxThreadsPerBlock)
+                                       && !CooperativeGemm::is_lds_epilogue_v<GemmConfig>),
+
+            // ABFT checksums need floating point inputs, are only accumulated by the
+            // cooperative kernel and hold BlocksX + BlocksY extra acc frags
+            AbftTest = !CooperativeGemm::is_abft_v<GemmConfig>
+                       || (!std::is_integral_v<InputT> && (sizeof(InputT) >= 2u)
+                           && !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                           && !CooperativeGemm::is_producer_consumer_v<GemmConfig>
+                           && ((2u * AbftCostC) <= (uint32_t)Base::LaunchParams::RegisterBudget)),
+
+            // Dropout scales floating point D in the epilogue of the cooperative kernel
+            DropoutTest = !CooperativeGemm::is_dropout_v<GemmConfig>
+                          || (!std::is_integral_v<OutputT>
+                              && !CooperativeGemm::is_weight_stationary_v<GemmConfig>
+                              && !CooperativeGemm::is_producer_consumer_v<GemmConfig>),
 
-            Enable = (ArchTest && CostABTest && CostAccTest && CostTailTest)
+            Enable = (ArchTest && CostABTest && CostAccTest && CostTailTest && InPlaceTest
+                      && StationaryBTest && ProducerConsumerTest && AbftTest && DropoutTest)
         };
 
 #if !NDEBUG
@@ -141,6 +228,13 @@ namespace rocwmma
             std::cout << "CostABTest: " << (bool)Gfx11Predicates::CostABTest << std::endl;
             std::cout << "CostAccTest: " << (bool)Gfx11Predicates::CostAccTest << std::endl;
             std::cout << "CostTailTest: " << (bool)Gfx11Predicates::CostTailTest << std::endl;
+            std::cout << "InPlaceTest: " << (bool)Gfx11Predicates::InPlaceTest << std::endl;
+            std::cout << "StationaryBTest: " << (bool)Gfx11Predicates::StationaryBTest
+                      << std::endl;
+            std::cout << "ProducerConsumerTest: " << (bool)Gfx11Predicates::ProducerConsumerTest
+                      << std::endl;
+            std::cout << "AbftTest: " << (bool)Gfx11Predicates::AbftTest << std::endl;
+            std::cout << "DropoutTest: " << (bool)Gfx11Predicates::DropoutTest << std::endl;
             std::cout << "Enable: " << (bool)Gfx11Predicates::Enable << std::endl;
         }
 #endif // !NDEBUG
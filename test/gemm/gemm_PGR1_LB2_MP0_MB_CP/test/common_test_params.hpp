@@ -39,6 +39,27 @@ namespace rocwmma
 
     namespace CooperativeGemm
     {
+        template <typename GemmConfig, uint32_t MaxThreads, uint32_t MinWavesPerEu>
+        struct WithLaunchBounds;
+
+        template <typename GemmConfig>
+        struct WithLdsEpilogue;
+
+        template <typename GemmConfig>
+        struct WithEpilogueDispatch;
+
+        template <typename GemmConfig>
+        struct WithInPlace;
+
+        template <typename GemmConfig, uint32_t Split>
+        struct WithSplitCount;
+
+        template <typename GemmConfig>
+        struct WithAbft;
+
+        template <typename GemmConfig, bool WriteMask>
+        struct WithDropout;
+
         namespace BlockLevel
         {
             class LdsNT;
@@ -61,6 +82,20 @@ namespace rocwmma
 
         } // namespace WaveLevel
 
+        namespace WeightStationary
+        {
+            class LdsNT;
+            class LdsTN;
+
+        } // namespace WeightStationary
+
+        namespace WaveSpecialized
+        {
+            class LdsNT;
+            class LdsTN;
+
+        } // namespace WaveSpecialized
+
     } // namespace CooperativeGemm
 
     ///
@@ -90,12 +125,217 @@ namespace rocwmma
             = std::tuple<std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
                          std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsTN>>;
 
+        ///
+        /// Launch bounds variants:
+        /// 512 and 1024 thread blocks, and 256 threads targeting 2 waves per EU
+        ///
+        template <typename GemmConfig, uint32_t MaxThreads, uint32_t WavesPerEu>
+        using LaunchBounds = CooperativeGemm::WithLaunchBounds<GemmConfig, MaxThreads, WavesPerEu>;
+
+        using TestGemmConfigsLaunchBounds = std::tuple<
+            std::tuple<LaunchBounds<CooperativeGemm::WorkgroupLevel::LdsNT, 512u, 1u>>,
+            std::tuple<LaunchBounds<CooperativeGemm::WorkgroupLevel::LdsNT, 1024u, 1u>>,
+            std::tuple<LaunchBounds<CooperativeGemm::WaveLevel::LdsNT, 256u, 2u>>>;
+
+        ///
+        /// Staged LDS epilogue variants, alongside direct store baselines
+        ///
+        template <typename GemmConfig>
+        using LdsEpilogue = CooperativeGemm::WithLdsEpilogue<GemmConfig>;
+
+        using TestGemmConfigsLdsEpilogue = std::tuple<
+            std::tuple<typename CooperativeGemm::WaveLevel::LdsNT>,
+            std::tuple<LdsEpilogue<CooperativeGemm::WaveLevel::LdsNT>>,
+            std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
+            std::tuple<LdsEpilogue<CooperativeGemm::WorkgroupLevel::LdsNT>>>;
+
+        // Wave level staging only, for several blocks per wave. Each wave re-uses
+        // its scratch tile for all of its blocks after a single workgroup sync.
+        using TestGemmConfigsLdsEpilogueWaveLevel
+            = std::tuple<std::tuple<LdsEpilogue<CooperativeGemm::WaveLevel::LdsNT>>,
+                         std::tuple<LdsEpilogue<CooperativeGemm::WaveLevel::LdsTN>>>;
+
+        ///
+        /// Host-dispatched epilogue variants, out of place and in place (C == D)
+        ///
+        template <typename GemmConfig>
+        using EpilogueDispatch = CooperativeGemm::WithEpilogueDispatch<GemmConfig>;
+
+        template <typename GemmConfig>
+        using InPlace = CooperativeGemm::WithInPlace<GemmConfig>;
+
+        using TestGemmConfigsEpilogueDispatch = std::tuple<
+            std::tuple<EpilogueDispatch<CooperativeGemm::WaveLevel::LdsNT>>,
+            std::tuple<InPlace<EpilogueDispatch<CooperativeGemm::WaveLevel::LdsNT>>>,
+            std::tuple<
+                InPlace<EpilogueDispatch<LdsEpilogue<CooperativeGemm::WorkgroupLevel::LdsNT>>>>>;
+
+        ///
+        /// Weight-stationary variants, alongside Block, Wave and Workgroup baselines
+        ///
+        using TestGemmConfigsWeightStationary
+            = std::tuple<std::tuple<typename CooperativeGemm::WeightStationary::LdsNT>,
+                         std::tuple<typename CooperativeGemm::WeightStationary::LdsTN>,
+                         std::tuple<typename CooperativeGemm::BlockLevel::LdsNT>,
+                         std::tuple<typename CooperativeGemm::WaveLevel::LdsNT>,
+                         std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>>;
+
+        // Weight-stationary only, for shapes the baselines don't support
+        using TestGemmConfigsWeightStationaryOnly
+            = std::tuple<std::tuple<typename CooperativeGemm::WeightStationary::LdsNT>,
+                         std::tuple<typename CooperativeGemm::WeightStationary::LdsTN>>;
+
+        ///
+        /// Producer / consumer variants, alongside the Workgroup baseline
+        ///
+        using TestGemmConfigsProducerConsumer
+            = std::tuple<std::tuple<typename CooperativeGemm::WaveSpecialized::LdsNT>,
+                         std::tuple<typename CooperativeGemm::WaveSpecialized::LdsTN>,
+                         std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>>;
+
+        ///
+        /// Split count sweep of the cooperative A / B IO, with the unsplit baselines
+        ///
+        template <typename GemmConfig, uint32_t Split>
+        using SplitCount = CooperativeGemm::WithSplitCount<GemmConfig, Split>;
+
+        using TestGemmConfigsSplitCount
+            = std::tuple<std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
+                         std::tuple<SplitCount<CooperativeGemm::WorkgroupLevel::LdsNT, 2u>>,
+                         std::tuple<SplitCount<CooperativeGemm::WorkgroupLevel::LdsNT, 4u>>,
+                         std::tuple<SplitCount<CooperativeGemm::WorkgroupLevel::LdsNT, 8u>>,
+                         std::tuple<typename CooperativeGemm::WaveLevel::LdsNT>,
+                         std::tuple<SplitCount<CooperativeGemm::WaveLevel::LdsNT, 2u>>,
+                         std::tuple<SplitCount<CooperativeGemm::WaveLevel::LdsNT, 4u>>>;
+
+        ///
+        /// ABFT checksum mode, with the unchecked baselines to measure the overhead
+        ///
+        template <typename GemmConfig>
+        using Abft = CooperativeGemm::WithAbft<GemmConfig>;
+
+        using TestGemmConfigsAbft
+            = std::tuple<std::tuple<typename CooperativeGemm::WaveLevel::LdsNT>,
+                         std::tuple<Abft<CooperativeGemm::WaveLevel::LdsNT>>,
+                         std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
+                         std::tuple<Abft<CooperativeGemm::WorkgroupLevel::LdsNT>>>;
+
+        // Checksums are only supported for floating point inputs of at least 16 bits
+        using TestTypesAbft = typename Concat<TestTypesBF16, TestTypesF16, TestTypesF32>::Result;
+
+        ///
+        /// Fused dropout on D, with and without the keep mask, alongside the baselines
+        ///
+        template <typename GemmConfig, bool WriteMask>
+        using Dropout = CooperativeGemm::WithDropout<GemmConfig, WriteMask>;
+
+        using TestGemmConfigsDropout
+            = std::tuple<std::tuple<typename CooperativeGemm::WaveLevel::LdsNT>,
+                         std::tuple<Dropout<CooperativeGemm::WaveLevel::LdsNT, false>>,
+                         std::tuple<Dropout<CooperativeGemm::WaveLevel::LdsNT, true>>,
+                         std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
+                         std::tuple<Dropout<CooperativeGemm::WorkgroupLevel::LdsNT, false>>,
+                         std::tuple<Dropout<CooperativeGemm::WorkgroupLevel::LdsNT, true>>>;
+
+        // Dropout scaling is only meaningful for floating point outputs
+        using TestTypesDropout
+            = typename Concat<TestTypesBF16, TestTypesF16, TestTypesF32>::Result;
+
+        // Epilogue variants cover every C / D layout
+        using TestLayoutsNTAllCD =
+            typename CombineOne<std::tuple<col_major, row_major>, TestDataLayouts>::Result;
+
         ///
         /// Kernel generator impl objects
         ///
         using KernelGeneratorImpl = KernelGenerator_PGR1_LB2_MP0_MB_CP;
     };
 
+    ///
+    /// Thread blocks of up to 16 waves for launch bounds variants
+    ///
+    struct LaunchBoundsTestParams : public CommonTestParams
+    {
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+
+            return
+            {
+                // clang-format off
+                {warpSize * 4, 1}, // 4 wave
+                {warpSize * 4, 2}, {warpSize * 2, 4}, // 8 wave
+                {warpSize * 4, 4}  // 16 wave
+                // clang-format on
+            };
+        }
+    };
+
+    ///
+    /// Alpha / beta values that select each of the epilogue modes:
+    /// BetaZero (beta == 0), Accumulate (alpha == beta == 1) and General
+    ///
+    struct EpilogueDispatchTestParams : public CommonTestParams
+    {
+        static inline std::vector<AlphaT> alphas()
+        {
+            return {static_cast<AlphaT>(1), static_cast<AlphaT>(2)};
+        }
+
+        static inline std::vector<BetaT> betas()
+        {
+            return {static_cast<BetaT>(0), static_cast<BetaT>(1), static_cast<BetaT>(2)};
+        }
+    };
+
+    ///
+    /// Tall-skinny inference shapes: large M, small N * K.
+    /// The B panel of the weight-stationary kernels must fit in LDS.
+    ///
+    struct WeightStationaryTestParams : public CommonTestParams
+    {
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return
+            {
+                // clang-format off
+                {2048, 64, 64},
+                {4096, 64, 128},
+                {4096, 128, 64},
+                {8192, 64, 256},
+                {4096, 256, 1024}, // Runs where the B panel fits in LDS
+#if !ROCWMMA_VALIDATION_TESTS
+                {16384, 64, 128},
+                {32768, 128, 128},
+                {65536, 64, 64},
+#endif // !ROCWMMA_VALIDATION_TESTS
+                // clang-format on
+            };
+        }
+    };
+
+    ///
+    /// Weight-stationary shapes with remainders. M, N or K not divisible by the
+    /// macro tile or BlockK must be rejected by checkSizes, and M tile counts that
+    /// don't divide across the persistent workgroups must still validate.
+    ///
+    struct WeightStationaryUnevenTestParams : public CommonTestParams
+    {
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return
+            {
+                // clang-format off
+                {2080, 64, 64},  // M remainder
+                {2048, 96, 64},  // N remainder
+                {2048, 64, 72},  // K remainder
+                {3968, 64, 64},  // Odd M tile count
+                {4000, 64, 136}, // M and K remainders
+                // clang-format on
+            };
+        }
+    };
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
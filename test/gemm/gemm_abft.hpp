@@ -0,0 +1,280 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GEMM_ABFT_HPP
+#define GEMM_ABFT_HPP
+
+#include <limits>
+#include <type_traits>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace CooperativeGemm
+    {
+        // Outcome of an ABFT check, ordered by severity
+        enum struct AbftStatus : uint32_t
+        {
+            Clean,
+            Corrected, // Single faulty element recovered from its checksums
+            ChecksumFault, // Faulty checksum, elements are intact
+            Uncorrectable,
+            Count
+        };
+
+        // Device-side count of checked lanes per AbftStatus, reset by the host before runs.
+        // Defined once in gemm_abft.cpp, shared by relocatable device code.
+        extern __device__ uint32_t abftStatusCounts[(uint32_t)AbftStatus::Count];
+
+        /* Abft class:
+        *  Algorithm-based fault tolerance for the BlocksX x BlocksY accumulator blocks of a
+        *  wave's C tile. Blocks share the same register layout, so checksums are taken
+        *  element-wise at each (lane, register) position e:
+        *  - Row checksums:    R[i](e) = sum_j Acc[i][j](e) = (A[i] * sum_j B[j])(e)
+        *  - Column checksums: C[j](e) = sum_i Acc[i][j](e) = (sum_i A[i] * B[j])(e)
+        *
+        *  Both are accumulated over the K loop with BlocksX + BlocksY extra mma per step, on
+        *  input fragments summed in registers. Before the epilogue, a single faulty element
+        *  Acc[i][j](e) mismatches exactly row checksum i and column checksum j, and is
+        *  recovered as R[i](e) - sum_{j' != j} Acc[i][j'](e). A single mismatch in one
+        *  direction only is a faulty checksum. Any other pattern is uncorrectable.
+        *
+        *  Summed inputs are rounded to InputT, so mismatches are relative to the magnitude
+        *  of the checksum terms. Checksum arithmetic is host-callable, so that fault
+        *  injection can be tested on host.
+        */
+        template <typename InputT, typename ComputeT, uint32_t BlocksX, uint32_t BlocksY>
+        struct Abft
+        {
+            static_assert(!std::is_integral_v<InputT> && (sizeof(InputT) >= 2u),
+                          "Input checksums must not overflow: ABFT requires floating point "
+                          "inputs of at least 16 bits");
+
+            // Relative mismatch threshold: rounding of the summed inputs, and the
+            // differently ordered accumulation of k products.
+            ROCWMMA_HOST_DEVICE static inline ComputeT tolerance(uint32_t k)
+            {
+                constexpr auto MaxBlocks = (BlocksX > BlocksY ? BlocksX : BlocksY);
+                auto epsIn  = static_cast<float>(std::numeric_limits<InputT>::epsilon());
+                auto epsAcc = static_cast<float>(std::numeric_limits<ComputeT>::epsilon());
+
+                return static_cast<ComputeT>(static_cast<float>(MaxBlocks) * epsIn
+                                             + static_cast<float>(k) * epsAcc);
+            }
+
+            ROCWMMA_HOST_DEVICE static inline ComputeT abs(ComputeT value)
+            {
+                return value < static_cast<ComputeT>(0) ? -value : value;
+            }
+
+            // NaN / Inf differences are mismatches
+            ROCWMMA_HOST_DEVICE static inline bool
+                isMismatch(ComputeT checksum, ComputeT sum, ComputeT scale, ComputeT tol)
+            {
+                return !(abs(checksum - sum) <= tol * scale);
+            }
+
+            // Checks the elements of all blocks at one (lane, register) position against the
+            // row and column checksums at the same position. Corrects a single faulty
+            // element in place.
+            ROCWMMA_HOST_DEVICE static inline AbftStatus
+                check(ComputeT (&acc)[BlocksX][BlocksY],
+                      ComputeT const (&rowSums)[BlocksX],
+                      ComputeT const (&colSums)[BlocksY],
+                      ComputeT tol)
+            {
+                uint32_t badRows = 0u;
+                uint32_t badCols = 0u;
+                uint32_t badRow  = 0u;
+                uint32_t badCol  = 0u;
+
+                for(uint32_t i = 0u; i < BlocksX; i++)
+                {
+                    auto sum   = static_cast<ComputeT>(0);
+                    auto scale = abs(rowSums[i]);
+                    for(uint32_t j = 0u; j < BlocksY; j++)
+                    {
+                        sum += acc[i][j];
+                        scale += abs(acc[i][j]);
+                    }
+
+                    if(isMismatch(rowSums[i], sum, scale, tol))
+                    {
+                        badRows++;
+                        badRow = i;
+                    }
+                }
+
+                for(uint32_t j = 0u; j < BlocksY; j++)
+                {
+                    auto sum   = static_cast<ComputeT>(0);
+                    auto scale = abs(colSums[j]);
+                    for(uint32_t i = 0u; i < BlocksX; i++)
+                    {
+                        sum += acc[i][j];
+                        scale += abs(acc[i][j]);
+                    }
+
+                    if(isMismatch(colSums[j], sum, scale, tol))
+                    {
+                        badCols++;
+                        badCol = j;
+                    }
+                }
+
+                if(badRows == 0u && badCols == 0u)
+                {
+                    return AbftStatus::Clean;
+                }
+                else if(badRows == 1u && badCols == 1u)
+                {
+                    // Recover the faulty element from its row checksum
+                    auto value = rowSums[badRow];
+                    for(uint32_t j = 0u; j < BlocksY; j++)
+                    {
+                        value -= (j == badCol ? static_cast<ComputeT>(0) : acc[badRow][j]);
+                    }
+                    acc[badRow][badCol] = value;
+                    return AbftStatus::Corrected;
+                }
+                else if(badRows + badCols == 1u)
+                {
+                    return AbftStatus::ChecksumFault;
+                }
+
+                return AbftStatus::Uncorrectable;
+            }
+
+            // Element-wise sum of input fragments, rounded once to InputT
+            template <typename FragT, uint32_t Blocks>
+            __device__ static inline FragT sum(FragT const (&frags)[Blocks])
+            {
+                FragT result;
+#pragma unroll
+                for(uint32_t e = 0u; e < FragT::num_elements; e++)
+                {
+                    auto value = 0.0f;
+#pragma unroll
+                    for(uint32_t b = 0u; b < Blocks; b++)
+                    {
+                        value += static_cast<float>(frags[b][e]);
+                    }
+                    result[e] = static_cast<InputT>(value);
+                }
+                return result;
+            }
+
+            // Accumulates the checksums of one K step:
+            // R[i] += A[i] * sum_j B[j], C[j] += sum_i A[i] * B[j]
+            template <typename FragA, typename FragB, typename FragAcc>
+            __device__ static inline void mma(FragAcc (&rowSums)[BlocksX],
+                                              FragAcc (&colSums)[BlocksY],
+                                              FragA const (&fragsA)[BlocksX],
+                                              FragB const (&fragsB)[BlocksY])
+            {
+                auto sumA = sum(fragsA);
+                auto sumB = sum(fragsB);
+
+#pragma unroll
+                for(uint32_t i = 0u; i < BlocksX; i++)
+                {
+                    mma_sync(rowSums[i], fragsA[i], sumB, rowSums[i]);
+                }
+
+#pragma unroll
+                for(uint32_t j = 0u; j < BlocksY; j++)
+                {
+                    mma_sync(colSums[j], sumA, fragsB[j], colSums[j]);
+                }
+            }
+
+            // Verifies each register position of the accumulator blocks, corrects single
+            // faulty elements in place and counts the worst status of the lane.
+            template <typename FragAcc>
+            __device__ static inline void verify(FragAcc (&fragsAcc)[BlocksX][BlocksY],
+                                                 FragAcc const (&rowSums)[BlocksX],
+                                                 FragAcc const (&colSums)[BlocksY],
+                                                 uint32_t      k)
+            {
+                auto tol    = tolerance(k);
+                auto status = AbftStatus::Clean;
+
+#pragma unroll
+                for(uint32_t e = 0u; e < FragAcc::num_elements; e++)
+                {
+                    ComputeT acc[BlocksX][BlocksY];
+                    ComputeT rows[BlocksX];
+                    ComputeT cols[BlocksY];
+
+#pragma unroll
+                    for(uint32_t i = 0u; i < BlocksX; i++)
+                    {
+                        rows[i] = rowSums[i][e];
+#pragma unroll
+                        for(uint32_t j = 0u; j < BlocksY; j++)
+                        {
+                            acc[i][j] = fragsAcc[i][j][e];
+                        }
+                    }
+
+#pragma unroll
+                    for(uint32_t j = 0u; j < BlocksY; j++)
+                    {
+                        cols[j] = colSums[j][e];
+                    }
+
+                    auto result = check(acc, rows, cols, tol);
+                    if(result == AbftStatus::Corrected)
+                    {
+#pragma unroll
+                        for(uint32_t i = 0u; i < BlocksX; i++)
+                        {
+#pragma unroll
+                            for(uint32_t j = 0u; j < BlocksY; j++)
+                            {
+                                fragsAcc[i][j][e] = acc[i][j];
+                            }
+                        }
+                    }
+
+                    status = (uint32_t)result > (uint32_t)status ? result : status;
+                }
+
+                if(status != AbftStatus::Clean)
+                {
+                    atomicAdd(&abftStatusCounts[(uint32_t)status], 1u);
+                }
+            }
+        };
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#endif // GEMM_ABFT_HPP
@@ -33,17 +33,346 @@
 #include <rocwmma/rocwmma_transforms.hpp>
 #pragma GCC diagnostic pop
 
+#include "gemm_abft.hpp"
 #include "gemm_coop_schedule.hpp"
+#include "gemm_dropout.hpp"
 #include "gemm_driver.hpp"
 #include "gemm_global_mapping.hpp"
 #include "gemm_local_mapping.hpp"
+#include "gemm_ring_buffer.hpp"
 
-#define __ROCWMMA_GEMM_LAUNCH_BOUNDS__ __launch_bounds__(Constants::AMDGCN_WAVE_SIZE * 4u)
+// Kernel launch bounds taken from the gemm configuration:
+// max threads per block and min waves per EU (occupancy target)
+#define __ROCWMMA_GEMM_LAUNCH_BOUNDS__(GemmConfig) \
+    __launch_bounds__(GemmConfig::MaxThreadsPerBlock, GemmConfig::WavesPerEu)
 
 namespace rocwmma
 {
     namespace CooperativeGemm
     {
+        /* Launch bounds:
+        *  Compile-time kernel launch parameters of a GEMM configuration.
+        *  - MaxThreadsPerBlock: largest thread block (TBlockX * TBlockY) that
+        *    the kernel is built for.
+        *  - WavesPerEu: minimum waves per execution unit that the compiler must
+        *    allow for, which caps register usage. 1 leaves occupancy to the compiler.
+        *
+        *  All configurations default to 256 threads with no occupancy target.
+        */
+        template <uint32_t MaxThreads = 256u, uint32_t MinWavesPerEu = 1u>
+        struct LaunchBounds
+        {
+            enum : uint32_t
+            {
+                MaxThreadsPerBlock = MaxThreads,
+                WavesPerEu         = MinWavesPerEu
+            };
+        };
+
+        /* Overrides the launch bounds of a GEMM configuration, e.g.:
+        *  WithLaunchBounds<WorkgroupLevel::LdsNT, 1024u> or
+        *  WithLaunchBounds<BlockLevel::LdsNT, 256u, 2u>
+        */
+        template <typename GemmConfig, uint32_t MaxThreads, uint32_t MinWavesPerEu = 1u>
+        struct WithLaunchBounds : public GemmConfig
+        {
+            enum : uint32_t
+            {
+                MaxThreadsPerBlock = MaxThreads,
+                WavesPerEu         = MinWavesPerEu
+            };
+        };
+
+        /* Stages the D epilogue through LDS, e.g.:
+        *  WithLdsEpilogue<WaveLevel::LdsNT>
+        *
+        *  After the K loop, each wave round-trips its D blocks through a private
+        *  LDS scratch tile and re-reads them with wide vectors along LayoutD,
+        *  so that global writes are coalesced regardless of the accumulator layout.
+        */
+        struct LdsEpilogue
+        {
+        };
+
+        template <typename GemmConfig>
+        struct WithLdsEpilogue : public GemmConfig, public LdsEpilogue
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_lds_epilogue_v = std::is_base_of_v<LdsEpilogue, GemmConfig>;
+
+        /* Epilogue specializations of D = alpha * accum + beta * C:
+        *  - General: full FMA, reads C
+        *  - BetaZero: D = alpha * accum, C is never read
+        *  - Accumulate: D = accum + C, for alpha == 1 and beta == 1
+        *
+        *  The kernel's mode is fixed at compile time with WithEpilogueMode, and
+        *  the host selects one from the runtime alpha / beta values.
+        */
+        enum struct EpilogueMode : uint32_t
+        {
+            General,
+            BetaZero,
+            Accumulate
+        };
+
+        template <typename GemmConfig, EpilogueMode Mode>
+        struct WithEpilogueMode : public GemmConfig
+        {
+            static constexpr EpilogueMode Epilogue = Mode;
+        };
+
+        template <typename GemmConfig, typename Enabler = void>
+        struct GetEpilogueMode : public std::integral_constant<EpilogueMode, EpilogueMode::General>
+        {
+        };
+
+        template <typename GemmConfig>
+        struct GetEpilogueMode<GemmConfig, std::void_t<decltype(GemmConfig::Epilogue)>>
+            : public std::integral_constant<EpilogueMode, GemmConfig::Epilogue>
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr EpilogueMode epilogue_mode_v = GetEpilogueMode<GemmConfig>::value;
+
+        /* Opts a GEMM configuration into host-side epilogue dispatch, e.g.:
+        *  WithEpilogueDispatch<WaveLevel::LdsNT>
+        *
+        *  Builds every EpilogueMode, so it is opt-in to bound build times.
+        *  Configurations without it always run the General epilogue.
+        */
+        struct EpilogueDispatch
+        {
+        };
+
+        template <typename GemmConfig>
+        struct WithEpilogueDispatch : public GemmConfig, public EpilogueDispatch
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_epilogue_dispatch_v = std::is_base_of_v<EpilogueDispatch, GemmConfig>;
+
+        // Host-side selection of the cheapest epilogue that is exact for alpha / beta
+        template <typename ComputeT>
+        inline EpilogueMode selectEpilogueMode(ComputeT alpha, ComputeT beta)
+        {
+            auto alphaF = static_cast<float>(alpha);
+            auto betaF  = static_cast<float>(beta);
+
+            if(betaF == 0.0f)
+            {
+                return EpilogueMode::BetaZero;
+            }
+            else if(alphaF == 1.0f && betaF == 1.0f)
+            {
+                return EpilogueMode::Accumulate;
+            }
+            return EpilogueMode::General;
+        }
+
+        /* Runs the GEMM in place, with D aliasing C, e.g.:
+        *  WithInPlace<WaveLevel::LdsNT>
+        *
+        *  Each wave reads its C tile in full before writing the same D tile and
+        *  tiles are disjoint across waves, so the aliasing is safe as long as
+        *  C and D share the same layout and leading dimension.
+        */
+        struct InPlace
+        {
+        };
+
+        template <typename GemmConfig>
+        struct WithInPlace : public GemmConfig, public InPlace
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_in_place_v = std::is_base_of_v<InPlace, GemmConfig>;
+
+        /* Splits the cooperative A / B IO of each wave into SplitCount chunks, e.g.:
+        *  WithSplitCount<WorkgroupLevel::LdsNT, 4u>
+        *
+        *  In the K loop, the local writes of the next A / B step are issued one chunk
+        *  at a time, interleaved with 1 / SplitCount of the mfma blocks of the current
+        *  step, so that partial LDS writes overlap with compute. The IO is not split
+        *  where SplitCount doesn't evenly divide a wave's share.
+        */
+        template <typename GemmConfig, uint32_t Split>
+        struct WithSplitCount : public GemmConfig
+        {
+            enum : uint32_t
+            {
+                SplitCount = Split
+            };
+
+            template <typename GlobalMapping,
+                      typename LdsMapping,
+                      typename CoopSchedulerA,
+                      typename CoopSchedulerB>
+            using GemmDriver = CooperativeGemm::
+                GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB, Split>;
+        };
+
+        template <typename GemmConfig, typename Enabler = void>
+        struct GetSplitCount : public std::integral_constant<uint32_t, 1u>
+        {
+        };
+
+        template <typename GemmConfig>
+        struct GetSplitCount<GemmConfig, std::void_t<decltype(GemmConfig::SplitCount)>>
+            : public std::integral_constant<uint32_t, GemmConfig::SplitCount>
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr uint32_t split_count_v = GetSplitCount<GemmConfig>::value;
+
+        /* Adds algorithm-based fault tolerance to the accumulation, e.g.:
+        *  WithAbft<WaveLevel::LdsNT>
+        *
+        *  Each wave accumulates row and column checksums of its C tile blocks
+        *  alongside the mfma and verifies them before the epilogue. Single
+        *  faulty elements are corrected and every detected fault is counted.
+        *  See Abft in gemm_abft.hpp.
+        */
+        struct AbftChecksums
+        {
+        };
+
+        template <typename GemmConfig>
+        struct WithAbft : public GemmConfig, public AbftChecksums
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_abft_v = std::is_base_of_v<AbftChecksums, GemmConfig>;
+
+        /* Fuses training dropout into the D epilogue, e.g.:
+        *  WithDropout<WaveLevel::LdsNT, true>
+        *
+        *  Each D element draws a Philox random number keyed by the seed, offset and
+        *  its global coordinate, is dropped or scaled by 1 / (1 - p), and with
+        *  WriteMask sets its bit in a bit-packed keep mask. Parameters are set by
+        *  the host in dropoutParams. See Dropout in gemm_dropout.hpp.
+        */
+        struct DropoutEpilogue
+        {
+        };
+
+        template <typename GemmConfig, bool WriteMask>
+        struct WithDropout : public GemmConfig, public DropoutEpilogue
+        {
+            static constexpr bool DropoutMask = WriteMask;
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_dropout_v = std::is_base_of_v<DropoutEpilogue, GemmConfig>;
+
+        template <typename GemmConfig, typename Enabler = void>
+        struct GetDropoutMask : public std::false_type
+        {
+        };
+
+        template <typename GemmConfig>
+        struct GetDropoutMask<GemmConfig, std::void_t<decltype(GemmConfig::DropoutMask)>>
+            : public std::integral_constant<bool, GemmConfig::DropoutMask>
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool dropout_mask_v = GetDropoutMask<GemmConfig>::value;
+
+        /* Weight-stationary GEMMs keep the whole B panel of a workgroup resident in LDS
+        *  and stream persistent M tiles of A through it. The kernel grid is sized
+        *  on the host so that each workgroup visits several M tiles.
+        *  See the WeightStationary configurations below.
+        */
+        struct StationaryB
+        {
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_weight_stationary_v = std::is_base_of_v<StationaryB, GemmConfig>;
+
+        /* Producer / consumer GEMMs specialize waves by role. The workgroup is launched
+        *  with two slabs of waves in z: consumer waves (z = 0) only read LDS and run the
+        *  mfma on their C tiles, while producer waves (z = 1) only copy A / B from global
+        *  into a ring of RingSlots LDS blocks. Roles synchronize per slot through
+        *  RingBuffer counters in LDS rather than workgroup barriers.
+        *  See the WaveSpecialized configurations below.
+        */
+        struct ProducerConsumer
+        {
+            enum : uint32_t
+            {
+                RingSlots = 3u
+            };
+        };
+
+        template <typename GemmConfig>
+        constexpr bool is_producer_consumer_v = std::is_base_of_v<ProducerConsumer, GemmConfig>;
+
+        // Configuration without launch bounds or epilogue overrides
+        template <typename GemmConfig>
+        struct GetBaseConfig
+        {
+            using type = GemmConfig;
+        };
+
+        template <typename GemmConfig, uint32_t MaxThreads, uint32_t MinWavesPerEu>
+        struct GetBaseConfig<WithLaunchBounds<GemmConfig, MaxThreads, MinWavesPerEu>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig>
+        struct GetBaseConfig<WithLdsEpilogue<GemmConfig>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig, EpilogueMode Mode>
+        struct GetBaseConfig<WithEpilogueMode<GemmConfig, Mode>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig>
+        struct GetBaseConfig<WithEpilogueDispatch<GemmConfig>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig>
+        struct GetBaseConfig<WithInPlace<GemmConfig>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig, uint32_t Split>
+        struct GetBaseConfig<WithSplitCount<GemmConfig, Split>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig>
+        struct GetBaseConfig<WithAbft<GemmConfig>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig, bool WriteMask>
+        struct GetBaseConfig<WithDropout<GemmConfig, WriteMask>>
+        {
+            using type = typename GetBaseConfig<GemmConfig>::type;
+        };
+
+        template <typename GemmConfig>
+        using GetBaseConfig_t = typename GetBaseConfig<GemmConfig>::type;
+
         namespace BlockLevel
         {
             /* Block-Level cooperative GEMMs:
@@ -61,7 +390,7 @@ namespace rocwmma
             *
             *  Due to collaboration, data is not MFMA friendly until written to LDS.
             */
-            struct LdsNT
+            struct LdsNT : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -109,7 +438,7 @@ namespace rocwmma
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
             };
 
-            struct LdsTN
+            struct LdsTN : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -157,7 +486,7 @@ namespace rocwmma
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
             };
 
-            struct LdsRF
+            struct LdsRF : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -220,7 +549,7 @@ namespace rocwmma
             *
             *  Due to collaboration, data is not MFMA friendly until written to LDS.
             */
-            struct LdsNT
+            struct LdsNT : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -268,7 +597,7 @@ namespace rocwmma
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
             };
 
-            struct LdsTN
+            struct LdsTN : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -332,7 +661,7 @@ namespace rocwmma
             *  Due to collaboration, data is not MFMA friendly until written to LDS.
             */
 
-            struct LdsNT
+            struct LdsNT : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -380,7 +709,7 @@ namespace rocwmma
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
             };
 
-            struct LdsTN
+            struct LdsTN : public LaunchBounds<>
             {
                 template <uint32_t BlockM,
                           uint32_t BlockN,
@@ -430,6 +759,234 @@ namespace rocwmma
 
         } // namespace WorkgroupLevel
 
+        namespace WeightStationary
+        {
+            /* Weight-stationary cooperative GEMMs:
+            *  Workgroup-level collaboration on A / B macro tiles, with persistent
+            *  workgroups. Each workgroup loads its K x MacroTileY panel of B into LDS
+            *  once, then walks M tiles at a stride of gridDim.x, streaming only A.
+            *  This favours tall-skinny problems (large M, small N * K), where every
+            *  workgroup would otherwise re-fetch the same B panel from L2.
+            *
+            *  LDS holds one BlockK slice of B per K step, plus two double-buffered
+            *  BlockK slices of A. These configurations only run when K is small enough
+            *  for the whole B panel to fit.
+            *
+            *  Class name LDSXY indicates whether X = matrix_a or Y = matrix_b is
+            *  transposed (T) or non-transposed (N) upon writing to LDS memory.
+            */
+
+            struct LdsNT : public LaunchBounds<>, public StationaryB
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX,
+                          uint32_t TBlockY>
+                using GlobalMapping = GlobalMapping::WeightStationaryMapping<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             BlocksX,
+                                                                             BlocksY,
+                                                                             TBlockX,
+                                                                             TBlockY>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerA = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerB = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+            struct LdsTN : public LaunchBounds<>, public StationaryB
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX,
+                          uint32_t TBlockY>
+                using GlobalMapping = GlobalMapping::WeightStationaryMapping<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             BlocksX,
+                                                                             BlocksY,
+                                                                             TBlockX,
+                                                                             TBlockY>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerA = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerB = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+        } // namespace WeightStationary
+
+        namespace WaveSpecialized
+        {
+            /* Wave-specialized cooperative GEMMs:
+            *  Workgroup-level collaboration on A / B macro tiles, split by role.
+            *  Producer waves mirror the (TBlockX, TBlockY) consumer waves in a second
+            *  z slab, and cooperatively stream A / B into a ring of LDS blocks.
+            *  Consumer waves compute the same C tiles as the Workgroup level GEMMs,
+            *  without taking part in global reads or workgroup barriers.
+            *
+            *  The launch bounds cover both slabs: up to 256 consumer threads.
+            *
+            *  Class name LDSXY indicates whether X = matrix_a or Y = matrix_b is
+            *  transposed (T) or non-transposed (N) upon writing to LDS memory.
+            */
+
+            struct LdsNT : public LaunchBounds<512u>, public ProducerConsumer
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX,
+                          uint32_t TBlockY>
+                using GlobalMapping = GlobalMapping::WorkgroupLevelMapping<BlockM,
+                                                                           BlockN,
+                                                                           BlockK,
+                                                                           InputT,
+                                                                           OutputT,
+                                                                           ComputeT,
+                                                                           LayoutA,
+                                                                           LayoutB,
+                                                                           LayoutC,
+                                                                           LayoutD,
+                                                                           BlocksX,
+                                                                           BlocksY,
+                                                                           TBlockX,
+                                                                           TBlockY>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerA = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerB = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+            struct LdsTN : public LaunchBounds<512u>, public ProducerConsumer
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX,
+                          uint32_t TBlockY>
+                using GlobalMapping = GlobalMapping::WorkgroupLevelMapping<BlockM,
+                                                                           BlockN,
+                                                                           BlockK,
+                                                                           InputT,
+                                                                           OutputT,
+                                                                           ComputeT,
+                                                                           LayoutA,
+                                                                           LayoutB,
+                                                                           LayoutC,
+                                                                           LayoutD,
+                                                                           BlocksX,
+                                                                           BlocksY,
+                                                                           TBlockX,
+                                                                           TBlockY>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerA = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerB = typename Schedule::AllRowMajor<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+        } // namespace WaveSpecialized
+
     } // namespace CooperativeGemm
 
     template <>
@@ -474,6 +1031,30 @@ namespace rocwmma
         return "Workgroup_LdsTN";
     }
 
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::WeightStationary::LdsNT>()
+    {
+        return "WeightStationary_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::WeightStationary::LdsTN>()
+    {
+        return "WeightStationary_LdsTN";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::WaveSpecialized::LdsNT>()
+    {
+        return "WaveSpecialized_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::WaveSpecialized::LdsTN>()
+    {
+        return "WaveSpecialized_LdsTN";
+    }
+
 } // namespace rocwmma
 
 #endif // GEMM_CONFIG_HPP
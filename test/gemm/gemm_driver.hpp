@@ -41,7 +41,8 @@ namespace rocwmma
         template <typename GlobalMapping,
                   typename LdsMapping,
                   typename CoopSchedulerA,
-                  typename CoopSchedulerB>
+                  typename CoopSchedulerB,
+                  uint32_t SplitCount = 1u>
         struct GemmDriver
         {
             // Global fragment types
@@ -55,6 +56,14 @@ namespace rocwmma
             using MfmaFragD   = typename GlobalMapping::MfmaFragD;
             using MfmaFragAcc = typename GlobalMapping::MfmaFragAcc;
 
+            // Mfma fragment types in the native format of the mma backend
+            using MfmaFragANative   = typename GlobalMapping::MfmaFragANative;
+            using MfmaFragBNative   = typename GlobalMapping::MfmaFragBNative;
+            using MfmaFragAccNative = typename GlobalMapping::MfmaFragAccNative;
+
+            // Staged epilogue fragment type
+            using StagedFragD = typename GlobalMapping::StagedFragD;
+
             // Local fragment types
             using LWFragA = typename LdsMapping::LWFragA;
             using LWFragB = typename LdsMapping::LWFragB;
@@ -72,25 +81,33 @@ namespace rocwmma
             using GetIOTraitsFragB =
                 typename GetCoopIOConfig_t<FragT, CoopSchedulerB::waveCount()>::IOTraits;
 
-            // Ensure that splitCounts are the same on both sides of
-            // global fetch and local writes to match fragment data locality.
-            constexpr static auto splitCountA
-                = std::min((uint32_t)GetIOTraitsFragA<GRFragA>::IOCount,
-                           (uint32_t)GetIOTraitsFragA<LWFragA>::IOCount);
-
-            constexpr static auto splitCountB
-                = std::min((uint32_t)GetIOTraitsFragB<GRFragB>::IOCount,
-                           (uint32_t)GetIOTraitsFragB<LWFragB>::IOCount);
-
-            static_assert(
-                ((uint32_t)GetIOTraitsFragA<GRFragA>::IOCount % splitCountA == 0u)
-                    && ((uint32_t)GetIOTraitsFragA<LWFragA>::IOCount % splitCountA == 0u),
-                "splitCount A is not common divisor of GlobalRead and LocalWrite IOCounts");
-
-            static_assert(
-                ((uint32_t)GetIOTraitsFragB<GRFragB>::IOCount % splitCountB == 0u)
-                    && ((uint32_t)GetIOTraitsFragB<LWFragB>::IOCount % splitCountB == 0u),
-                "splitCount B is not common divisor of GlobalRead and LocalWrite IOCounts");
+            template <typename FragT, uint32_t WaveCount>
+            using GetCoopSplit
+                = CoopSplit<typename GetCoopIOConfig_t<FragT, WaveCount>::IOLayout::MatrixLayout,
+                            WaveCount>;
+
+            // Split each wave's share of the cooperative A / B IO into SplitCount chunks.
+            // The same chunks must evenly divide both the global fetch and the local
+            // writes of the wave, otherwise its IO is not split.
+            constexpr static uint32_t splitCountA
+                = (((uint32_t)GetCoopSplit<GRFragA, CoopSchedulerA::waveCount()>::WaveIOCount
+                        % SplitCount
+                    == 0u)
+                   && ((uint32_t)GetCoopSplit<LWFragA, CoopSchedulerA::waveCount()>::WaveIOCount
+                           % SplitCount
+                       == 0u))
+                      ? SplitCount
+                      : 1u;
+
+            constexpr static uint32_t splitCountB
+                = (((uint32_t)GetCoopSplit<GRFragB, CoopSchedulerB::waveCount()>::WaveIOCount
+                        % SplitCount
+                    == 0u)
+                   && ((uint32_t)GetCoopSplit<LWFragB, CoopSchedulerB::waveCount()>::WaveIOCount
+                           % SplitCount
+                       == 0u))
+                      ? SplitCount
+                      : 1u;
 
             ///
             /// Broadcast (fill) value
@@ -104,6 +121,29 @@ namespace rocwmma
             __device__ static inline void fill(FragT (&frags)[BlocksX][BlocksY],
                                                GetDataType_t<FragT> value);
 
+            // Broadcast value to native accumulators
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void fill(MfmaFragAccNative (&frags)[BlocksX][BlocksY],
+                                               GetDataType_t<MfmaFragAcc> value);
+
+            ///
+            /// Native format conversion
+            ///
+
+            // Formats mfma inputs for the mma backend, once per K step
+            template <uint32_t BlocksX>
+            __device__ static inline void toNative(MfmaFragANative (&fragsANative)[BlocksX],
+                                                   MfmaFragA const (&fragsA)[BlocksX]);
+            template <uint32_t BlocksY>
+            __device__ static inline void toNative(MfmaFragBNative (&fragsBNative)[BlocksY],
+                                                   MfmaFragB const (&fragsB)[BlocksY]);
+
+            // Converts native accumulators back to regular fragments, once before the epilogue
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                fromNative(MfmaFragAcc (&fragsAcc)[BlocksX][BlocksY],
+                           MfmaFragAccNative const (&fragsAccNative)[BlocksX][BlocksY]);
+
             ///
             /// Global R/W
             ///
@@ -144,6 +184,22 @@ namespace rocwmma
                                                        MfmaFragD const&          fragD,
                                                        uint32_t                  ldd);
 
+            // Global D writes staged through LDS, non-cooperative
+            // Each wave round-trips its blocks through a private LDS scratch tile
+            // of BlockM x BlockN elements in LayoutD, then re-reads them as
+            // StagedFragD with wide vectors for coalesced global stores.
+            // Single or BlocksX * BlocksY frags
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                globalWriteDStaged(GetDataType_t<MfmaFragD>* gAddrD,
+                                   MfmaFragD const (&fragsD)[BlocksX][BlocksY],
+                                   uint32_t                  ldd,
+                                   GetDataType_t<MfmaFragD>* ldsAddrD);
+            __device__ static inline void globalWriteDStaged(GetDataType_t<MfmaFragD>* gAddrD,
+                                                             MfmaFragD const&          fragD,
+                                                             uint32_t                  ldd,
+                                                             GetDataType_t<MfmaFragD>* ldsAddrD);
+
             ///
             /// Local R/W
             ///
@@ -165,6 +221,27 @@ namespace rocwmma
                                                           GRFragB const&          grFragB,
                                                           uint32_t                ldlds);
 
+            // Local A/B writes of chunk SplitIndex in [0, SplitCount) in cooperative mode.
+            // Chunks are independent, so they may be interleaved with other work.
+            // If the A/B IO is not split, chunk 0 writes the whole share.
+            template <uint32_t SplitIndex, uint32_t BlocksX>
+            __device__ static inline void localWriteCoopSplitA(GetDataType_t<GRFragA>* ldsAddr,
+                                                               GRFragA const (&grFragsA)[BlocksX],
+                                                               uint32_t ldlds);
+            template <uint32_t SplitIndex>
+            __device__ static inline void localWriteCoopSplitA(GetDataType_t<GRFragA>* ldsAddr,
+                                                               GRFragA const&          grFragA,
+                                                               uint32_t                ldlds);
+
+            template <uint32_t SplitIndex, uint32_t BlocksY>
+            __device__ static inline void localWriteCoopSplitB(GetDataType_t<GRFragB>* ldsAddr,
+                                                               GRFragB const (&grFragsB)[BlocksY],
+                                                               uint32_t ldlds);
+            template <uint32_t SplitIndex>
+            __device__ static inline void localWriteCoopSplitB(GetDataType_t<GRFragB>* ldsAddr,
+                                                               GRFragB const&          grFragB,
+                                                               uint32_t                ldlds);
+
             // Local A read non-cooperative
             // Single or BlocksX frags
             template <uint32_t BlocksX>
@@ -189,17 +266,69 @@ namespace rocwmma
             /// MFMA
             ///
 
-            // Performs mfma
+            // Performs mfma on native accumulators
+            // Single block on native inputs, or BlocksX * BlocksY frags on native
+            // inputs, or on regular inputs that are formatted once for all blocks
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                mfma(MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+                     MfmaFragA const (&fragA)[BlocksX],
+                     MfmaFragB const (&fragB)[BlocksY],
+                     MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY]);
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                mfma(MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+                     MfmaFragANative const (&fragA)[BlocksX],
+                     MfmaFragBNative const (&fragB)[BlocksY],
+                     MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY]);
+            __device__ static inline void mfma(MfmaFragAccNative&       fragAccOut,
+                                               MfmaFragANative const&   fragA,
+                                               MfmaFragBNative const&   fragB,
+                                               MfmaFragAccNative const& fragAccIn);
+
+            // Performs mfma while writing the next A/B to local memory.
+            // The mfma blocks are split into SplitCount groups, and each group is followed
+            // by the matching chunk of the cooperative A/B local writes, so that partial
+            // LDS writes overlap with the mfma.
+            // Regular A/B inputs are formatted once for all of the groups.
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                mfmaLocalWriteCoop(MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+                                   MfmaFragA const (&fragA)[BlocksX],
+                                   MfmaFragB const (&fragB)[BlocksY],
+                                   MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY],
+                                   GetDataType_t<GRFragA>*                ldsAddrA,
+                                   typename GlobalMapping::GRBuffA const& grBuffA,
+                                   GetDataType_t<GRFragB>*                ldsAddrB,
+                                   typename GlobalMapping::GRBuffB const& grBuffB,
+                                   uint32_t                               ldlds);
+            template <uint32_t SplitIndex = 0u, uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                mfmaLocalWriteCoop(MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+                                   MfmaFragANative const (&fragA)[BlocksX],
+                                   MfmaFragBNative const (&fragB)[BlocksY],
+                                   MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY],
+                                   GetDataType_t<GRFragA>*                ldsAddrA,
+                                   typename GlobalMapping::GRBuffA const& grBuffA,
+                                   GetDataType_t<GRFragB>*                ldsAddrB,
+                                   typename GlobalMapping::GRBuffB const& grBuffB,
+                                   uint32_t                               ldlds);
+
+            ///
+            /// Register placement
+            ///
+
+            // Steers accumulators into AGPRs and mfma inputs into VGPRs. Applies when
+            // built with ROCWMMA_GEMM_PLACE_REGISTERS, otherwise leaves register
+            // allocation to the compiler. Check the effect with AccVgprReport.sh.
             // Single block, or BlocksX * BlocksY frags
             template <uint32_t BlocksX, uint32_t BlocksY>
-            __device__ static inline void mfma(MfmaFragAcc (&fragAccOut)[BlocksX][BlocksY],
-                                               MfmaFragA const (&fragA)[BlocksX],
-                                               MfmaFragB const (&fragB)[BlocksY],
-                                               MfmaFragAcc const (&fragAccIn)[BlocksX][BlocksY]);
-            __device__ static inline void mfma(MfmaFragAcc&       fragAccOut,
-                                               MfmaFragA const&   fragA,
-                                               MfmaFragB const&   fragB,
-                                               MfmaFragAcc const& fragAccIn);
+            __device__ static inline void
+                placeRegisters(MfmaFragAccNative (&fragsAcc)[BlocksX][BlocksY],
+                               MfmaFragA (&fragsA)[BlocksX],
+                               MfmaFragB (&fragsB)[BlocksY]);
+            __device__ static inline void
+                placeRegisters(MfmaFragAccNative& fragAcc, MfmaFragA& fragA, MfmaFragB& fragB);
 
             ///
             /// Uniform fused multiply - add (FMA)
@@ -219,6 +348,26 @@ namespace rocwmma
                                                      GetDataType_t<MfmaFragAcc> beta,
                                                      MfmaFragC const&           fragC);
 
+            // Performs D = alpha * acc, for beta == 0 where C is not needed
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                uniformScale(MfmaFragD (&fragsD)[BlocksX][BlocksY],
+                             GetDataType_t<MfmaFragAcc> alpha,
+                             MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY]);
+            __device__ static inline void uniformScale(MfmaFragD&                 fragD,
+                                                       GetDataType_t<MfmaFragAcc> alpha,
+                                                       MfmaFragAcc const&         fragAcc);
+
+            // Performs D = acc + C, for alpha == 1 and beta == 1
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                uniformAdd(MfmaFragD (&fragsD)[BlocksX][BlocksY],
+                           MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY],
+                           MfmaFragC const (&fragsC)[BlocksX][BlocksY]);
+            __device__ static inline void uniformAdd(MfmaFragD&         fragD,
+                                                     MfmaFragAcc const& fragAcc,
+                                                     MfmaFragC const&   fragC);
+
             ///
             /// Wave synchronization
             ///
@@ -95,6 +95,28 @@ namespace rocwmma
                                                              SplitCountB>(
                         ldsAddr, lwFragB, ldlds, CoopSchedulerB::waveIndex());
                 }
+
+                template <uint32_t SplitIndex, typename LWFragA>
+                __device__ static inline void localWriteCoopSplitA(GetDataType_t<LWFragA>* ldsAddr,
+                                                                   LWFragA const& lwFragA,
+                                                                   uint32_t       ldlds)
+                {
+                    rocwmma::template store_matrix_coop_sync<CoopSchedulerA::waveCount(),
+                                                             SplitCountA,
+                                                             SplitIndex>(
+                        ldsAddr, lwFragA, ldlds, CoopSchedulerA::waveIndex());
+                }
+
+                template <uint32_t SplitIndex, typename LWFragB>
+                __device__ static inline void localWriteCoopSplitB(GetDataType_t<LWFragB>* ldsAddr,
+                                                                   LWFragB const& lwFragB,
+                                                                   uint32_t       ldlds)
+                {
+                    rocwmma::template store_matrix_coop_sync<CoopSchedulerB::waveCount(),
+                                                             SplitCountB,
+                                                             SplitIndex>(
+                        ldsAddr, lwFragB, ldlds, CoopSchedulerB::waveIndex());
+                }
             };
 
             template <typename CoopSchedulerA,
@@ -154,13 +176,37 @@ namespace rocwmma
                                                     CoopSchedulerB::waveCount(),
                                                     SplitCountB);
                 }
+
+                // Run-time wave counts cannot be split: chunk 0 writes the whole share.
+                template <uint32_t SplitIndex, typename LWFragA>
+                __device__ static inline void localWriteCoopSplitA(GetDataType_t<LWFragA>* ldsAddr,
+                                                                   LWFragA const& lwFragA,
+                                                                   uint32_t       ldlds)
+                {
+                    if constexpr(SplitIndex == 0u)
+                    {
+                        localWriteCoopA(ldsAddr, lwFragA, ldlds);
+                    }
+                }
+
+                template <uint32_t SplitIndex, typename LWFragB>
+                __device__ static inline void localWriteCoopSplitB(GetDataType_t<LWFragB>* ldsAddr,
+                                                                   LWFragB const& lwFragB,
+                                                                   uint32_t       ldlds)
+                {
+                    if constexpr(SplitIndex == 0u)
+                    {
+                        localWriteCoopB(ldsAddr, lwFragB, ldlds);
+                    }
+                }
             };
         }
 
-#define GemmDriverT \
-    typename GlobalMapping, typename LdsMapping, typename CoopSchedulerA, typename CoopSchedulerB
+#define GemmDriverT                                                                                \
+    typename GlobalMapping, typename LdsMapping, typename CoopSchedulerA, typename CoopSchedulerB, \
+        uint32_t SplitCount
 
-#define GemmDriverT_impl GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB
+#define GemmDriverT_impl GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB, SplitCount
 
         template <GemmDriverT>
         template <uint32_t BlocksX>
@@ -256,6 +302,66 @@ namespace rocwmma
                 ldlds);
         }
 
+        template <GemmDriverT>
+        template <uint32_t SplitIndex, uint32_t BlocksX>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopSplitA(
+            GetDataType_t<GRFragA>* ldsAddr, GRFragA const (&grFragsA)[BlocksX], uint32_t ldlds)
+        {
+            auto blockOffset = MappingUtil<LWFragA>::dataOffset(LdsMapping::blockOffsetA(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                localWriteCoopSplitA<SplitIndex>(ldsAddr + i * blockOffset, grFragsA[i], ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t SplitIndex>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopSplitA(
+            GetDataType_t<GRFragA>* ldsAddr, GRFragA const& grFragA, uint32_t ldlds)
+        {
+            // Chunks beyond the A split count have nothing left to write
+            if constexpr(SplitIndex < splitCountA)
+            {
+                using CoopApiSelector = detail::
+                    CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+                CoopApiSelector::template localWriteCoopSplitA<SplitIndex>(
+                    ldsAddr,
+                    LdsMapping::template formatLWFragA<CoopSchedulerA::waveCount()>(grFragA),
+                    ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t SplitIndex, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopSplitB(
+            GetDataType_t<GRFragB>* ldsAddr, GRFragB const (&grFragsB)[BlocksY], uint32_t ldlds)
+        {
+            auto blockOffset = MappingUtil<LWFragB>::dataOffset(LdsMapping::blockOffsetB(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksY; i++)
+            {
+                localWriteCoopSplitB<SplitIndex>(ldsAddr + i * blockOffset, grFragsB[i], ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t SplitIndex>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopSplitB(
+            GetDataType_t<GRFragB>* ldsAddr, GRFragB const& grFragB, uint32_t ldlds)
+        {
+            // Chunks beyond the B split count have nothing left to write
+            if constexpr(SplitIndex < splitCountB)
+            {
+                using CoopApiSelector = detail::
+                    CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+                CoopApiSelector::template localWriteCoopSplitB<SplitIndex>(
+                    ldsAddr,
+                    LdsMapping::template formatLWFragB<CoopSchedulerB::waveCount()>(grFragB),
+                    ldlds);
+            }
+        }
+
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::localReadA(
             MfmaFragA& fragsA, GetDataType_t<MfmaFragA> const* ldsAddrA, uint32_t ldlds)
@@ -323,21 +429,103 @@ namespace rocwmma
         }
 
         template <GemmDriverT>
-        __device__ inline void GemmDriver<GemmDriverT_impl>::mfma(MfmaFragAcc&       fragAccOut,
-                                                                  MfmaFragA const&   fragA,
-                                                                  MfmaFragB const&   fragB,
-                                                                  MfmaFragAcc const& fragAccIn)
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::fill(MfmaFragAccNative (&frags)[BlocksX][BlocksY],
+                                               GetDataType_t<MfmaFragAcc> value)
         {
-            rocwmma::mma_sync(fragAccOut, fragA, fragB, fragAccIn);
+            MfmaFragAcc frag;
+            fill(frag, value);
+
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    frags[i][j] = rocwmma::to_native(frag);
+                }
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::toNative(MfmaFragANative (&fragsANative)[BlocksX],
+                                                   MfmaFragA const (&fragsA)[BlocksX])
+        {
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                fragsANative[i] = rocwmma::to_native(fragsA[i]);
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksY>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::toNative(MfmaFragBNative (&fragsBNative)[BlocksY],
+                                                   MfmaFragB const (&fragsB)[BlocksY])
+        {
+#pragma unroll
+            for(int j = 0; j < BlocksY; j++)
+            {
+                fragsBNative[j] = rocwmma::to_native(fragsB[j]);
+            }
         }
 
         template <GemmDriverT>
         template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::fromNative(
+            MfmaFragAcc (&fragsAcc)[BlocksX][BlocksY],
+            MfmaFragAccNative const (&fragsAccNative)[BlocksX][BlocksY])
+        {
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    fragsAcc[i][j] = rocwmma::from_native(fragsAccNative[i][j]);
+                }
+            }
+        }
+
+        template <GemmDriverT>
         __device__ inline void
-            GemmDriver<GemmDriverT_impl>::mfma(MfmaFragAcc (&fragAccOut)[BlocksX][BlocksY],
-                                               MfmaFragA const (&fragA)[BlocksX],
-                                               MfmaFragB const (&fragB)[BlocksY],
-                                               MfmaFragAcc const (&fragAccIn)[BlocksX][BlocksY])
+            GemmDriver<GemmDriverT_impl>::mfma(MfmaFragAccNative&       fragAccOut,
+                                               MfmaFragANative const&   fragA,
+                                               MfmaFragBNative const&   fragB,
+                                               MfmaFragAccNative const& fragAccIn)
+        {
+            rocwmma::mma_sync(fragAccOut, fragA, fragB, fragAccIn);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::mfma(
+            MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+            MfmaFragA const (&fragA)[BlocksX],
+            MfmaFragB const (&fragB)[BlocksY],
+            MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY])
+        {
+            // Each A frag is re-used BlocksY times and each B frag BlocksX times.
+            // Format inputs for the mma backend only once (no-op on MFMA targets).
+            MfmaFragANative nativeA[BlocksX];
+            MfmaFragBNative nativeB[BlocksY];
+            toNative(nativeA, fragA);
+            toNative(nativeB, fragB);
+
+            mfma(fragAccOut, nativeA, nativeB, fragAccIn);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::mfma(
+            MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+            MfmaFragANative const (&fragA)[BlocksX],
+            MfmaFragBNative const (&fragB)[BlocksY],
+            MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY])
         {
 #pragma unroll
             for(int i = 0; i < BlocksX; i++)
@@ -350,6 +538,122 @@ namespace rocwmma
             }
         }
 
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::mfmaLocalWriteCoop(
+            MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+            MfmaFragA const (&fragA)[BlocksX],
+            MfmaFragB const (&fragB)[BlocksY],
+            MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY],
+            GetDataType_t<GRFragA>*                ldsAddrA,
+            typename GlobalMapping::GRBuffA const& grBuffA,
+            GetDataType_t<GRFragB>*                ldsAddrB,
+            typename GlobalMapping::GRBuffB const& grBuffB,
+            uint32_t                               ldlds)
+        {
+            // Format inputs once for all of the split groups, as in mfma
+            MfmaFragANative nativeA[BlocksX];
+            MfmaFragBNative nativeB[BlocksY];
+            toNative(nativeA, fragA);
+            toNative(nativeB, fragB);
+
+            mfmaLocalWriteCoop<0u>(fragAccOut,
+                                   nativeA,
+                                   nativeB,
+                                   fragAccIn,
+                                   ldsAddrA,
+                                   grBuffA,
+                                   ldsAddrB,
+                                   grBuffB,
+                                   ldlds);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t SplitIndex, uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::mfmaLocalWriteCoop(
+            MfmaFragAccNative (&fragAccOut)[BlocksX][BlocksY],
+            MfmaFragANative const (&fragA)[BlocksX],
+            MfmaFragBNative const (&fragB)[BlocksY],
+            MfmaFragAccNative const (&fragAccIn)[BlocksX][BlocksY],
+            GetDataType_t<GRFragA>*                ldsAddrA,
+            typename GlobalMapping::GRBuffA const& grBuffA,
+            GetDataType_t<GRFragB>*                ldsAddrB,
+            typename GlobalMapping::GRBuffB const& grBuffB,
+            uint32_t                               ldlds)
+        {
+            // Current group of mfma blocks, in row major order
+            constexpr uint32_t Blocks     = BlocksX * BlocksY;
+            constexpr uint32_t BlockBegin = SplitIndex * Blocks / SplitCount;
+            constexpr uint32_t BlockEnd   = (SplitIndex + 1u) * Blocks / SplitCount;
+
+#pragma unroll
+            for(uint32_t b = BlockBegin; b < BlockEnd; b++)
+            {
+                auto i = b / BlocksY;
+                auto j = b % BlocksY;
+                mfma(fragAccOut[i][j], fragA[i], fragB[j], fragAccIn[i][j]);
+            }
+
+            // Followed by the current chunk of local writes
+            localWriteCoopSplitA<SplitIndex>(ldsAddrA, grBuffA, ldlds);
+            localWriteCoopSplitB<SplitIndex>(ldsAddrB, grBuffB, ldlds);
+
+            if constexpr(SplitIndex + 1u < SplitCount)
+            {
+                mfmaLocalWriteCoop<SplitIndex + 1u>(fragAccOut,
+                                                    fragA,
+                                                    fragB,
+                                                    fragAccIn,
+                                                    ldsAddrA,
+                                                    grBuffA,
+                                                    ldsAddrB,
+                                                    grBuffB,
+                                                    ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::placeRegisters(
+            MfmaFragAccNative& fragAcc, MfmaFragA& fragA, MfmaFragB& fragB)
+        {
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+            rocwmma::place_registers<agpr_storage>(fragAcc);
+            rocwmma::place_registers<vgpr_storage>(fragA);
+            rocwmma::place_registers<vgpr_storage>(fragB);
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::placeRegisters(
+                MfmaFragAccNative (&fragsAcc)[BlocksX][BlocksY],
+                MfmaFragA (&fragsA)[BlocksX],
+                MfmaFragB (&fragsB)[BlocksY])
+        {
+#if defined(ROCWMMA_GEMM_PLACE_REGISTERS)
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    rocwmma::place_registers<agpr_storage>(fragsAcc[i][j]);
+                }
+            }
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                rocwmma::place_registers<vgpr_storage>(fragsA[i]);
+            }
+#pragma unroll
+            for(int j = 0; j < BlocksY; j++)
+            {
+                rocwmma::place_registers<vgpr_storage>(fragsB[j]);
+            }
+#endif // ROCWMMA_GEMM_PLACE_REGISTERS
+        }
+
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::globalReadC(
             MfmaFragC& fragC, GetDataType_t<MfmaFragC> const* gAddrC, uint32_t ldc)
@@ -416,6 +720,60 @@ namespace rocwmma
             }
         }
 
+        template <GemmDriverT>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::globalWriteDStaged(GetDataType_t<MfmaFragD>* gAddrD,
+                                                             MfmaFragD const&          fragD,
+                                                             uint32_t                  ldd,
+                                                             GetDataType_t<MfmaFragD>* ldsAddrD)
+        {
+            // Scratch tile is densely packed in LayoutD
+            constexpr auto ldlds = GetDataLayout_t<MfmaFragD>::leadingDim(
+                make_coord2d(MfmaFragD::height(), MfmaFragD::width()));
+
+            // Scratch is private to the wave, and LDS accesses of a wave complete in order.
+            // The scheduling barriers keep the compiler from interleaving the round trip.
+            rocwmma::store_matrix_sync(ldsAddrD, fragD, ldlds);
+            sched_barrier();
+
+            StagedFragD stagedD;
+            rocwmma::load_matrix_sync(stagedD, ldsAddrD, ldlds);
+            sched_barrier();
+
+            rocwmma::store_matrix_sync(gAddrD, stagedD, ldd);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::globalWriteDStaged(
+            GetDataType_t<MfmaFragD>* gAddrD,
+            MfmaFragD const (&fragsD)[BlocksX][BlocksY],
+            uint32_t                  ldd,
+            GetDataType_t<MfmaFragD>* ldsAddrD)
+        {
+            auto blockStepX
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetA(), ldd);
+            auto blockStepY
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetB(), ldd);
+
+            // All blocks re-use the wave's scratch tile without further syncs. The next
+            // block's LDS store can't pass the previous block's LDS load, as both are
+            // issued in order by the same wave on the same addresses.
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                auto offsetY = 0u;
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    globalWriteDStaged(gAddrD + offsetY, fragsD[i][j], ldd, ldsAddrD);
+
+                    offsetY += blockStepY;
+                }
+                gAddrD += blockStepX;
+            }
+        }
+
         template <GemmDriverT>
         __device__ inline void
             GemmDriver<GemmDriverT_impl>::uniformFma(MfmaFragD&                 fragD,
@@ -453,6 +811,69 @@ namespace rocwmma
             }
         }
 
+        template <GemmDriverT>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::uniformScale(MfmaFragD&                 fragD,
+                                                       GetDataType_t<MfmaFragAcc> alpha,
+                                                       MfmaFragAcc const&         fragAcc)
+        {
+            for(int i = 0; i < fragD.num_elements; i++)
+            {
+                // Perform computation in ComputeT and cast back to OutputT
+                fragD.x[i] = static_cast<GetDataType_t<MfmaFragD>>(alpha * fragAcc.x[i]);
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::uniformScale(
+            MfmaFragD (&fragsD)[BlocksX][BlocksY],
+            GetDataType_t<MfmaFragAcc> alpha,
+            MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY])
+        {
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    uniformScale(fragsD[i][j], alpha, fragsAcc[i][j]);
+                }
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void
+            GemmDriver<GemmDriverT_impl>::uniformAdd(MfmaFragD&         fragD,
+                                                     MfmaFragAcc const& fragAcc,
+                                                     MfmaFragC const&   fragC)
+        {
+            for(int i = 0; i < fragD.num_elements; i++)
+            {
+                // Perform computation in ComputeT and cast back to OutputT
+                fragD.x[i] = static_cast<GetDataType_t<MfmaFragD>>(
+                    fragAcc.x[i] + static_cast<GetDataType_t<MfmaFragAcc>>(fragC.x[i]));
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::uniformAdd(
+            MfmaFragD (&fragsD)[BlocksX][BlocksY],
+            MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY],
+            MfmaFragC const (&fragsC)[BlocksX][BlocksY])
+        {
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    uniformAdd(fragsD[i][j], fragsAcc[i][j], fragsC[i][j]);
+                }
+            }
+        }
+
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::syncWorkgroup()
         {
@@ -0,0 +1,377 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GEMM_DROPOUT_HPP
+#define GEMM_DROPOUT_HPP
+
+#include <algorithm>
+#include <type_traits>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace CooperativeGemm
+    {
+        /* Philox4x32-10 counter-based generator (Salmon et al., SC '11).
+        *  Maps a 128 bit counter and a 64 bit key to 128 random bits without any
+        *  state, so that each output element draws its own numbers independently
+        *  of which wave computes it. Host-callable for the reference.
+        */
+        struct Philox4x32
+        {
+            enum : uint32_t
+            {
+                Rounds = 10u,
+                M0     = 0xD2511F53u,
+                M1     = 0xCD9E8D57u,
+                W0     = 0x9E3779B9u,
+                W1     = 0xBB67AE85u
+            };
+
+            ROCWMMA_HOST_DEVICE static inline uint32_t
+                mulhilo(uint32_t a, uint32_t b, uint32_t& hi)
+            {
+                auto product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+                hi           = static_cast<uint32_t>(product >> 32u);
+                return static_cast<uint32_t>(product);
+            }
+
+            // Replaces the counter with its random bits
+            ROCWMMA_HOST_DEVICE static inline void
+                generate(uint32_t (&ctr)[4], uint32_t key0, uint32_t key1)
+            {
+#pragma unroll
+                for(uint32_t r = 0u; r < Rounds; r++)
+                {
+                    if(r > 0u)
+                    {
+                        key0 += W0;
+                        key1 += W1;
+                    }
+
+                    uint32_t hi0, hi1;
+                    auto     lo0 = mulhilo(M0, ctr[0], hi0);
+                    auto     lo1 = mulhilo(M1, ctr[2], hi1);
+
+                    ctr[0] = hi1 ^ ctr[1] ^ key0;
+                    ctr[1] = lo1;
+                    ctr[2] = hi0 ^ ctr[3] ^ key1;
+                    ctr[3] = lo0;
+                }
+            }
+        };
+
+        // Dropout of a gemm run, uniform over the grid
+        struct DropoutParams
+        {
+            uint64_t  seed;
+            uint64_t  offset; // Advanced by the caller between runs sharing a seed
+            uint32_t  threshold; // Elements drawing less than threshold are dropped
+            float32_t scale; // 1 / (1 - p)
+            uint32_t* mask; // Bit-packed keep mask, row-major m x ldMask words
+            uint32_t  ldMask;
+        };
+
+        // Device-side parameters, set by the host before runs.
+        // Defined once in gemm_dropout.cpp, shared by relocatable device code.
+        extern __constant__ DropoutParams dropoutParams;
+
+        // Dropout with probability p in [0, 1), with an optional mask for an m x n output
+        inline DropoutParams makeDropoutParams(
+            float32_t p, uint64_t seed, uint64_t offset, uint32_t* mask, uint32_t n)
+        {
+            auto threshold = std::min(static_cast<float64_t>(p) * 4294967296.0, 4294967295.0);
+
+            DropoutParams params;
+            params.seed      = seed;
+            params.offset    = offset;
+            params.threshold = static_cast<uint32_t>(threshold);
+            params.scale     = 1.0f / (1.0f - p);
+            params.mask      = mask;
+            params.ldMask    = (n + 31u) / 32u;
+            return params;
+        }
+
+        /* DropoutWords class:
+        *  Splits the keep mask words of a BlockM x BlockN block evenly over the lanes
+        *  of a wave. Each block row spans RowWords words of WordBits bits, and the
+        *  block's Words words are cut into chunks of LaneBits consecutive columns:
+        *  - LanesPerWord adjacent lanes draw the chunks of one word, and are or-ed
+        *    together, so the first of them (the owner) holds the whole word.
+        *  - Blocks with more words than lanes hand LaneWords words to each lane.
+        *  Host-callable, so that the partition can be tested on host.
+        */
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t WaveSizeT>
+        struct DropoutWords
+        {
+            static constexpr uint32_t WaveSize = WaveSizeT;
+            static constexpr uint32_t WordBits = std::min(BlockN, 32u);
+            static constexpr uint32_t RowWords = BlockN / WordBits;
+            static constexpr uint32_t Words    = BlockM * RowWords;
+
+            static constexpr uint32_t LanesPerWord
+                = Words >= WaveSize ? 1u : std::min(WaveSize / Words, WordBits);
+            static constexpr uint32_t LaneBits  = WordBits / LanesPerWord;
+            static constexpr uint32_t LaneWords = (Words * LanesPerWord + WaveSize - 1u) / WaveSize;
+
+            ROCWMMA_HOST_DEVICE static constexpr inline uint32_t chunk(uint32_t slot,
+                                                                       uint32_t laneId)
+            {
+                return slot * WaveSize + laneId;
+            }
+
+            ROCWMMA_HOST_DEVICE static constexpr inline bool isValid(uint32_t chunk)
+            {
+                return chunk / LanesPerWord < Words;
+            }
+
+            ROCWMMA_HOST_DEVICE static constexpr inline bool isWordOwner(uint32_t chunk)
+            {
+                return chunk % LanesPerWord == 0u;
+            }
+
+            // Block coordinate of the first column of a chunk
+            ROCWMMA_HOST_DEVICE static constexpr inline uint32_t rowOffset(uint32_t chunk)
+            {
+                return chunk / LanesPerWord / RowWords;
+            }
+
+            ROCWMMA_HOST_DEVICE static constexpr inline uint32_t colOffset(uint32_t chunk)
+            {
+                return (chunk / LanesPerWord % RowWords) * WordBits
+                       + (chunk % LanesPerWord) * LaneBits;
+            }
+
+            // Chunk of the owner of the word holding block element (row, col)
+            ROCWMMA_HOST_DEVICE static constexpr inline uint32_t ownerChunk(uint32_t row,
+                                                                            uint32_t col)
+            {
+                return (row * RowWords + col / WordBits) * LanesPerWord;
+            }
+        };
+
+        /* Dropout class:
+        *  Fused dropout of the D elements in the gemm epilogue. Element (row, col) of
+        *  the m x n output draws the first word of Philox4x32 with:
+        *  - counter = (row * n + col, offset), as two 64 bit halves
+        *  - key     = seed
+        *
+        *  The draw only depends on the seed, offset and global coordinate, so masks
+        *  reproduce across block sizes, wave tiles and layouts. Kept elements are
+        *  scaled by 1 / (1 - p), dropped elements are zeroed. The keep mask is packed
+        *  row-major, one bit per column: bit (col % 32) of word row * ldMask + col / 32.
+        */
+        struct Dropout
+        {
+            ROCWMMA_HOST_DEVICE static inline uint32_t
+                random(DropoutParams const& params, uint32_t row, uint32_t col, uint32_t n)
+            {
+                auto     index  = static_cast<uint64_t>(row) * static_cast<uint64_t>(n) + col;
+                uint32_t ctr[4] = {static_cast<uint32_t>(index),
+                                   static_cast<uint32_t>(index >> 32u),
+                                   static_cast<uint32_t>(params.offset),
+                                   static_cast<uint32_t>(params.offset >> 32u)};
+
+                Philox4x32::generate(ctr,
+                                     static_cast<uint32_t>(params.seed),
+                                     static_cast<uint32_t>(params.seed >> 32u));
+                return ctr[0];
+            }
+
+            ROCWMMA_HOST_DEVICE static inline bool
+                isKept(DropoutParams const& params, uint32_t row, uint32_t col, uint32_t n)
+            {
+                return random(params, row, col, n) >= params.threshold;
+            }
+
+            // Wide types are scaled in double precision
+            template <typename DataT>
+            ROCWMMA_HOST_DEVICE static inline DataT scale(DataT value, bool keep, float32_t scale)
+            {
+                using ScaleT
+                    = std::conditional_t<(sizeof(DataT) > sizeof(float32_t)), float64_t, float32_t>;
+
+                return keep ? static_cast<DataT>(static_cast<ScaleT>(value)
+                                                 * static_cast<ScaleT>(scale))
+                            : static_cast<DataT>(0);
+            }
+
+            ROCWMMA_HOST_DEVICE static inline uint32_t
+                maskIndex(uint32_t row, uint32_t col, uint32_t ldMask)
+            {
+                return row * ldMask + col / 32u;
+            }
+
+            ROCWMMA_HOST_DEVICE static inline uint32_t maskBit(uint32_t col)
+            {
+                return 1u << (col % 32u);
+            }
+
+            // Applies dropout to the BlocksX x BlocksY D blocks of a wave at baseCoord.
+            // The keep bits of each block are drawn as whole mask words, split evenly
+            // over the lanes (see DropoutWords). Elements read their bit back from the
+            // lane holding the word, and each word is written once: stored if the block
+            // spans it, or-ed in otherwise, so the mask must be zeroed before the first
+            // run with the given params.
+            template <bool WriteMask,
+                      typename FragD,
+                      uint32_t BlocksX,
+                      uint32_t BlocksY,
+                      typename CoordT,
+                      typename StepXT,
+                      typename StepYT>
+            __device__ static inline void apply(FragD (&fragsD)[BlocksX][BlocksY],
+                                                CoordT const& baseCoord,
+                                                StepXT const& blockStepX,
+                                                StepYT const& blockStepY,
+                                                uint32_t      n)
+            {
+                using Words = DropoutWords<GetIOShape_t<FragD>::BlockHeight,
+                                           GetIOShape_t<FragD>::BlockWidth,
+                                           Constants::AMDGCN_WAVE_SIZE>;
+
+                auto const params = dropoutParams;
+                auto const laneId = __lane_id();
+
+#pragma unroll
+                for(uint32_t i = 0u; i < BlocksX; i++)
+                {
+#pragma unroll
+                    for(uint32_t j = 0u; j < BlocksY; j++)
+                    {
+                        auto blockRow = get<0>(baseCoord) + i * get<0>(blockStepX)
+                                        + j * get<0>(blockStepY);
+                        auto blockCol = get<1>(baseCoord) + i * get<1>(blockStepX)
+                                        + j * get<1>(blockStepY);
+
+                        // Draw this lane's chunk of keep bits, then gather whole words
+                        uint32_t words[Words::LaneWords];
+#pragma unroll
+                        for(uint32_t s = 0u; s < Words::LaneWords; s++)
+                        {
+                            auto chunk = Words::chunk(s, laneId);
+                            words[s]   = 0u;
+                            if(Words::isValid(chunk))
+                            {
+                                auto row = blockRow + Words::rowOffset(chunk);
+                                auto col = blockCol + Words::colOffset(chunk);
+#pragma unroll
+                                for(uint32_t b = 0u; b < Words::LaneBits; b++)
+                                {
+                                    words[s] |= isKept(params, row, col + b, n)
+                                                    ? maskBit(col + b)
+                                                    : 0u;
+                                }
+                            }
+
+#pragma unroll
+                            for(uint32_t lanes = 1u; lanes < Words::LanesPerWord; lanes *= 2u)
+                            {
+                                words[s] |= __shfl_xor(words[s], lanes);
+                            }
+                        }
+
+                        for_each_element(
+                            fragsD[i][j], [&](uint32_t row, uint32_t col, auto& value) {
+                                auto owner = Words::ownerChunk(row, col);
+                                auto bits  = 0u;
+#pragma unroll
+                                for(uint32_t s = 0u; s < Words::LaneWords; s++)
+                                {
+                                    auto word = __shfl(words[s], owner % Words::WaveSize);
+                                    bits      = (s == owner / Words::WaveSize) ? word : bits;
+                                }
+
+                                auto keep = (bits & maskBit(blockCol + col)) != 0u;
+                                value     = scale(value, keep, params.scale);
+                            });
+
+                        if constexpr(WriteMask)
+                        {
+#pragma unroll
+                            for(uint32_t s = 0u; s < Words::LaneWords; s++)
+                            {
+                                auto chunk = Words::chunk(s, laneId);
+                                if(Words::isValid(chunk) && Words::isWordOwner(chunk))
+                                {
+                                    auto* word = params.mask
+                                                 + maskIndex(blockRow + Words::rowOffset(chunk),
+                                                             blockCol + Words::colOffset(chunk),
+                                                             params.ldMask);
+                                    if constexpr(Words::WordBits == 32u)
+                                    {
+                                        *word = words[s];
+                                    }
+                                    else
+                                    {
+                                        atomicOr(word, words[s]);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        // Host reference of the dropout epilogue on an m x n matrix in DataLayout.
+        // Reproduces the device draws exactly, and writes the full mask if given.
+        template <typename DataT, typename DataLayout>
+        inline void dropout_CPU(
+            DataT* data, uint32_t* mask, uint32_t m, uint32_t n, DropoutParams const& params)
+        {
+            if(mask != nullptr)
+            {
+                std::fill(mask, mask + m * params.ldMask, 0u);
+            }
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < n; col++)
+                {
+                    auto index = std::is_same_v<DataLayout, row_major>
+                                     ? static_cast<uint64_t>(row) * n + col
+                                     : static_cast<uint64_t>(col) * m + row;
+
+                    auto keep   = Dropout::isKept(params, row, col, n);
+                    data[index] = Dropout::scale(data[index], keep, params.scale);
+
+                    if(mask != nullptr && keep)
+                    {
+                        mask[Dropout::maskIndex(row, col, params.ldMask)] |= Dropout::maskBit(col);
+                    }
+                }
+            }
+        }
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#endif // GEMM_DROPOUT_HPP
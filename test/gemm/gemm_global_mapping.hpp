@@ -115,6 +115,23 @@ namespace rocwmma
                 using MfmaFragD   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutD>;
                 using MfmaFragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>;
 
+                // Mfma fragments in the register format of the mma backend. Inputs are
+                // formatted once per K step, accumulators are held across the K loop.
+                using MfmaFragANative
+                    = native_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+                using MfmaFragBNative
+                    = native_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+                using MfmaFragAccNative
+                    = native_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>;
+
+                // Block fragment for D writes staged through LDS. Covers the same
+                // BlockM x BlockN tile as MfmaFragD, with wide vectors along the
+                // contiguous dimension of LayoutD for coalesced global stores.
+                using StagedFragD = std::conditional_t<
+                    std::is_same_v<LayoutD, row_major>,
+                    fragment<matrix_a, BlockM, BlockN, BlockN, OutputT, row_major>,
+                    fragment<matrix_b, BlockM, BlockN, BlockM, OutputT, col_major>>;
+
                 // Mfma fragment buffers required for the gemm driver
                 using MfmaBuffA   = MfmaFragA[BlocksX];
                 using MfmaBuffB   = MfmaFragB[BlocksY];
@@ -122,6 +139,10 @@ namespace rocwmma
                 using MfmaBuffD   = MfmaFragD[BlocksX][BlocksY];
                 using MfmaBuffAcc = MfmaFragAcc[BlocksX][BlocksY];
 
+                using MfmaBuffANative   = MfmaFragANative[BlocksX];
+                using MfmaBuffBNative   = MfmaFragBNative[BlocksY];
+                using MfmaBuffAccNative = MfmaFragAccNative[BlocksX][BlocksY];
+
                 using WaveSpace = typename rocwmma::detail::WaveSpace<TBlockX, TBlockY>;
 
                 // Projection of C coordinate in direction of A
@@ -475,6 +496,67 @@ namespace rocwmma
             }
         };
 
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename OutputT,
+                  typename ComputeT,
+                  typename LayoutA,
+                  typename LayoutB,
+                  typename LayoutC,
+                  typename LayoutD,
+                  uint32_t BlocksX,
+                  uint32_t BlocksY,
+                  uint32_t TBlockX = 0,
+                  uint32_t TBlockY = 0>
+        struct WeightStationaryMapping : public WorkgroupLevelMapping<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD,
+                                                                      BlocksX,
+                                                                     BlocksY,
+                                                                      TBlockX,
+                                                                      TBlockY>
+        {
+            /*
+            * Persistent flavour of the Workgroup level mapping, for weight-stationary GEMMs.
+            * Fragments and buffers are the same as the Workgroup level mapping, however the
+            * workgroup grid only covers a few macro tiles in the M direction:
+            * - Each workgroup owns one B panel of K x (WgY * BlocksY * BlockN), which it
+            *   loads once and keeps resident in LDS.
+            * - Each workgroup then streams A through the B panel for every M tile
+            *   (WgX * BlocksX * BlockM) x K, at a stride of gridDim.x macro tiles.
+            *
+            * The starting coordinates are those of the Workgroup level mapping. Coordinates
+            * of the next M tile are offset by mTileStepC().
+            */
+            using Base = WorkgroupLevelMapping<BlockM,
+                                               BlockN,
+                                               BlockK,
+                                               InputT,
+                                               OutputT,
+                                               ComputeT,
+                                               LayoutA,
+                                               LayoutB,
+                                               LayoutC,
+                                               LayoutD,
+                                               BlocksX,
+                                               BlocksY,
+                                               TBlockX,
+                                               TBlockY>;
+
+            // The matrix offset between consecutive M tiles of the same workgroup
+            __device__ static inline auto mTileStepC();
+            __device__ static inline auto mTileStepA();
+        };
+
     } // namespace GlobalMapping
 
 } // namespace rocwmma
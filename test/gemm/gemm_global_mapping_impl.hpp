@@ -159,6 +159,19 @@ namespace rocwmma
             }
         }
 
+        template <MappingBaseT>
+        __device__ inline auto WeightStationaryMapping<MappingBaseT_impl>::mTileStepC()
+        {
+            return make_coord2d(get<0>(Base::macroTileSizeC()) * static_cast<uint32_t>(gridDim.x),
+                                0u);
+        }
+
+        template <MappingBaseT>
+        __device__ inline auto WeightStationaryMapping<MappingBaseT_impl>::mTileStepA()
+        {
+            return Base::projCoordA(mTileStepC());
+        }
+
 #undef MappingBaseT
 #undef MappingBaseT_impl
 
@@ -135,6 +135,10 @@ namespace rocwmma
         virtual bool checkLds() const;
         virtual bool checkQuirks() const;
 
+        // In-place kernels alias D onto C.
+        // True = launch with C == D
+        virtual bool isInPlace() const;
+
         // Reset all members to default values
         virtual void reset();
 
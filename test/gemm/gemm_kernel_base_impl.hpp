@@ -41,7 +41,9 @@
 
 #include "common.hpp"
 #include "gemm_kernel_base.hpp"
+#include "host_task_pool.hpp"
 #include "performance.hpp"
+#include "rocwmma_logging.hpp"
 
 #if ROCWMMA_VALIDATION_TESTS
 #include "reference.hpp" // Vanilla CPU kernel
@@ -366,6 +368,30 @@ namespace rocwmma
         return true;
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::isInPlace() const
+    {
+        return false;
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -619,8 +645,22 @@ namespace rocwmma
             /// Run ROCWMMA kernel
             ///
 
+            // In-place kernels update D from itself, so every run starts from a
+            // fresh copy of C in D. The reset is kept out of the timed region.
+            auto resetInPlace = [this]() {
+                if(this->isInPlace())
+                {
+                    auto& dataInstance = DataStorage::instance();
+                    dataInstance->copyData(
+                        dataInstance->deviceD(), dataInstance->deviceC(), this->mM * this->mN);
+                }
+            };
+
             auto rocwmmaKernel = [this]() {
                 auto& dataInstance = DataStorage::instance();
+                auto* matrixC      = this->isInPlace() ? dataInstance->deviceD().get()
+                                                       : dataInstance->deviceC().get();
+
                 hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
                                       (this->gridDim()), // Wg grid size
                                       (this->blockDim()), // Thread block size
@@ -634,7 +674,7 @@ namespace rocwmma
                                       this->mK, // K
                                       dataInstance->deviceA().get(), // A*
                                       dataInstance->deviceB().get(), // B*
-                                      dataInstance->deviceC().get(), // C*
+                                      matrixC, // C*
                                       dataInstance->deviceD().get(), // D*
                                       this->mLda, // lda
                                       this->mLdb, // ldb
@@ -644,9 +684,42 @@ namespace rocwmma
                                       this->mBeta); // beta
             };
 
+            // Pipelined mode: the CPU reference only touches the host copies made
+            // in setup(), so it runs on the host pool while the device is busy with
+            // the rocWMMA runs below. It is joined before validation.
+            std::future<void> hostRef;
+
+#if ROCWMMA_VALIDATION_TESTS
+
+            // Define fallback CPU kernel
+            auto cpuKernel = [this]() {
+                auto& dataInstance = DataStorage::instance();
+                gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+                    this->mM,
+                    this->mN,
+                    this->mK,
+                    dataInstance->hostA().get(),
+                    dataInstance->hostB().get(),
+                    dataInstance->hostC().get(),
+                    dataInstance->hostD().get(),
+                    this->mAlpha,
+                    this->mBeta);
+            };
+
+            if constexpr(mRunRefFlag && mIsCpuRef)
+            {
+                if(RocwmmaLogging::instance()->pipelined())
+                {
+                    hostRef = HostTaskPool::instance()->submit(cpuKernel);
+                }
+            }
+
+#endif // ROCWMMA_VALIDATION_TESTS
+
             // Cold runs for frequency warm-up
             for(uint32_t i = 0; i < mColdRuns; ++i)
             {
+                resetInPlace();
                 rocwmmaKernel();
             }
 
@@ -654,16 +727,35 @@ namespace rocwmma
             hipEvent_t startEvent, stopEvent;
             CHECK_HIP_ERROR(hipEventCreate(&startEvent));
             CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
-            CHECK_HIP_ERROR(hipEventRecord(startEvent));
-            for(uint32_t i = 0; i < mHotRuns; ++i)
-            {
-                rocwmmaKernel();
-            }
-            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
-            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
 
             auto timeMs = 0.0f;
-            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+            if(isInPlace())
+            {
+                // Time each run on its own, so the D resets are not counted
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    resetInPlace();
+
+                    auto runMs = 0.0f;
+                    CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                    rocwmmaKernel();
+                    CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                    CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                    CHECK_HIP_ERROR(hipEventElapsedTime(&runMs, startEvent, stopEvent));
+                    timeMs += runMs;
+                }
+            }
+            else
+            {
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    rocwmmaKernel();
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+            }
 
             // Calculate efficiency
             auto& deviceInfo = DeviceInfo::instance();
@@ -690,21 +782,6 @@ namespace rocwmma
 
 #if ROCWMMA_VALIDATION_TESTS
 
-                    // Define fallback CPU kernel
-                    auto cpuKernel = [this]() {
-                        auto& dataInstance = DataStorage::instance();
-                        gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
-                            this->mM,
-                            this->mN,
-                            this->mK,
-                            dataInstance->hostA().get(),
-                            dataInstance->hostB().get(),
-                            dataInstance->hostC().get(),
-                            dataInstance->hostD().get(),
-                            this->mAlpha,
-                            this->mBeta);
-                    };
-
                     // Assign cpu func
                     refKernel = cpuKernel;
 
@@ -802,43 +879,53 @@ namespace rocwmma
                         std::numeric_limits<OutputT>::signaling_NaN());
                 }
 
-                // Cold runs for frequency warm-up
-                for(uint32_t i = 0; i < mColdRuns; ++i)
+                // In pipelined mode the CPU reference is already running on the
+                // host pool. Join it once (re-throws any host error) and skip the
+                // reference timing: it would only time the join.
+                if(hostRef.valid())
                 {
-                    refKernel();
+                    hostRef.get();
                 }
-
-                // Hot runs for timing
-                hipEvent_t startEvent, stopEvent;
-                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
-                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
-                CHECK_HIP_ERROR(hipEventRecord(startEvent));
-                for(uint32_t i = 0; i < mHotRuns; ++i)
+                else
                 {
-                    refKernel();
-                }
-                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
-                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                    // Cold runs for frequency warm-up
+                    for(uint32_t i = 0; i < mColdRuns; ++i)
+                    {
+                        refKernel();
+                    }
 
-                auto timeMs = 0.0f;
-                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
-                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
-                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+                    // Hot runs for timing
+                    hipEvent_t startEvent, stopEvent;
+                    CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                    CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+                    CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                    for(uint32_t i = 0; i < mHotRuns; ++i)
+                    {
+                        refKernel();
+                    }
+                    CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                    CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
 
-                // Calculate reference efficiency
-                if constexpr(mBenchRef)
-                {
+                    auto timeMs = 0.0f;
+                    CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                    CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                    CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                    // Calculate reference efficiency
+                    if constexpr(mBenchRef)
+                    {
 
-                    auto& deviceInfo             = DeviceInfo::instance();
-                    auto  devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
+                        auto& deviceInfo             = DeviceInfo::instance();
+                        auto  devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
 
-                    auto elapsedTimeMs        = float64_t(timeMs);
-                    auto measuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, elapsedTimeMs)
-                                                * static_cast<float64_t>(mHotRuns);
+                        auto elapsedTimeMs        = float64_t(timeMs);
+                        auto measuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, elapsedTimeMs)
+                                                    * static_cast<float64_t>(mHotRuns);
 
-                    mRefMeasuredTFlopsPerSec = measuredTFlopsPerSec;
-                    mRefEfficiency
-                        = round(measuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+                        mRefMeasuredTFlopsPerSec = measuredTFlopsPerSec;
+                        mRefEfficiency
+                            = round(measuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+                    }
                 }
 
                 // Prepare data for validation
@@ -140,6 +140,14 @@ namespace rocwmma
             // Leading dimension of lds matrix
             __device__ constexpr static inline auto ldLds();
 
+            // Separate A / B regions, for kernels that hold A and B for different lifetimes.
+            // A coordinates are unchanged. B coordinates are relative to baseOffsetB().
+            __device__ constexpr static inline auto baseOffsetB();
+            __device__ constexpr static inline auto sizeLdsA();
+            __device__ constexpr static inline auto sizeLdsB();
+            __device__ constexpr static inline auto ldLdsA();
+            __device__ constexpr static inline auto ldLdsB();
+
             template <uint32_t WaveCount = 1>
             __device__ constexpr static inline auto
                 formatLWFragA(typename GlobalMapping::GRFragA const& grFragA)
@@ -270,6 +278,14 @@ namespace rocwmma
             // Leading dimension of shared memory usage
             __device__ constexpr static inline auto ldLds();
 
+            // Separate A / B regions, for kernels that hold A and B for different lifetimes.
+            // A coordinates are unchanged. B coordinates are relative to baseOffsetB().
+            __device__ constexpr static inline auto baseOffsetB();
+            __device__ constexpr static inline auto sizeLdsA();
+            __device__ constexpr static inline auto sizeLdsB();
+            __device__ constexpr static inline auto ldLdsA();
+            __device__ constexpr static inline auto ldLdsB();
+
             template <uint32_t WaveCount = 1>
             __device__ constexpr static inline auto
                 formatLWFragA(typename GlobalMapping::GRFragA const& grFragA)
@@ -111,6 +111,39 @@ namespace rocwmma
             return DataLayout::leadingDim(sizeLds());
         }
 
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::baseOffsetB()
+        {
+            // B data will start right after A data
+            return swap(GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC()));
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::sizeLdsA()
+        {
+            auto macroTileC = GlobalMapping::macroTileSizeC();
+            return make_coord2d(LdsHeight, get<0>(macroTileC));
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::sizeLdsB()
+        {
+            auto macroTileC = GlobalMapping::macroTileSizeC();
+            return make_coord2d(LdsHeight, get<1>(macroTileC));
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::ldLdsA()
+        {
+            return DataLayout::leadingDim(sizeLdsA());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::ldLdsB()
+        {
+            return DataLayout::leadingDim(sizeLdsB());
+        }
+
 #undef LdsMappingT
 #undef LdsMappingT_impl
 
@@ -191,6 +224,39 @@ namespace rocwmma
             return DataLayout::leadingDim(sizeLds());
         }
 
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::baseOffsetB()
+        {
+            // B data will start right after A data
+            return GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::sizeLdsA()
+        {
+            auto macroTileC = GlobalMapping::macroTileSizeC();
+            return make_coord2d(get<0>(macroTileC), LdsWidth);
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::sizeLdsB()
+        {
+            auto macroTileC = GlobalMapping::macroTileSizeC();
+            return make_coord2d(get<1>(macroTileC), LdsWidth);
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::ldLdsA()
+        {
+            return DataLayout::leadingDim(sizeLdsA());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::ldLdsB()
+        {
+            return DataLayout::leadingDim(sizeLdsB());
+        }
+
 #undef LdsMappingT
 #undef LdsMappingT_impl
 
@@ -42,7 +42,9 @@ namespace rocwmma
               uint32_t TBlockX,
               uint32_t TBlockY,
               uint32_t WaveSize,
-              uint32_t ArchId>
+              uint32_t ArchId,
+              uint32_t MaxThreadsPerBlock = 256u,
+              uint32_t WavesPerEu         = 1u>
     struct GemmPredicatesBase
     {
         using TestTraits = GemmTestTraits<BlockM,
@@ -57,6 +59,23 @@ namespace rocwmma
                                           ArchId>;
 
     protected:
+        enum struct LaunchParams : uint32_t
+        {
+            // Waves in a full thread block, spread over the 4 SIMDs of a CU
+            WavesPerBlock = MaxThreadsPerBlock / WaveSize,
+            WavesPerSimd  = ceilDiv((uint32_t)WavesPerBlock, 4u),
+
+            // Occupancy the compiler must meet: at least one full thread block
+            // and the requested waves per EU.
+            MinWavesPerEu = std::max(std::max((uint32_t)WavesPerSimd, WavesPerEu), 1u),
+
+            // VGPRs per SIMD lane: 512 on gfx9 (VGPR + AGPR), 1024 on gfx11
+            RegisterFile = (bool)TestTraits::Arch::IsGfx11 ? 1024u : 512u,
+
+            // Per-thread register budget for the kernel tiles, at most 256
+            RegisterBudget = std::min(256u, (uint32_t)RegisterFile / (uint32_t)MinWavesPerEu),
+        };
+
         enum struct GlobalPredicates : bool
         {
             // ThreadblockX must be a multiple of the wave size
@@ -65,6 +84,12 @@ namespace rocwmma
             // Ensure that we have at least 1 wave
             MinTBlockTest = (TBlockX >= WaveSize && TBlockY >= 1),
 
+            // Thread block must fit the kernel launch bounds, which are
+            // limited to whole waves and 1024 threads per block.
+            LaunchBoundsTest = (TBlockX * TBlockY <= MaxThreadsPerBlock)
+                               && (MaxThreadsPerBlock % WaveSize == 0u)
+                               && (MaxThreadsPerBlock <= 1024u) && (WavesPerEu >= 1u),
+
             // Ensure that we only build for the current compiler target, which
             // will also exclude the host.
             CurrentArchTest = (ArchId == Constants::AMDGCN_CURRENT_ARCH_ID),
@@ -77,13 +102,13 @@ namespace rocwmma
 
             // During the build phase, we have information about current target arch.
             // This means only the current arch and wave size are valid.
-            EnableBuild
-            = (TBlockXTest && MinTBlockTest && CurrentArchTest && CurrentWaveSizeTest && ArchTest),
+            EnableBuild = (TBlockXTest && MinTBlockTest && LaunchBoundsTest && CurrentArchTest
+                           && CurrentWaveSizeTest && ArchTest),
 
             // During run phase on the host, we don't have compile time info about current arch or wave size.
             // We have to trust that the runtime params obtained through HipDevice will dispatch correctly for
             // the current arch and wave size.
-            EnableRun = (TBlockXTest && MinTBlockTest && ArchTest),
+            EnableRun = (TBlockXTest && MinTBlockTest && LaunchBoundsTest && ArchTest),
         };
 
 #if !NDEBUG
@@ -92,6 +117,8 @@ namespace rocwmma
             std::cout << "Global Predicates:\n";
             std::cout << "TBlockXTest: " << (bool)GlobalPredicates::TBlockXTest << std::endl;
             std::cout << "MinTBlockTest: " << (bool)GlobalPredicates::MinTBlockTest << std::endl;
+            std::cout << "LaunchBoundsTest: " << (bool)GlobalPredicates::LaunchBoundsTest
+                      << std::endl;
             std::cout << "ArchTest: " << (bool)GlobalPredicates::ArchTest << std::endl;
             std::cout << "EnableBuild: " << (bool)GlobalPredicates::EnableBuild << std::endl;
             std::cout << "EnableRun: " << (bool)GlobalPredicates::EnableRun << std::endl;
@@ -104,8 +131,12 @@ namespace rocwmma
 
             WaveSizeTest = (bool)TestTraits::Arch::IsWave64,
 
-            TBlockTest
-            = (TBlockX * TBlockY >= Constants::AMDGCN_WAVE_SIZE_64) && (TBlockX * TBlockY <= 256u),
+            TBlockTest = (TBlockX * TBlockY >= Constants::AMDGCN_WAVE_SIZE_64)
+                         && (TBlockX * TBlockY <= MaxThreadsPerBlock),
+
+            // Max waves per SIMD is 10 on gfx908, 8 on later gfx9
+            WavesPerEuTest = (uint32_t)LaunchParams::MinWavesPerEu
+                             <= ((bool)TestTraits::Arch::IsGfx908 ? 10u : 8u),
 
             InputTypesTest
             = (bool)TestTraits::InputType::IsFloat8 || (bool)TestTraits::InputType::IsBFloat8
@@ -199,10 +230,10 @@ namespace rocwmma
                                || ((bool)TestTraits::BlockSizes::isBlockMN16 && (BlockK >= 4u)
                                    && (BlockK % 4u == 0u)),
 
-            Enable = (ArchTest && WaveSizeTest && TBlockTest && InputTypesTest && F8XF32ArchTest
-                      && F64ArchTest && I8BlockSizeTest && Gfx940I8BlockSizeTest && F8BlockSizeTest
-                      && F16BlockSizeTest && Gfx908BF16BlockSizeTest && F32BlockSizeTest
-                      && XF32BlockSizeTest && F64BlockSizeTest)
+            Enable = (ArchTest && WaveSizeTest && TBlockTest && WavesPerEuTest && InputTypesTest
+                      && F8XF32ArchTest && F64ArchTest && I8BlockSizeTest && Gfx940I8BlockSizeTest
+                      && F8BlockSizeTest && F16BlockSizeTest && Gfx908BF16BlockSizeTest
+                      && F32BlockSizeTest && XF32BlockSizeTest && F64BlockSizeTest)
         };
 
 #if !NDEBUG
@@ -212,6 +243,7 @@ namespace rocwmma
             std::cout << "ArchTest: " << (bool)Gfx9Predicates::ArchTest << std::endl;
             std::cout << "WaveSizeTest: " << (bool)Gfx9Predicates::WaveSizeTest << std::endl;
             std::cout << "TBlockTest: " << (bool)Gfx9Predicates::TBlockTest << std::endl;
+            std::cout << "WavesPerEuTest: " << (bool)Gfx9Predicates::WavesPerEuTest << std::endl;
             std::cout << "InputTypesTest: " << (bool)Gfx9Predicates::InputTypesTest << std::endl;
             std::cout << "F8XF32ArchTest: " << (bool)Gfx9Predicates::F8XF32ArchTest << std::endl;
             std::cout << "F64ArchTest: " << (bool)Gfx9Predicates::F64ArchTest << std::endl;
@@ -241,9 +273,12 @@ namespace rocwmma
             // Wave size on gfx11 is 32
             WaveSizeTest = (bool)TestTraits::Arch::IsWave32,
 
-            // Max recommended TBlock size is 256
-            TBlockTest
-            = (TBlockX * TBlockY >= Constants::AMDGCN_WAVE_SIZE_32) && (TBlockX * TBlockY <= 256u),
+            // TBlock size is capped by the launch bounds
+            TBlockTest = (TBlockX * TBlockY >= Constants::AMDGCN_WAVE_SIZE_32)
+                         && (TBlockX * TBlockY <= MaxThreadsPerBlock),
+
+            // Max waves per SIMD is 16 on gfx11
+            WavesPerEuTest = (uint32_t)LaunchParams::MinWavesPerEu <= 16u,
 
             // Input types supported
             InputTypesTest = (bool)TestTraits::InputType::IsInt8
@@ -263,8 +298,8 @@ namespace rocwmma
               || ((bool)TestTraits::BlockSizes::isBlockMN16 && (BlockK >= 16u)
                   && (BlockK % 16u == 0u)),
 
-            Enable = (ArchTest && WaveSizeTest && TBlockTest && InputTypesTest && I8BlockSizeTest
-                      && F16BlockSizeTest)
+            Enable = (ArchTest && WaveSizeTest && TBlockTest && WavesPerEuTest && InputTypesTest
+                      && I8BlockSizeTest && F16BlockSizeTest)
         };
 
 #if !NDEBUG
@@ -274,6 +309,8 @@ namespace rocwmma
             std::cout << "ArchTest: " << (bool)Gfx11Predicates::ArchTest << std::endl;
             std::cout << "WaveSizeTest: " << (bool)Gfx11Predicates::WaveSizeTest << std::endl;
             std::cout << "TBlockTest: " << (bool)Gfx11Predicates::TBlockTest << std::endl;
+            std::cout << "WavesPerEuTest: " << (bool)Gfx11Predicates::WavesPerEuTest
+                      << std::endl;
             std::cout << "InputTypesTest: " << (bool)Gfx11Predicates::InputTypesTest << std::endl;
             std::cout << "I8BlockSizeTest: " << (bool)Gfx11Predicates::I8BlockSizeTest << std::endl;
             std::cout << "F16BlockSizeTest: " << (bool)Gfx11Predicates::F16BlockSizeTest
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GEMM_RING_BUFFER_HPP
+#define GEMM_RING_BUFFER_HPP
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace CooperativeGemm
+    {
+        /* RingBuffer class:
+        *  Protocol for producer / consumer waves sharing a ring of Slots LDS blocks.
+        *  K step i lives in slot (i % Slots), and each slot has two monotonic counters
+        *  in LDS that count wave arrivals:
+        *  - full[slot]:  producer waves that finished writing the slot
+        *  - empty[slot]: consumer waves that finished reading the slot
+        *
+        *  Producers of step i wait until every consumer has read step (i - Slots),
+        *  write the slot and signal full. Consumers of step i wait until every producer
+        *  has written step i, read the slot and signal empty. Counters are never reset,
+        *  so each wait compares against the number of arrivals expected for that lap.
+        *
+        *  Counter arithmetic is host-callable, so that the protocol can be simulated.
+        *
+        *  LDS flag layout: [full[0] ... full[Slots - 1], empty[0] ... empty[Slots - 1]]
+        */
+        template <uint32_t Slots>
+        struct RingBuffer
+        {
+            static_assert(Slots > 0u, "Ring buffer requires at least one slot");
+
+            // Slot of the given K step
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t slot(uint32_t step)
+            {
+                return step % Slots;
+            }
+
+            // Arrivals on empty[slot(step)] before producers may overwrite the slot with step
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t emptyCount(uint32_t step,
+                                                                            uint32_t consumers)
+            {
+                return (step / Slots) * consumers;
+            }
+
+            // Arrivals on full[slot(step)] before consumers may read step from the slot
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t fullCount(uint32_t step,
+                                                                           uint32_t producers)
+            {
+                return (step / Slots + 1u) * producers;
+            }
+
+            // Number of uint32_t counters in LDS
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t flagCount()
+            {
+                return 2u * Slots;
+            }
+
+            // Zero all counters. Must be followed by a workgroup barrier.
+            __device__ static inline void init(uint32_t* flags, uint32_t threadIndex)
+            {
+                if(threadIndex < flagCount())
+                {
+                    flags[threadIndex] = 0u;
+                }
+            }
+
+            __device__ static inline void
+                waitFull(uint32_t* flags, uint32_t step, uint32_t producers)
+            {
+                wait(flags + slot(step), fullCount(step, producers));
+            }
+
+            __device__ static inline void signalFull(uint32_t* flags, uint32_t step)
+            {
+                signal(flags + slot(step));
+            }
+
+            __device__ static inline void
+                waitEmpty(uint32_t* flags, uint32_t step, uint32_t consumers)
+            {
+                wait(flags + Slots + slot(step), emptyCount(step, consumers));
+            }
+
+            __device__ static inline void signalEmpty(uint32_t* flags, uint32_t step)
+            {
+                signal(flags + Slots + slot(step));
+            }
+
+        private:
+            // Acquire makes the other role's LDS traffic visible before we proceed.
+            __device__ static inline void wait(uint32_t* flag, uint32_t count)
+            {
+                while(__hip_atomic_load(flag, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_WORKGROUP)
+                      < count)
+                {
+                    __builtin_amdgcn_s_sleep(1);
+                }
+            }
+
+            // Every lane releases its LDS reads / writes to the workgroup,
+            // then one lane arrives on behalf of the whole wave.
+            __device__ static inline void signal(uint32_t* flag)
+            {
+                __builtin_amdgcn_fence(__ATOMIC_RELEASE, "workgroup");
+                if(__lane_id() == 0u)
+                {
+                    __hip_atomic_fetch_add(
+                        flag, 1u, __ATOMIC_RELEASE, __HIP_MEMORY_SCOPE_WORKGROUP);
+                }
+            }
+        };
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#endif // GEMM_RING_BUFFER_HPP
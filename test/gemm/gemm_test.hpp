@@ -36,14 +36,14 @@
 namespace rocwmma
 {
     struct GemmTest
-        : public ::testing::TestWithParam<std::tuple<typename GemmCommonTestParams::KernelT,
+        : public ::testing::TestWithParam<std::tuple<typename GemmCommonTestParams::KernelFactoryT,
                                                      typename GemmCommonTestParams::ThreadBlockT,
                                                      typename GemmCommonTestParams::ProblemSizeT,
                                                      typename GemmCommonTestParams::AlphaT,
                                                      typename GemmCommonTestParams::BetaT>>
     {
         using Base
-            = ::testing::TestWithParam<std::tuple<typename GemmCommonTestParams::KernelT,
+            = ::testing::TestWithParam<std::tuple<typename GemmCommonTestParams::KernelFactoryT,
                                                   typename GemmCommonTestParams::ThreadBlockT,
                                                   typename GemmCommonTestParams::ProblemSizeT,
                                                   typename GemmCommonTestParams::AlphaT,
@@ -68,22 +68,25 @@
 /// test_param_triage: triage of parameters delivered to tests (e.g macro to match test_interface with runtime params)
 /// test_params: testing parameters used to generate the test suite
 ///
-#define ROCWMMA_INSTANTIATE_GTEST_SUITE(test_suite_prefix, \
-                                        test_suite_name,   \
-                                        test_interface,    \
-                                        test_invoke,       \
-                                        test_param_triage, \
-                                        test_params)       \
-    class test_suite_name : public test_interface          \
-    {                                                      \
-    };                                                     \
-                                                           \
-    TEST_P(test_suite_name, test_invoke)                   \
-    {                                                      \
-        this->test_invoke();                               \
-    }                                                      \
-                                                           \
-    INSTANTIATE_TEST_SUITE_P(test_suite_prefix, test_suite_name, test_param_triage(test_params));
+#define ROCWMMA_INSTANTIATE_GTEST_SUITE(test_suite_prefix,                                        \
+                                        test_suite_name,                                          \
+                                        test_interface,                                           \
+                                        test_invoke,                                              \
+                                        test_param_triage,                                        \
+                                        test_params)                                              \
+    class test_suite_name : public test_interface                                                 \
+    {                                                                                             \
+    };                                                                                            \
+                                                                                                  \
+    TEST_P(test_suite_name, test_invoke)                                                          \
+    {                                                                                             \
+        this->test_invoke();                                                                      \
+    }                                                                                             \
+                                                                                                  \
+    INSTANTIATE_TEST_SUITE_P(test_suite_prefix, test_suite_name, test_param_triage(test_params)); \
+                                                                                                  \
+    /* The --kernel filter may remove every kernel of a suite */                                  \
+    GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(test_suite_name);
 
 ///
 /// Triage of test parameters, specific to GEMM gtests.
@@ -26,6 +26,7 @@
 
 #include "hip_device.hpp"
 #include "common.hpp"
+#include "rocwmma_logging.hpp"
 
 namespace rocwmma
 {
@@ -36,6 +37,7 @@ namespace rocwmma
         , mSharedMemSize(0)
         , mCuCount(0)
         , mMaxFreqMhz(0)
+        , mSmiInit(false)
         , mCurFreqMhz(0)
     {
         CHECK_HIP_ERROR(hipGetDevice(&mHandle));
@@ -90,10 +92,14 @@ namespace rocwmma
         mCuCount       = mProps.multiProcessorCount;
         mMaxFreqMhz    = static_cast<int>(static_cast<double>(mProps.clockRate) / 1000.0);
         mCurFreqMhz    = mMaxFreqMhz;
+    }
 
+    void HipDevice::querySmiFreqMhz() const
+    {
 #if ROCWMMA_BENCHMARK_TESTS
         bool smiErrorFlag = false;
         CHECK_RSMI_ERROR(rsmi_init(0), smiErrorFlag);
+        mSmiInit = !smiErrorFlag;
         if(!smiErrorFlag)
         {
             uint64_t hipPCIID = 0;
@@ -137,6 +143,16 @@ namespace rocwmma
 #endif // ROCWMMA_BENCHMARK_TESTS
     }
 
+    void HipDevice::loadCalibration() const
+    {
+        auto const& fileName = RocwmmaLogging::instance()->calibrationFile();
+        if(!fileName.empty() && !mCalibration.loadFile(fileName))
+        {
+            std::cerr << "Cannot load calibration file " << fileName << ", using built-in peaks"
+                      << std::endl;
+        }
+    }
+
     hipDevice_t HipDevice::getDeviceHandle() const
     {
         return mHandle;
@@ -179,14 +195,31 @@ namespace rocwmma
 
     int HipDevice::curFreqMhz() const
     {
+        std::call_once(mSmiQueried, [this]() { querySmiFreqMhz(); });
         return mCurFreqMhz;
     }
 
+    PerfCalibration const& HipDevice::calibration() const
+    {
+        std::call_once(mCalibrationLoaded, [this]() { loadCalibration(); });
+        return mCalibration;
+    }
+
+    double HipDevice::peakGBytesPerSec() const
+    {
+        // Double data rate memory clock (kHz) over the bus width (bits)
+        return 2.0 * static_cast<double>(mProps.memoryClockRate) * 1.0e3
+               * static_cast<double>(mProps.memoryBusWidth) / 8.0 / 1.0e9;
+    }
+
     HipDevice::~HipDevice()
     {
 #if ROCWMMA_BENCHMARK_TESTS
-        bool smiErrorFlag = false;
-        CHECK_RSMI_ERROR(rsmi_shut_down(), smiErrorFlag);
+        if(mSmiInit)
+        {
+            bool smiErrorFlag = false;
+            CHECK_RSMI_ERROR(rsmi_shut_down(), smiErrorFlag);
+        }
 #endif // ROCWMMA_BENCHMARK_TESTS
     }
 
@@ -27,11 +27,14 @@
 #ifndef ROCWMMA_TEST_HIP_DEVICE_HPP
 #define ROCWMMA_TEST_HIP_DEVICE_HPP
 
+#include <mutex>
+
 #include <hip/hip_runtime.h>
 #include <hip/hip_runtime_api.h>
 #include <rocm_smi/rocm_smi.h>
 #include <rocwmma/internal/constants.hpp>
 
+#include "perf_calibration.hpp"
 #include "performance.hpp"
 #include "singleton.hpp"
 
@@ -77,13 +80,27 @@ namespace rocwmma
         int sharedMemSize() const;
         int cuCount() const;
         int maxFreqMhz() const;
+
+        // Queries rocm_smi on first use, so that startup
+        // does not pay for it unless efficiency is reported.
         int curFreqMhz() const;
 
+        // Measured peaks from the calibration file, loaded on first use.
+        // Empty if there is no file, in which case built-in peaks are used.
+        PerfCalibration const& calibration() const;
+
         template <typename InputT>
         double peakGFlopsPerSec() const;
 
+        // Theoretical DRAM bandwidth
+        double peakGBytesPerSec() const;
+
         ~HipDevice();
 
+    private:
+        void querySmiFreqMhz() const;
+        void loadCalibration() const;
+
     private:
         hipDevice_t     mHandle;
         hipDeviceProp_t mProps;
@@ -93,25 +110,37 @@ namespace rocwmma
         int             mSharedMemSize;
         int             mCuCount;
         int             mMaxFreqMhz;
-        int             mCurFreqMhz;
+
+        // Lazily queried from rocm_smi
+        mutable std::once_flag mSmiQueried;
+        mutable bool           mSmiInit;
+        mutable int            mCurFreqMhz;
+
+        // Lazily loaded from the calibration file
+        mutable std::once_flag  mCalibrationLoaded;
+        mutable PerfCalibration mCalibration;
     };
 
     template <typename InputT>
     double HipDevice::peakGFlopsPerSec() const
     {
-        double result = -1.0;
+        double result  = -1.0;
+        auto   freqMhz = curFreqMhz();
+        auto   arch    = PerfCalibration::archKey(mProps.gcnArchName);
         switch(mGcnArch)
         {
         case hipGcnArch_t::GFX908:
-            result = calculatePeakGFlopsPerSec<InputT, ArchGfx908>(mCurFreqMhz, mCuCount);
+            result = calculatePeakGFlopsPerSec<InputT, ArchGfx908>(
+                calibration(), arch, freqMhz, mCuCount);
             break;
 
         case hipGcnArch_t::GFX90A:
-            result = calculatePeakGFlopsPerSec<InputT, ArchGfx90a>(mCurFreqMhz, mCuCount);
+            result = calculatePeakGFlopsPerSec<InputT, ArchGfx90a>(
+                calibration(), arch, freqMhz, mCuCount);
             break;
 
         default:
-            result = calculatePeakGFlopsPerSec<InputT>(mCurFreqMhz, mCuCount);
+            result = calculatePeakGFlopsPerSec<InputT>(calibration(), arch, freqMhz, mCuCount);
         }
         return result;
     }
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_HOST_TASK_POOL_HPP
+#define ROCWMMA_TEST_HOST_TASK_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "singleton.hpp"
+
+// HostTaskPool is a small, fixed size pool of host worker threads.
+//
+// It is used to overlap host-side test work (e.g. CPU reference GEMM) with
+// device work issued from the test thread. Tasks return a future that the
+// test thread joins on before consuming the results, so that gtest still
+// attributes every expectation to the test that produced it.
+//
+// The number of tasks in flight (queued or running) is bounded. Each task
+// typically owns a set of host buffers, so the bound also caps host memory
+// held by pending work. Submitting past the bound blocks the caller until
+// an earlier task retires.
+//
+// The worker count may be set with the ROCWMMA_TEST_HOST_THREADS environment
+// variable; by default one worker is used, as the CPU reference is already
+// multi-threaded internally.
+
+namespace rocwmma
+{
+    class HostTaskPool : public LazySingleton<HostTaskPool>
+    {
+    public:
+        HostTaskPool()
+            : HostTaskPool(defaultWorkers())
+        {
+        }
+
+        HostTaskPool(uint32_t workers, uint32_t maxInFlight = 0u)
+            : mMaxInFlight(maxInFlight == 0u ? 2u * std::max(workers, 1u) : maxInFlight)
+            , mInFlight(0u)
+            , mPeakInFlight(0u)
+            , mShutdown(false)
+        {
+            workers = std::max(workers, 1u);
+            mWorkers.reserve(workers);
+            for(uint32_t i = 0; i < workers; i++)
+            {
+                mWorkers.emplace_back([this]() { workerLoop(); });
+            }
+        }
+
+        // No copy or move: workers capture this.
+        HostTaskPool(HostTaskPool const&)            = delete;
+        HostTaskPool& operator=(HostTaskPool const&) = delete;
+
+        ~HostTaskPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mShutdown = true;
+            }
+            mTaskReady.notify_all();
+            mSlotFree.notify_all();
+
+            // Remaining queued tasks are drained before the workers exit.
+            for(auto& worker : mWorkers)
+            {
+                worker.join();
+            }
+        }
+
+        // Queue a task for a worker thread.
+        // Blocks while maxInFlight() tasks are queued or running.
+        // Exceptions thrown by the task are re-thrown from future::get().
+        std::future<void> submit(std::function<void()> task)
+        {
+            std::packaged_task<void()> job(std::move(task));
+            auto                       result = job.get_future();
+
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mSlotFree.wait(lock, [this]() { return mInFlight < mMaxInFlight; });
+
+                mInFlight++;
+                mPeakInFlight = std::max(mPeakInFlight, mInFlight);
+                mQueue.push_back(std::move(job));
+            }
+            mTaskReady.notify_one();
+
+            return result;
+        }
+
+        // Block until every submitted task has retired.
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mSlotFree.wait(lock, [this]() { return mInFlight == 0u; });
+        }
+
+        uint32_t workers() const
+        {
+            return static_cast<uint32_t>(mWorkers.size());
+        }
+
+        uint32_t maxInFlight() const
+        {
+            return mMaxInFlight;
+        }
+
+        // High-water mark of tasks in flight
+        uint32_t peakInFlight()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mPeakInFlight;
+        }
+
+    private:
+        static uint32_t defaultWorkers()
+        {
+            if(auto* env = std::getenv("ROCWMMA_TEST_HOST_THREADS"))
+            {
+                return static_cast<uint32_t>(std::max(std::atoi(env), 1));
+            }
+            return 1u;
+        }
+
+        void workerLoop()
+        {
+            while(true)
+            {
+                std::packaged_task<void()> job;
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mTaskReady.wait(lock, [this]() { return mShutdown || !mQueue.empty(); });
+
+                    if(mQueue.empty())
+                    {
+                        return;
+                    }
+
+                    job = std::move(mQueue.front());
+                    mQueue.pop_front();
+                }
+
+                // packaged_task captures any exception into the future
+                job();
+
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mInFlight--;
+                }
+                mSlotFree.notify_all();
+            }
+        }
+
+    private:
+        uint32_t mMaxInFlight;
+        uint32_t mInFlight;
+        uint32_t mPeakInFlight;
+        bool     mShutdown;
+
+        std::mutex                             mMutex;
+        std::condition_variable                mTaskReady;
+        std::condition_variable                mSlotFree;
+        std::deque<std::packaged_task<void()>> mQueue;
+        std::vector<std::thread>               mWorkers;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_HOST_TASK_POOL_HPP
@@ -27,9 +27,18 @@
 #ifndef ROCWMMA_KERNEL_GENERATOR_HPP
 #define ROCWMMA_KERNEL_GENERATOR_HPP
 
+#include <cstdlib>
+#include <cxxabi.h>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <vector>
 
+#include "rocwmma_logging.hpp"
+
 namespace rocwmma
 {
 
@@ -52,8 +61,9 @@ namespace rocwmma
     /// This is the responsibility of the kernel generator
     /// implementation (KernelGeneratorImpl).
     ///
-    /// 3. Instantiate each set of KernelParams with the impl,
-    /// and return a vector of kernels.
+    /// 3. Wrap each set of KernelParams in a lazy factory that
+    /// instantiates the kernel with the impl on first use,
+    /// and return a vector of kernel factories.
     ///
     /// The following utilities are used to build (1).
     /// - Concat<>
@@ -62,9 +72,11 @@ namespace rocwmma
     /// - CombineLists<>
     ///
     /// for 2) and 3) KernelGenerator class takes the
-    /// KernelGeneratorImpl and instantiates one kernel
+    /// KernelGeneratorImpl and creates one kernel factory
     /// per tuple of KernelParams from TestParams (1). It
-    /// returns the kernels as a vector<KernelI>.
+    /// returns the factories as a vector<KernelFactory>.
+    /// Kernels not matching the --kernel filter are dropped
+    /// before any factory is created.
 
     /// There are several classes that provide functionality
     /// to build combinations of basic types.
@@ -212,6 +224,101 @@ namespace rocwmma
         using Result = List;
     };
 
+    /// KernelFactory: lazily constructed kernel instance.
+    /// Holds a readable parameter key and the function that builds
+    /// the kernel. The kernel is only built on first access, so that
+    /// tests removed by --gtest_filter never pay for construction.
+    /// gtest copies parameters for every test, so copies share the
+    /// same instance.
+    template <typename KernelPtrT>
+    class KernelFactory
+    {
+    public:
+        using FactoryFunc = std::function<KernelPtrT()>;
+        using ElementT    = typename KernelPtrT::element_type;
+
+        KernelFactory(std::string const& key, FactoryFunc factory)
+            : mState(std::make_shared<State>(State{key, std::move(factory), KernelPtrT()}))
+        {
+        }
+
+        std::string const& key() const
+        {
+            return mState->key;
+        }
+
+        bool isConstructed() const
+        {
+            return static_cast<bool>(mState->instance);
+        }
+
+        KernelPtrT const& instance() const
+        {
+            if(!mState->instance)
+            {
+                mState->instance = mState->factory();
+            }
+            return mState->instance;
+        }
+
+        ElementT* get() const
+        {
+            return instance().get();
+        }
+
+        ElementT* operator->() const
+        {
+            return get();
+        }
+
+        ElementT& operator*() const
+        {
+            return *get();
+        }
+
+    private:
+        struct State
+        {
+            std::string key;
+            FactoryFunc factory;
+            KernelPtrT  instance;
+        };
+
+        std::shared_ptr<State> mState;
+    };
+
+    // gtest prints the key for params, rather than constructing the kernel
+    template <typename KernelPtrT>
+    inline std::ostream& operator<<(std::ostream& stream, KernelFactory<KernelPtrT> const& kernel)
+    {
+        return stream << kernel.key();
+    }
+
+    /// Readable key of a KernelParams tuple, used to identify
+    /// and filter kernels without constructing them. E.g.
+    /// tuple<float, float, float, I<16u>, I<16u>, I<16u>, row_major, ...>
+    template <typename KernelParams>
+    inline std::string kernelParamsKey()
+    {
+        std::string key    = typeid(KernelParams).name();
+        int         status = 0;
+        if(auto* demangled = abi::__cxa_demangle(key.c_str(), nullptr, nullptr, &status))
+        {
+            key = demangled;
+            std::free(demangled);
+        }
+
+        // Namespaces only add noise to the filter
+        for(std::string const ns : {"rocwmma::", "std::"})
+        {
+            for(auto pos = key.find(ns); pos != std::string::npos; pos = key.find(ns, pos))
+            {
+                key.erase(pos, ns.size());
+            }
+        }
+        return key;
+    }
+
     /// Kernel Generator
     /// Requires two inputs:
     /// TestParams: nested tuple of KernelParams
@@ -221,7 +328,7 @@ namespace rocwmma
     ///
     /// NOTE: The GeneratorImpl class decides the final
     /// generated kernel instantiated type. This class
-    /// simply returns a vector of generated kernels of
+    /// simply returns a vector of lazy factories of
     /// this type.
     template <typename TestParams, class GeneratorImpl>
     struct KernelGenerator
@@ -235,7 +342,8 @@ namespace rocwmma
     template <typename KernelParams, typename... Next, class GeneratorImpl>
     struct KernelGenerator<std::tuple<KernelParams, Next...>, GeneratorImpl>
     {
-        using ResultT = std::vector<typename GeneratorImpl::ResultT>;
+        using FactoryT = KernelFactory<typename GeneratorImpl::ResultT>;
+        using ResultT  = std::vector<FactoryT>;
         static ResultT generate()
         {
             auto result = ResultT();
@@ -245,8 +353,13 @@ namespace rocwmma
 
         static void generate(ResultT& kernels)
         {
-            // Generate kernels
-            kernels.push_back(GeneratorImpl::generate(KernelParams()));
+            // Generate kernel factories. Kernels are constructed on first use.
+            auto key = kernelParamsKey<KernelParams>();
+            if(RocwmmaLogging::instance()->kernelFilter(key))
+            {
+                kernels.push_back(
+                    FactoryT(key, []() { return GeneratorImpl::generate(KernelParams()); }));
+            }
             KernelGenerator<std::tuple<Next...>, GeneratorImpl>::generate(kernels);
         }
     };
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_PERF_CALIBRATION_HPP
+#define ROCWMMA_TEST_PERF_CALIBRATION_HPP
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <rocwmma/internal/utils.hpp>
+
+#include "performance.hpp"
+
+namespace rocwmma
+{
+    // Measured mma peaks in flops / CU / clock, keyed by gfx arch and input type.
+    // These override the built-in MfmaPerfTraits multipliers at runtime.
+    //
+    // The file format is one entry per line, as written by the mma calibration
+    // suite: <arch>,<datatype>,<multiplier>
+    //
+    // E.g.:
+    // # rocWMMA mma calibration
+    // gfx942,f16,2048
+    //
+    // The arch is the gcnArchName without features, and the datatype follows
+    // dataTypeToString. Blank lines and '#' comments are ignored.
+    class PerfCalibration
+    {
+    public:
+        using KeyT = std::pair<std::string, std::string>;
+
+        // Merges the entries of the stream, overriding any existing keys.
+        // Returns false on a malformed line, in which case nothing is merged.
+        bool load(std::istream& stream)
+        {
+            std::map<KeyT, double> entries;
+            std::string            line;
+
+            while(std::getline(stream, line))
+            {
+                line = trim(line.substr(0, line.find('#')));
+                if(line.empty())
+                {
+                    continue;
+                }
+
+                std::stringstream ss(line);
+                std::string       arch, dataType, value, extra;
+                if(!std::getline(ss, arch, ',') || !std::getline(ss, dataType, ',')
+                   || !std::getline(ss, value, ',') || std::getline(ss, extra, ','))
+                {
+                    return false;
+                }
+
+                arch     = trim(arch);
+                dataType = trim(dataType);
+                value    = trim(value);
+
+                double multiplier = -1.0;
+                if(arch.empty() || dataType.empty() || !parseMultiplier(value, multiplier))
+                {
+                    return false;
+                }
+
+                entries[std::make_pair(arch, dataType)] = multiplier;
+            }
+
+            for(auto const& entry : entries)
+            {
+                mMultipliers[entry.first] = entry.second;
+            }
+            return true;
+        }
+
+        // Returns false if the file cannot be opened, or is malformed
+        bool loadFile(std::string const& fileName)
+        {
+            std::ifstream file(fileName);
+            return file.is_open() && load(file);
+        }
+
+        void write(std::ostream& stream) const
+        {
+            stream << "# rocWMMA mma calibration: <arch>,<datatype>,<flops/CU/clock>\n";
+            for(auto const& entry : mMultipliers)
+            {
+                stream << entry.first.first << "," << entry.first.second << ","
+                       << std::setprecision(std::numeric_limits<double>::max_digits10)
+                       << entry.second << "\n";
+            }
+        }
+
+        bool writeFile(std::string const& fileName) const
+        {
+            std::ofstream file(fileName);
+            if(!file.is_open())
+            {
+                return false;
+            }
+            write(file);
+            return file.good();
+        }
+
+        // Overrides any existing keys with the entries of other
+        void merge(PerfCalibration const& other)
+        {
+            for(auto const& entry : other.mMultipliers)
+            {
+                mMultipliers[entry.first] = entry.second;
+            }
+        }
+
+        void set(std::string const& arch, std::string const& dataType, double multiplier)
+        {
+            mMultipliers[std::make_pair(arch, dataType)] = multiplier;
+        }
+
+        // Negative if there is no entry for the arch and datatype
+        double multiplier(std::string const& arch, std::string const& dataType) const
+        {
+            auto it = mMultipliers.find(std::make_pair(arch, dataType));
+            return it != mMultipliers.end() ? it->second : -1.0;
+        }
+
+        size_t size() const
+        {
+            return mMultipliers.size();
+        }
+
+        bool empty() const
+        {
+            return mMultipliers.empty();
+        }
+
+        void clear()
+        {
+            mMultipliers.clear();
+        }
+
+        // Strips target features from the gcnArchName
+        // E.g. gfx942:sramecc+:xnack- -> gfx942
+        static std::string archKey(std::string const& gcnArchName)
+        {
+            return gcnArchName.substr(0, gcnArchName.find(':'));
+        }
+
+    private:
+        static std::string trim(std::string const& str)
+        {
+            auto first = str.find_first_not_of(" \t\r\n");
+            if(first == std::string::npos)
+            {
+                return std::string();
+            }
+            auto last = str.find_last_not_of(" \t\r\n");
+            return str.substr(first, last - first + 1u);
+        }
+
+        // Multipliers must be finite, non-negative numbers with no trailing characters
+        static bool parseMultiplier(std::string const& str, double& result)
+        {
+            std::istringstream ss(str);
+            ss >> result;
+            return !ss.fail() && ss.eof() && std::isfinite(result) && result >= 0.0;
+        }
+
+    private:
+        std::map<KeyT, double> mMultipliers;
+    };
+
+    // Peak from the calibrated multiplier of the arch and InputT if there is one,
+    // otherwise from the built-in PerfTraits.
+    template <typename InputT,
+              typename GfxArch                               = DefaultArch,
+              template <typename, typename> class PerfTraits = rocwmma::MfmaPerfTraits>
+    inline double calculatePeakGFlopsPerSec(PerfCalibration const& calibration,
+                                            std::string const&     arch,
+                                            uint32_t               freqMHz,
+                                            uint32_t               cuCount)
+    {
+        auto multiplier = calibration.multiplier(arch, dataTypeToString<InputT>());
+        return multiplier >= 0.0
+                   ? calculatePeakGFlopsPerSec(multiplier, freqMHz, cuCount)
+                   : calculatePeakGFlopsPerSec<InputT, GfxArch, PerfTraits>(freqMHz, cuCount);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_PERF_CALIBRATION_HPP
@@ -378,13 +378,19 @@ namespace rocwmma
         return calculateGFlops(m, n, k) / elapsedTimeMs;
     }
 
+    // Multiplier in flops / CU / clock, e.g. from a PerfCalibration file
+    inline double calculatePeakGFlopsPerSec(double multiplier, uint32_t freqMHz, uint32_t cuCount)
+    {
+        return multiplier * static_cast<double>(cuCount) * static_cast<double>(freqMHz) * 1.0e-3;
+    }
+
     template <typename InputT,
               typename GfxArch                               = DefaultArch,
               template <typename, typename> class PerfTraits = rocwmma::MfmaPerfTraits>
     inline double calculatePeakGFlopsPerSec(uint32_t freqMHz, uint32_t cuCount)
     {
-        return static_cast<double>(PerfTraits<GfxArch, InputT>::Multiplier)
-               * static_cast<double>(cuCount) * static_cast<double>(freqMHz) * 1.0e-3;
+        return calculatePeakGFlopsPerSec(
+            static_cast<double>(PerfTraits<GfxArch, InputT>::Multiplier), freqMHz, cuCount);
     }
 
 } // namespace rocwmma
@@ -64,6 +64,16 @@ namespace rocwmma
                       uint32_t     k,
                       uint32_t     batchSize);
 
+    template <typename DataT>
+    void dlrm_mlp_fwd_CPU(DataT const* input,
+                          DataT const* weights,
+                          DataT const* bias,
+                          DataT*       output,
+                          uint32_t     m,
+                          uint32_t     k,
+                          uint32_t     layers,
+                          uint32_t     batchSize);
+
     template <uint32_t ElementIdx,
               uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
@@ -26,6 +26,9 @@
 #ifndef ROCWMMA_REFERENCE_IMPL_HPP
 #define ROCWMMA_REFERENCE_IMPL_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include "hip_device.hpp"
 #include "reference.hpp"
 #include <rocwmma/internal/pack_util.hpp>
@@ -178,6 +181,49 @@ namespace rocwmma
         delete[] acc;
     }
 
+    template <typename DataT>
+    void dlrm_mlp_fwd_CPU(DataT const* input,
+                          DataT const* weights,
+                          DataT const* bias,
+                          DataT*       output,
+                          uint32_t     m,
+                          uint32_t     k,
+                          uint32_t     layers,
+                          uint32_t     batchSize)
+    {
+        auto width = std::max(m, k);
+
+#pragma omp parallel for
+        for(int b = 0; b < batchSize; b++)
+        {
+            // Activations are rounded to DataT between layers, as on the device
+            std::vector<DataT> act(input + b * k, input + (b + 1) * k);
+            std::vector<DataT> next(width);
+
+            auto weightsLayer = weights;
+            auto inDim        = k;
+            for(int l = 0; l < layers; l++)
+            {
+                for(int j = 0; j < m; j++)
+                {
+                    float accum = static_cast<float>(bias[l * m + j]);
+                    for(int h = 0; h < inDim; h++)
+                    {
+                        accum += static_cast<float>(act[h])
+                                 * static_cast<float>(weightsLayer[h * m + j]);
+                    }
+                    next[j] = static_cast<DataT>(accum > 0.0f ? accum : 0.0f);
+                }
+
+                act.assign(next.begin(), next.begin() + m);
+                weightsLayer += inDim * m;
+                inDim        = m;
+            }
+
+            std::copy(act.begin(), act.end(), output + b * m);
+        }
+    }
+
     template <typename PackedT,
               uint32_t ElementIdx,
               uint32_t GroupSize,
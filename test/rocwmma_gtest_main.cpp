@@ -26,8 +26,40 @@
 
 #include "common.hpp"
 #include "rocwmma_logging.hpp"
+#include <chrono>
 #include <gtest/gtest.h>
 
+namespace
+{
+    // Captured during static initialization, close to process start
+    auto const sStartTime = std::chrono::steady_clock::now();
+
+    // Reports the startup cost of device init, kernel generation
+    // and gtest registration, up to the first test that runs.
+    class TimeToFirstTest : public testing::EmptyTestEventListener
+    {
+    public:
+        void OnTestStart(testing::TestInfo const& testInfo) override
+        {
+            if(mReported)
+            {
+                return;
+            }
+            mReported = true;
+
+            auto elapsedMs = std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - sStartTime)
+                                 .count();
+            std::cout << "[ rocWMMA  ] Time to first test: " << elapsedMs << " ms ("
+                      << testInfo.test_suite_name() << "." << testInfo.name() << ")"
+                      << std::endl;
+        }
+
+    private:
+        bool mReported = false;
+    };
+}
+
 int main(int argc, char** argv)
 {
     using Options        = rocwmma::RocwmmaLogging;
@@ -37,6 +69,12 @@ int main(int argc, char** argv)
     // Initialize Google Tests
     testing::InitGoogleTest(&argc, argv);
 
+    if(!loggingOptions->omitCout())
+    {
+        // gtest takes ownership of the listener
+        testing::UnitTest::GetInstance()->listeners().Append(new TimeToFirstTest);
+    }
+
     // Run the tests
     int status = RUN_ALL_TESTS();
 
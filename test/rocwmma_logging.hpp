@@ -30,7 +30,10 @@
 #include "rocwmma/rocwmma-version.hpp"
 #include "rocwmma_ostream.hpp"
 #include "singleton.hpp"
+#include <sstream>
 #include <stdlib.h>
+#include <string>
+#include <vector>
 
 namespace rocwmma
 {
@@ -54,7 +57,30 @@ namespace rocwmma
             , mOmitFailed(false)
             , mOmitPassed(false)
             , mOmitCout(false)
+            , mPipelined(false)
+            , mKernelFilters()
+            , mCalibrationFile()
+            , mCalibrationOut()
         {
+            // The command line takes precedence
+            if(auto envFile = getenv("ROCWMMA_PERF_CALIBRATION"))
+            {
+                mCalibrationFile = envFile;
+            }
+        }
+
+        // Colon separated list of substrings to match kernel keys
+        void setKernelFilter(std::string const& filter)
+        {
+            std::stringstream ss(filter);
+            std::string       pattern;
+            while(std::getline(ss, pattern, ':'))
+            {
+                if(!pattern.empty())
+                {
+                    mKernelFilters.push_back(pattern);
+                }
+            }
         }
 
         void setOmits(int mask)
@@ -101,6 +127,43 @@ namespace rocwmma
                     }
                     setOmits(std::stoi(args[i + 1]));
                 }
+                if(args[i] == "--pipelined")
+                {
+                    mPipelined = true;
+                }
+                if(args[i] == "--kernel")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing kernel filter\n";
+                        std::cerr << "Usage: --kernel *pattern[:pattern...]*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setKernelFilter(args[i + 1]);
+                    i++;
+                }
+                if(args[i] == "--calibration_file")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing calibration file\n";
+                        std::cerr << "Usage: --calibration_file *file.csv*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mCalibrationFile = args[i + 1];
+                    i++;
+                }
+                if(args[i] == "--calibration_out")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing calibration output file\n";
+                        std::cerr << "Usage: --calibration_out *file.csv*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mCalibrationOut = args[i + 1];
+                    i++;
+                }
             }
 
             mOstream.initializeStream(fileName);
@@ -131,10 +194,52 @@ namespace rocwmma
             return mOmitCout;
         }
 
+        // Overlap host reference work with device runs
+        bool pipelined()
+        {
+            return mPipelined;
+        }
+
+        // True if the kernel key matches any --kernel pattern, or there are none
+        bool kernelFilter(std::string const& key)
+        {
+            if(mKernelFilters.empty())
+            {
+                return true;
+            }
+
+            for(auto const& pattern : mKernelFilters)
+            {
+                if(key.find(pattern) != std::string::npos)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Measured mma peaks to use for efficiency, see PerfCalibration
+        std::string const& calibrationFile()
+        {
+            return mCalibrationFile;
+        }
+
+        // Where the mma calibration suite writes its measurements
+        std::string const& calibrationOut()
+        {
+            return mCalibrationOut;
+        }
+
     protected:
         rocwmmaOStream mOstream;
 
         bool mOmitSkipped, mOmitFailed, mOmitPassed, mOmitCout;
+        bool mPipelined;
+
+        std::vector<std::string> mKernelFilters;
+
+        std::string mCalibrationFile;
+        std::string mCalibrationOut;
     };
 }
 
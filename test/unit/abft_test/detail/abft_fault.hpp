@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_ABFT_FAULT_HPP
+#define ROCWMMA_DETAIL_ABFT_FAULT_HPP
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "gemm/gemm_abft.hpp"
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side model of the ABFT checksums at one register position of a wave's
+    // BlocksX x BlocksY accumulator blocks. Inputs are rounded to InputT and products
+    // accumulated in ComputeT over K, as the checksum mma of the gemm kernel.
+    template <typename InputT, typename ComputeT, uint32_t BlocksX, uint32_t BlocksY>
+    struct AbftModel
+    {
+        using Abft   = CooperativeGemm::Abft<InputT, ComputeT, BlocksX, BlocksY>;
+        using Status = CooperativeGemm::AbftStatus;
+
+        AbftModel(uint32_t k, uint32_t seed)
+            : mK(k)
+        {
+            std::mt19937                          rng(seed);
+            std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+            for(uint32_t i = 0; i < BlocksX; i++)
+            {
+                rows[i] = static_cast<ComputeT>(0);
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    acc[i][j] = static_cast<ComputeT>(0);
+                }
+            }
+            for(uint32_t j = 0; j < BlocksY; j++)
+            {
+                cols[j] = static_cast<ComputeT>(0);
+            }
+
+            for(uint32_t kk = 0; kk < k; kk++)
+            {
+                InputT a[BlocksX];
+                InputT b[BlocksY];
+                auto   sumA = 0.0f;
+                auto   sumB = 0.0f;
+
+                for(uint32_t i = 0; i < BlocksX; i++)
+                {
+                    a[i] = static_cast<InputT>(dist(rng));
+                    sumA += static_cast<float>(a[i]);
+                }
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    b[j] = static_cast<InputT>(dist(rng));
+                    sumB += static_cast<float>(b[j]);
+                }
+
+                auto sumAIn = static_cast<ComputeT>(static_cast<InputT>(sumA));
+                auto sumBIn = static_cast<ComputeT>(static_cast<InputT>(sumB));
+
+                for(uint32_t i = 0; i < BlocksX; i++)
+                {
+                    rows[i] += static_cast<ComputeT>(a[i]) * sumBIn;
+                    for(uint32_t j = 0; j < BlocksY; j++)
+                    {
+                        acc[i][j] += static_cast<ComputeT>(a[i]) * static_cast<ComputeT>(b[j]);
+                    }
+                }
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    cols[j] += sumAIn * static_cast<ComputeT>(b[j]);
+                }
+            }
+        }
+
+        Status check()
+        {
+            return Abft::check(acc, rows, cols, Abft::tolerance(mK));
+        }
+
+        // The recovered element must match the fault-free value within twice the
+        // checksum tolerance: the row checksum mismatch, plus the recovery rounding.
+        bool isRecovered(AbftModel const& clean, uint32_t i, uint32_t j) const
+        {
+            auto scale = std::abs(static_cast<float>(clean.rows[i]));
+            for(uint32_t jj = 0; jj < BlocksY; jj++)
+            {
+                scale += std::abs(static_cast<float>(clean.acc[i][jj]));
+            }
+
+            auto diff = static_cast<float>(acc[i][j]) - static_cast<float>(clean.acc[i][j]);
+            return std::abs(diff) <= 2.0f * static_cast<float>(Abft::tolerance(mK)) * scale;
+        }
+
+        ComputeT acc[BlocksX][BlocksY];
+        ComputeT rows[BlocksX];
+        ComputeT cols[BlocksY];
+
+    private:
+        uint32_t mK;
+    };
+
+    // Host-only test of the ABFT checks under injected faults. For several K depths
+    // and random inputs:
+    // - Fault-free blocks are clean.
+    // - A fault in any single element is corrected, including NaN.
+    // - A fault in any single row or column checksum leaves the blocks intact.
+    // - Faults in two different rows and columns are uncorrectable.
+    template <typename InputT, typename ComputeT, uint32_t BlocksX, uint32_t BlocksY>
+    struct AbftFaultKernel final : public UnitKernelBase<16, 16, uint32_t, row_major>
+    {
+    private:
+        using Base   = UnitKernelBase<16, 16, uint32_t, row_major>;
+        using Model  = AbftModel<InputT, ComputeT, BlocksX, BlocksY>;
+        using Status = typename Model::Status;
+
+    public:
+        AbftFaultKernel()        = default;
+        ~AbftFaultKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<uint32_t>(ERROR_VALUE);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                constexpr uint32_t Seeds    = 16u;
+                const uint32_t     kSizes[] = {1u, 16u, 64u, 256u};
+
+                // Large enough to exceed the tolerance, small enough for 16 bit ComputeT
+                const auto fault = static_cast<ComputeT>(512.0f);
+                const auto nan   = std::numeric_limits<float>::quiet_NaN();
+
+                bool err = false;
+                for(auto k : kSizes)
+                {
+                    for(uint32_t seed = 0; seed < Seeds; seed++)
+                    {
+                        Model clean(k, seed);
+                        err |= (Model(clean).check() != Status::Clean);
+
+                        for(uint32_t i = 0; i < BlocksX; i++)
+                        {
+                            for(uint32_t j = 0; j < BlocksY; j++)
+                            {
+                                Model model(clean);
+                                model.acc[i][j] += fault;
+                                err |= (model.check() != Status::Corrected);
+                                err |= !model.isRecovered(clean, i, j);
+
+                                Model nanModel(clean);
+                                nanModel.acc[i][j] = static_cast<ComputeT>(nan);
+                                err |= (nanModel.check() != Status::Corrected);
+                                err |= !nanModel.isRecovered(clean, i, j);
+                            }
+                        }
+
+                        for(uint32_t i = 0; i < BlocksX; i++)
+                        {
+                            Model model(clean);
+                            model.rows[i] += fault;
+                            err |= (model.check() != Status::ChecksumFault);
+                        }
+
+                        for(uint32_t j = 0; j < BlocksY; j++)
+                        {
+                            Model model(clean);
+                            model.cols[j] += fault;
+                            err |= (model.check() != Status::ChecksumFault);
+                        }
+
+                        if constexpr(BlocksX > 1u && BlocksY > 1u)
+                        {
+                            Model model(clean);
+                            model.acc[0][0] += fault;
+                            model.acc[BlocksX - 1u][BlocksY - 1u] -= fault;
+                            err |= (model.check() != Status::Uncorrectable);
+                        }
+                    }
+                }
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<uint32_t>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == SUCCESS_VALUE);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct AbftFaultGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            ComputeT = 1,
+            BlocksX  = 2,
+            BlocksY  = 3,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = AbftFaultKernel<
+                std::tuple_element_t<InputT, TestParamsT>, // InputT
+                std::tuple_element_t<ComputeT, TestParamsT>, // ComputeT
+                std::tuple_element_t<BlocksX, TestParamsT>::value, // BlocksX
+                std::tuple_element_t<BlocksY, TestParamsT>::value // BlocksY
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_ABFT_FAULT_HPP
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <type_traits>
+
+#include "detail/abft_fault.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+#include "unit_test_macros.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // Input / compute types supported by the ABFT checksums, and acc blocks per wave
+        using Types = std::tuple<std::tuple<float16_t, float16_t>,
+                                 std::tuple<float16_t, float32_t>,
+                                 std::tuple<bfloat16_t, float32_t>,
+                                 std::tuple<float32_t, float32_t>>;
+
+        using Blocks       = std::tuple<I<1>, I<2>, I<4>>;
+        using KernelParams = typename CombineLists<Types, Blocks, Blocks>::Result;
+
+        // Assemble the kernel generator
+        using GeneratorImpl   = AbftFaultGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        // Host-only test
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            // clang-format off
+            return { {warpSize, 1} };
+            // clang-format on
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            // clang-format off
+            return { {1024, 1024} };
+            // clang-format on
+        }
+    };
+
+} // namespace rocwmma
+
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(AbftFaultTest, TestParams)
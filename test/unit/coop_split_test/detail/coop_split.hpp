@@ -0,0 +1,225 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_COOP_SPLIT_HPP
+#define ROCWMMA_DETAIL_COOP_SPLIT_HPP
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <rocwmma/rocwmma_coop.hpp>
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of the cooperative IO partitioning, for each WaveCount and SplitCount.
+    // - Every IO of the fragment is issued by exactly one chunk of one wave.
+    // - Chunk s of each wave owns registers [s * SplitIOCount, (s + 1) * SplitIOCount).
+    // - Each IO lands in the same register as in the unsplit operation.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct CoopSplitKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+        using FragT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        template <uint32_t WaveCount>
+        using MatrixLayout = typename GetCoopIOConfig_t<FragT, WaveCount>::IOLayout::MatrixLayout;
+
+    public:
+        CoopSplitKernel()        = default;
+        ~CoopSplitKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        template <uint32_t WaveCount, uint32_t SplitCount>
+        static inline bool splitTest()
+        {
+            using Layout = MatrixLayout<WaveCount>;
+
+            // Only split counts that evenly divide each wave's share are valid
+            constexpr uint32_t WaveIOCount = CoopSplit<Layout, WaveCount>::WaveIOCount;
+            if constexpr(WaveIOCount % SplitCount != 0u)
+            {
+                return false;
+            }
+            else
+            {
+                using Split   = CoopSplit<Layout, WaveCount, SplitCount>;
+                using Unsplit = CoopSplit<Layout, WaveCount>;
+
+                // Each IO of the full fragment, by matrix offset
+                constexpr auto strideSpace = Layout::strideCounts();
+                constexpr auto strides     = Layout::strides();
+                constexpr auto totalIOs    = flatten_coord_left(strideSpace - 1u, strideSpace) + 1u;
+
+                std::map<std::pair<uint32_t, uint32_t>, uint32_t> ioCounts;
+                for(uint32_t io = 0; io < totalIOs; io++)
+                {
+                    auto offset = to_matrix_space(strides, inflate_coord_left(io, strideSpace));
+                    ioCounts[std::make_pair(get<0>(offset), get<1>(offset))] = 0u;
+                }
+
+                bool err = (Split::MaxWaves * Split::WaveIOCount != totalIOs)
+                           || (Split::SplitIOCount * SplitCount != Split::WaveIOCount);
+
+                for(uint32_t w = 0; w < Split::MaxWaves; w++)
+                {
+                    // Registers written by each chunk of the current wave
+                    std::vector<uint32_t> registers(Split::WaveIOCount, 0u);
+
+                    for(uint32_t s = 0; s < SplitCount; s++)
+                    {
+                        for(uint32_t i = 0; i < Split::SplitIOCount; i++)
+                        {
+                            auto reg = Split::ioIndex(s, i);
+                            err |= (reg < s * Split::SplitIOCount)
+                                   || (reg >= (s + 1u) * Split::SplitIOCount);
+                            if(reg < Split::WaveIOCount)
+                            {
+                                registers[reg]++;
+                            }
+
+                            auto offset  = Split::waveOffset(w) + Split::ioOffset(reg);
+                            auto unsplit = Unsplit::waveOffset(w) + Unsplit::ioOffset(reg);
+                            auto ioCount
+                                = ioCounts.find(std::make_pair(get<0>(offset), get<1>(offset)));
+
+                            err |= (get<0>(offset) != get<0>(unsplit))
+                                   || (get<1>(offset) != get<1>(unsplit));
+                            err |= (ioCount == ioCounts.end());
+                            if(ioCount != ioCounts.end())
+                            {
+                                ioCount->second++;
+                            }
+                        }
+                    }
+
+                    for(auto count : registers)
+                    {
+                        err |= (count != 1u);
+                    }
+                }
+
+                for(auto const& ioCount : ioCounts)
+                {
+                    err |= (ioCount.second != 1u);
+                }
+
+                return err;
+            }
+        }
+
+        template <uint32_t WaveCount>
+        static inline bool waveTest()
+        {
+            return splitTest<WaveCount, 1u>() || splitTest<WaveCount, 2u>()
+                   || splitTest<WaveCount, 4u>() || splitTest<WaveCount, 8u>();
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                bool err = waveTest<1u>() || waveTest<2u>() || waveTest<4u>() || waveTest<8u>();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct CoopSplitGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = CoopSplitKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_COOP_SPLIT_HPP
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_DROPOUT_MASK_HPP
+#define ROCWMMA_DETAIL_DROPOUT_MASK_HPP
+
+#include <cmath>
+#include <vector>
+
+#include "gemm/gemm_dropout.hpp"
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-only test of the dropout draws and the keep mask of an m x n output:
+    // - Philox4x32-10 matches the known answers of the reference implementation.
+    // - The mask is independent of the tile visiting order and the data layout.
+    // - The keep rate is close to 1 - p.
+    // - Kept elements are scaled by 1 / (1 - p), dropped elements are zeroed.
+    // - The same seed and offset reproduce the mask, another offset does not.
+    // - Mask words split over the lanes of a wave cover each element once.
+    template <typename DataT, typename DataLayout>
+    struct DropoutMaskKernel final : public UnitKernelBase<16, 16, uint32_t, row_major>
+    {
+    private:
+        using Base    = UnitKernelBase<16, 16, uint32_t, row_major>;
+        using Dropout = CooperativeGemm::Dropout;
+
+        // Output not a multiple of the mask word, or the tile
+        static constexpr uint32_t M    = 72u;
+        static constexpr uint32_t N    = 100u;
+        static constexpr uint32_t Tile = 16u;
+
+        static constexpr uint64_t Seed   = 0x2545F4914F6CDD1Dull;
+        static constexpr uint64_t Offset = 0x100000000ull;
+
+        static bool testPhilox()
+        {
+            // Known answers of Philox4x32-10, Random123 kat_vectors
+            // clang-format off
+            const uint32_t kats[3][3][4] = {
+                {{0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+                 {0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+                 {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}},
+                {{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                 {0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u},
+                 {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}},
+                {{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                 {0xa4093822u, 0x299f31d0u, 0x00000000u, 0x00000000u},
+                 {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}};
+            // clang-format on
+
+            bool err = false;
+            for(auto const& kat : kats)
+            {
+                uint32_t ctr[4] = {kat[0][0], kat[0][1], kat[0][2], kat[0][3]};
+                CooperativeGemm::Philox4x32::generate(ctr, kat[1][0], kat[1][1]);
+                for(uint32_t i = 0; i < 4u; i++)
+                {
+                    err |= (ctr[i] != kat[2][i]);
+                }
+            }
+            return !err;
+        }
+
+        // Host model of the device word gathering for one block: lanes draw their
+        // chunks, the chunks of each word are or-ed, and every element reads its bit
+        // back from the word owner. Each element must be drawn exactly once.
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t WaveSize>
+        static bool testWords(float32_t p)
+        {
+            using Words = CooperativeGemm::DropoutWords<BlockM, BlockN, WaveSize>;
+
+            auto n        = 4u * BlockN;
+            auto blockRow = BlockM;
+            auto blockCol = BlockN;
+            auto params   = CooperativeGemm::makeDropoutParams(p, Seed, Offset, nullptr, n);
+
+            auto words = std::vector<uint32_t>(Words::LaneWords * WaveSize, 0u);
+            auto draws = std::vector<uint32_t>(BlockM * BlockN, 0u);
+            for(uint32_t s = 0u; s < Words::LaneWords; s++)
+            {
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    auto chunk = Words::chunk(s, lane);
+                    if(!Words::isValid(chunk))
+                    {
+                        continue;
+                    }
+
+                    auto row = Words::rowOffset(chunk);
+                    auto col = Words::colOffset(chunk);
+                    for(uint32_t b = 0u; b < Words::LaneBits; b++)
+                    {
+                        draws[row * BlockN + col + b]++;
+                        if(Dropout::isKept(params, blockRow + row, blockCol + col + b, n))
+                        {
+                            words[chunk] |= Dropout::maskBit(blockCol + col + b);
+                        }
+                    }
+                }
+            }
+
+            // Or the chunks of each word into its owner
+            for(uint32_t chunk = 0u; chunk < words.size(); chunk++)
+            {
+                if(!Words::isWordOwner(chunk))
+                {
+                    words[chunk - chunk % Words::LanesPerWord] |= words[chunk];
+                }
+            }
+
+            bool err = false;
+            for(uint32_t row = 0u; row < BlockM; row++)
+            {
+                for(uint32_t col = 0u; col < BlockN; col++)
+                {
+                    auto bits = words[Words::ownerChunk(row, col)];
+                    auto keep = (bits & Dropout::maskBit(blockCol + col)) != 0u;
+
+                    err |= (draws[row * BlockN + col] != 1u);
+                    err |= keep != Dropout::isKept(params, blockRow + row, blockCol + col, n);
+                }
+            }
+            return !err;
+        }
+
+        // Builds the mask tile by tile in reverse order, as waves may visit them
+        static std::vector<uint32_t> tiledMask(CooperativeGemm::DropoutParams const& params)
+        {
+            auto mask = std::vector<uint32_t>(M * params.ldMask, 0u);
+            for(uint32_t tileRow = (M + Tile - 1u) / Tile; tileRow-- > 0u;)
+            {
+                for(uint32_t tileCol = (N + Tile - 1u) / Tile; tileCol-- > 0u;)
+                {
+                    auto rowEnd = std::min((tileRow + 1u) * Tile, M);
+                    auto colEnd = std::min((tileCol + 1u) * Tile, N);
+
+                    for(uint32_t row = tileRow * Tile; row < rowEnd; row++)
+                    {
+                        for(uint32_t col = tileCol * Tile; col < colEnd; col++)
+                        {
+                            if(Dropout::isKept(params, row, col, N))
+                            {
+                                mask[Dropout::maskIndex(row, col, params.ldMask)]
+                                    |= Dropout::maskBit(col);
+                            }
+                        }
+                    }
+                }
+            }
+            return mask;
+        }
+
+        static bool testDropout(float32_t p)
+        {
+            auto params   = CooperativeGemm::makeDropoutParams(p, Seed, Offset, nullptr, N);
+            auto data     = std::vector<DataT>(M * N, static_cast<DataT>(1));
+            auto dataRef  = std::vector<DataT>(M * N, static_cast<DataT>(1));
+            auto mask     = std::vector<uint32_t>(M * params.ldMask);
+            auto maskRef  = std::vector<uint32_t>(M * params.ldMask);
+            auto expected = 1.0f / (1.0f - p);
+
+            CooperativeGemm::dropout_CPU<DataT, DataLayout>(data.data(), mask.data(), M, N, params);
+            CooperativeGemm::dropout_CPU<DataT, row_major>(
+                dataRef.data(), maskRef.data(), M, N, params);
+
+            bool err = (mask != maskRef) || (mask != tiledMask(params));
+
+            // Check the elements against their mask bits
+            uint32_t kept = 0u;
+            for(uint32_t row = 0u; row < M; row++)
+            {
+                for(uint32_t col = 0u; col < N; col++)
+                {
+                    auto index = std::is_same_v<DataLayout, row_major> ? row * N + col
+                                                                       : col * M + row;
+                    auto value = static_cast<float32_t>(data[index]);
+                    auto keep  = (mask[Dropout::maskIndex(row, col, params.ldMask)]
+                                 & Dropout::maskBit(col))
+                                != 0u;
+
+                    kept += keep ? 1u : 0u;
+                    err |= keep ? (std::abs(value - expected) > 1.0e-2f * expected)
+                                : (value != 0.0f);
+                }
+            }
+
+            // Padding bits past n are never set
+            for(uint32_t row = 0u; row < M; row++)
+            {
+                for(uint32_t col = N; col < params.ldMask * 32u; col++)
+                {
+                    err |= (mask[Dropout::maskIndex(row, col, params.ldMask)]
+                            & Dropout::maskBit(col))
+                           != 0u;
+                }
+            }
+
+            auto keepRate = static_cast<float32_t>(kept) / static_cast<float32_t>(M * N);
+            err |= std::abs(keepRate - (1.0f - p)) > 0.05f;
+
+            // Same seed and offset reproduce, another offset draws a new mask
+            auto other = CooperativeGemm::makeDropoutParams(p, Seed, Offset + 1u, nullptr, N);
+            err |= (tiledMask(params) != mask);
+            err |= (p > 0.0f) && (tiledMask(other) == mask);
+
+            return !err;
+        }
+
+    public:
+        DropoutMaskKernel()        = default;
+        ~DropoutMaskKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<uint32_t>(ERROR_VALUE);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                const float32_t probabilities[] = {0.0f, 0.1f, 0.5f, 0.9f};
+
+                bool err = !testPhilox();
+                for(auto p : probabilities)
+                {
+                    err |= !testDropout(p);
+
+                    // Word partitions of the gemm blocks, for wave64 and wave32
+                    err |= !testWords<16u, 16u, 64u>(p);
+                    err |= !testWords<32u, 32u, 64u>(p);
+                    err |= !testWords<64u, 64u, 64u>(p);
+                    err |= !testWords<4u, 4u, 64u>(p);
+                    err |= !testWords<16u, 16u, 32u>(p);
+                    err |= !testWords<32u, 32u, 32u>(p);
+                    err |= !testWords<16u, 64u, 32u>(p);
+                }
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<uint32_t>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == SUCCESS_VALUE);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct DropoutMaskGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT  = 0,
+            Layout = 1,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = DropoutMaskKernel<std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                    std::tuple_element_t<Layout, TestParamsT> // Layout
+                                    >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_DROPOUT_MASK_HPP
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_FRAGMENT_COORDS_HPP
+#define ROCWMMA_DETAIL_FRAGMENT_COORDS_HPP
+
+#include <vector>
+
+#include <rocwmma/rocwmma.hpp>
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of fragment element coordinates.
+    // - Coordinates must cover the fragment's matrix exactly once over the wave.
+    // - Coordinates must match the IO mapping: the vector base of each IO is the stride
+    //   offset of the IO iteration, and the matrix layout maps coordinates back to the
+    //   same (lane, element).
+    // - Coordinates must be the lane base plus a lane-invariant element offset.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct FragmentCoordsKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+    public:
+        FragmentCoordsKernel()        = default;
+        ~FragmentCoordsKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        static inline bool isSame(Coord2d const& lhs, Coord2d const& rhs)
+        {
+            return (get<0>(lhs) == get<0>(rhs)) && (get<1>(lhs) == get<1>(rhs));
+        }
+
+        static inline bool coordsTest()
+        {
+            using FragT        = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using IOConfig     = GetIOConfig_t<FragT>;
+            using IOShape      = typename IOConfig::IOShape;
+            using IOTraits     = typename IOConfig::IOTraits;
+            using MatrixLayout = typename IOConfig::IOLayout::MatrixLayout;
+
+            constexpr uint32_t VW     = IOConfig::IOLayout::VW;
+            constexpr uint32_t Height = IOShape::BlockHeight;
+            constexpr uint32_t Width  = IOShape::BlockWidth;
+
+            bool err = (IOTraits::ThreadsPerIO * FragT::num_elements != Height * Width)
+                       || !isSame(fragment_coord_map<FragT>::offset(0u), make_coord2d(0u, 0u));
+
+            auto visited = std::vector<uint32_t>(Height * Width, 0u);
+            for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+            {
+                auto coords = fragment_coords<FragT>(lane);
+
+                for(uint32_t i = 0; i < FragT::num_elements; i++)
+                {
+                    auto coord = coords[i];
+                    err |= (coords.row(i) != get<0>(coord)) || (coords.col(i) != get<1>(coord));
+                    err |= !isSame(coord, coords.base + fragment_coord_map<FragT>::offset(i));
+
+                    // Vector base of each IO is offset by the strides of the IO iteration
+                    if(i % VW == 0u)
+                    {
+                        auto ioOffset = to_matrix_space(
+                            MatrixLayout::strides(),
+                            inflate_coord_left(i / VW, MatrixLayout::strideCounts()));
+                        err |= !isSame(coord, MatrixLayout::baseOffset(lane) + ioOffset);
+                    }
+
+                    // Register of the coordinate is the current (lane, element)
+                    err |= !isSame(MatrixLayout::registerCoord(coord), make_coord2d(lane, i));
+
+                    if((get<0>(coord) < Height) && (get<1>(coord) < Width))
+                    {
+                        visited[get<0>(coord) * Width + get<1>(coord)]++;
+                    }
+                    else
+                    {
+                        err = true;
+                    }
+                }
+            }
+
+            for(auto count : visited)
+            {
+                err |= (count != 1u);
+            }
+
+            // Accumulators without a data layout share the accumulator register mapping
+            if constexpr(std::is_same<MatrixT, accumulator>::value)
+            {
+                using FragVoidT = fragment<accumulator, BlockM, BlockN, BlockK, DataT>;
+                using FragRowT  = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+
+                for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+                {
+                    for(uint32_t i = 0; i < FragT::num_elements; i++)
+                    {
+                        err |= !isSame(fragment_coords<FragVoidT>(lane)[i],
+                                       fragment_coords<FragRowT>(lane)[i]);
+                    }
+                }
+            }
+
+            return err;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                bool err = coordsTest();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct FragmentCoordsGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = FragmentCoordsKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_FRAGMENT_COORDS_HPP
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_HOST_TASK_POOL_SCHED_HPP
+#define ROCWMMA_DETAIL_HOST_TASK_POOL_SCHED_HPP
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "host_task_pool.hpp"
+
+namespace rocwmma
+{
+    // Mock of a GEMM test in pipelined mode: the host reference is submitted
+    // to the pool, the device stage runs on the test thread, then the reference
+    // is joined and the two results are compared.
+    // The device stage does not finish until its host reference has started,
+    // so the pair can only complete if the two stages actually overlap.
+    struct MockPipelinedKernel
+    {
+        MockPipelinedKernel(uint32_t id, uint32_t size)
+            : mId(id)
+            , mSize(size)
+            , mRefStarted(false)
+            , mDeviceResult(0)
+            , mRefResult(0)
+        {
+        }
+
+        uint64_t expected() const
+        {
+            uint64_t n = mSize;
+            return n * (n - 1u) / 2u + mId * n;
+        }
+
+        void hostRef()
+        {
+            mRefStarted = true;
+            std::vector<uint64_t> data(mSize);
+            std::iota(data.begin(), data.end(), uint64_t(mId));
+            mRefResult = std::accumulate(data.begin(), data.end(), uint64_t(0));
+        }
+
+        // Returns false if the host reference never started alongside
+        bool deviceExec()
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while(!mRefStarted)
+            {
+                if(std::chrono::steady_clock::now() > deadline)
+                {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            mDeviceResult = expected();
+            return true;
+        }
+
+        bool validate() const
+        {
+            return mDeviceResult == mRefResult;
+        }
+
+        uint32_t          mId;
+        uint32_t          mSize;
+        std::atomic<bool> mRefStarted;
+        uint64_t          mDeviceResult;
+        uint64_t          mRefResult;
+    };
+
+    // Host-only checks of the pipelined test scheduler.
+    // These do not touch the device, so they run on machines without a GPU.
+    struct HostTaskPoolSched
+    {
+        // Each test runs host reference and device stages back to back,
+        // overlapping within the test.
+        static bool checkPipelined(uint32_t workers, uint32_t maxInFlight)
+        {
+            HostTaskPool pool(workers, maxInFlight);
+
+            bool err = false;
+            for(uint32_t i = 0; i < 64u; i++)
+            {
+                MockPipelinedKernel kernel(i, 1024u + i);
+
+                auto hostRef = pool.submit([&kernel]() { kernel.hostRef(); });
+                err |= !kernel.deviceExec();
+                hostRef.get();
+                err |= !kernel.validate();
+            }
+
+            pool.wait();
+            return !err;
+        }
+
+        // The pool never holds more than maxInFlight tasks and blocks
+        // the submitter until a slot retires.
+        static bool checkBounded(uint32_t workers, uint32_t maxInFlight)
+        {
+            HostTaskPool pool(workers, maxInFlight);
+
+            std::atomic<bool>              release(false);
+            std::vector<std::future<void>> results;
+            auto                           gatedTask = [&release]() {
+                while(!release)
+                {
+                    std::this_thread::yield();
+                }
+            };
+
+            for(uint32_t i = 0; i < maxInFlight; i++)
+            {
+                results.push_back(pool.submit(gatedTask));
+            }
+
+            // One more must block until the gate opens
+            std::atomic<bool> overflowSubmitted(false);
+            std::thread       submitter([&]() {
+                results.push_back(pool.submit([]() {}));
+                overflowSubmitted = true;
+            });
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            bool err = overflowSubmitted.load();
+
+            release = true;
+            submitter.join();
+            for(auto& result : results)
+            {
+                result.get();
+            }
+
+            pool.wait();
+            err |= (pool.peakInFlight() > maxInFlight);
+            return !err;
+        }
+
+        // Errors raised on the pool surface on the test thread
+        static bool checkExceptions(uint32_t workers, uint32_t maxInFlight)
+        {
+            HostTaskPool pool(workers, maxInFlight);
+
+            auto result = pool.submit([]() { throw std::runtime_error("mock ref failure"); });
+            try
+            {
+                result.get();
+            }
+            catch(std::runtime_error const&)
+            {
+                // Pool must still accept work afterwards
+                auto next = pool.submit([]() {});
+                next.get();
+                return true;
+            }
+            return false;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_HOST_TASK_POOL_SCHED_HPP
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "detail/host_task_pool_sched.hpp"
+
+namespace rocwmma
+{
+    // Pool worker threads and in-flight task bound.
+    // Plain gtest: the scheduler is host-only, so no device is queried.
+    class HostTaskPoolSchedTest : public ::testing::TestWithParam<std::tuple<uint32_t, uint32_t>>
+    {
+    };
+
+    TEST_P(HostTaskPoolSchedTest, Pipelined)
+    {
+        auto [workers, maxInFlight] = GetParam();
+        EXPECT_TRUE(HostTaskPoolSched::checkPipelined(workers, maxInFlight));
+    }
+
+    TEST_P(HostTaskPoolSchedTest, Bounded)
+    {
+        auto [workers, maxInFlight] = GetParam();
+        EXPECT_TRUE(HostTaskPoolSched::checkBounded(workers, maxInFlight));
+    }
+
+    TEST_P(HostTaskPoolSchedTest, Exceptions)
+    {
+        auto [workers, maxInFlight] = GetParam();
+        EXPECT_TRUE(HostTaskPoolSched::checkExceptions(workers, maxInFlight));
+    }
+
+    INSTANTIATE_TEST_SUITE_P(HostTaskPool,
+                             HostTaskPoolSchedTest,
+                             ::testing::Combine(::testing::Values(1u, 2u, 4u),
+                                                ::testing::Values(1u, 2u, 8u)));
+
+} // namespace rocwmma
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_IO_BANDWIDTH_HPP
+#define ROCWMMA_DETAIL_IO_BANDWIDTH_HPP
+
+#include <cmath>
+
+#include "device/io_bandwidth.hpp"
+#include "load_store_matrix_sync_test/detail/load_store_matrix_sync.hpp"
+
+namespace rocwmma
+{
+
+    // Streams the whole matrix from in to out through the IoPath and reports the
+    // achieved global bandwidth against the device peak. Round trips are validated
+    // as in the load / store tests.
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout, IoPath Path>
+    struct IoBandwidthKernel final : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+        // Cold runs warm up clocks and caches, hot runs are timed
+        enum : uint32_t
+        {
+            ColdRuns = 2u,
+            HotRuns  = 10u
+        };
+
+    public:
+        IoBandwidthKernel()        = default;
+        ~IoBandwidthKernel() final = default;
+
+        uint32_t ldsUsage() const final
+        {
+            auto waves = Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * Base::mTBlockY;
+
+            if constexpr(Path == IoPath::OpaqueLds)
+            {
+                return waves * BlockM * BlockN * sizeof(DataT);
+            }
+            else if constexpr(Path == IoPath::CoopLds)
+            {
+                return BlockM * BlockN * sizeof(DataT);
+            }
+
+            return 0u;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                auto ioKernel = [this]() {
+                    auto& dataInstance = Base::DataStorage::instance();
+
+                    hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
+                                          (this->gridDim()), // Wg grid size
+                                          (this->blockDim()), // Thread block size
+                                          (this->ldsUsage()), // sharedMemBytes
+                                          0, // stream
+                                          nullptr, // Event start
+                                          nullptr, // event stop
+                                          0, // flags
+                                          this->mM, // M
+                                          this->mN, // N
+                                          dataInstance->deviceIn().get(), // In*
+                                          dataInstance->deviceOut().get(), // Out*
+                                          this->mLd, // ld
+                                          this->mParam1, // param1
+                                          this->mParam2); // param2
+                };
+
+                for(uint32_t i = 0; i < ColdRuns; ++i)
+                {
+                    ioKernel();
+                }
+
+                hipEvent_t startEvent, stopEvent;
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < HotRuns; ++i)
+                {
+                    ioKernel();
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                // Each run reads in and writes out once. LDS traffic is not counted.
+                auto peakGBytesPerSec = Base::DeviceInfo::instance()->peakGBytesPerSec();
+                auto ioBytes          = 2.0 * Base::mM * Base::mN * sizeof(DataT);
+
+                Base::mElapsedTimeMs  = float64_t(timeMs);
+                mTotalGBytes          = ioBytes / 1.0e9;
+                mMeasuredGBytesPerSec = mTotalGBytes * HotRuns * 1.0e3 / Base::mElapsedTimeMs;
+                Base::mEfficiency     = round(mMeasuredGBytesPerSec / peakGBytesPerSec * 100.0);
+            }
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, MatM, MatN, ld, Lyt, Td, IoPath, "
+                             "elapsedMs, Data Size(GB), GB/s, Efficiency(%), Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            constexpr const char* pathNames[] = {"Opaque", "Coop", "OpaqueLds", "CoopLds"};
+
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", "
+                   << Base::mM << ", " << Base::mN << ", " << Base::mLd << ", "
+                   << dataTypeToString<Layout>() << ", " << dataTypeToString<DataT>() << ", "
+                   << pathNames[static_cast<uint32_t>(Path)] << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << Base::mElapsedTimeMs << ", " << mTotalGBytes << ", "
+                       << mMeasuredGBytesPerSec << ", " << Base::mEfficiency << ", "
+                       << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+
+            return stream;
+        }
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(IoBandwidth<BlockM, BlockN, DataT, Layout, Path>);
+        }
+
+    private:
+        float64_t mTotalGBytes          = 0.0;
+        float64_t mMeasuredGBytesPerSec = 0.0;
+    };
+
+    template <IoPath Path>
+    struct IoBandwidthGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT  = 0,
+            BlockM = 1,
+            BlockN = 2,
+            Layout = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = IoBandwidthKernel<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                    std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                    std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                    std::tuple_element_t<Layout, TestParamsT>, // Layout
+                                    Path>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_IO_BANDWIDTH_HPP
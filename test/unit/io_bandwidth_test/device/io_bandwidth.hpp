@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_IO_BANDWIDTH_HPP
+#define ROCWMMA_DEVICE_IO_BANDWIDTH_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    // Fragment IO paths streamed by the bandwidth kernels
+    enum struct IoPath : uint32_t
+    {
+        Opaque, // load_matrix_sync / store_matrix_sync of one block per wave
+        Coop, // load_matrix_coop_sync / store_matrix_coop_sync, shared by the workgroup
+        OpaqueLds, // Opaque, with a round trip through one LDS block per wave
+        CoopLds // Coop, with a round trip through one LDS block per workgroup
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayout, IoPath Path>
+    __global__ void IoBandwidth(uint32_t     m,
+                                uint32_t     n,
+                                DataT const* in,
+                                DataT*       out,
+                                uint32_t     ld,
+                                DataT        param1,
+                                DataT        param2)
+    {
+        if constexpr(FragSize_guard<BlockM,
+                                    BlockN,
+                                    DataT,
+                                    DataLayout,
+                                    Constants::AMDGCN_WAVE_SIZE,
+                                    Constants::AMDGCN_CURRENT_ARCH_ID>::enable())
+        {
+            using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+            // Mapping:
+            // Incoming -> Matrix A (ColNT)
+            // BlockM -> BlockM
+            // <Dummy> -> BlockN
+            // BlockN -> BlockK
+            auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+
+            // LDS blocks are packed in the same layout as the matrix
+            constexpr uint32_t ldLds = std::is_same_v<DataLayout, row_major> ? BlockN : BlockM;
+
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            auto* lds = reinterpret_cast<DataT*>(localMemPtr);
+
+            auto workgroupDim = Mapping::workgroupDim();
+            auto waveCoord    = Mapping::waveCoord();
+            auto waveIndex    = get<0>(waveCoord) * get<1>(workgroupDim) + get<1>(waveCoord);
+
+            if constexpr(Path == IoPath::Opaque || Path == IoPath::OpaqueLds)
+            {
+                auto* read  = Mapping::dataCoord(in, ld);
+                auto* write = Mapping::dataCoord(out, ld);
+                load_matrix_sync(frag, read, ld);
+
+                if constexpr(Path == IoPath::OpaqueLds)
+                {
+                    auto* ldsBlock = lds + waveIndex * BlockM * BlockN;
+                    store_matrix_sync(ldsBlock, frag, ldLds);
+                    load_matrix_sync(frag, ldsBlock, ldLds);
+                }
+
+                store_matrix_sync(write, frag, ld);
+            }
+            else
+            {
+                // All waves cooperate on each block covered by the workgroup
+                auto workCount       = get<0>(workgroupDim) * get<1>(workgroupDim);
+                auto startBlockCoord = Mapping::blockCoord() - waveCoord;
+
+                for(uint32_t i = 0; i < get<0>(workgroupDim); i++)
+                {
+                    for(uint32_t j = 0; j < get<1>(workgroupDim); j++)
+                    {
+                        auto  blockCoord  = startBlockCoord + make_coord2d(i, j);
+                        auto  matrixCoord = Mapping::matrixCoord(blockCoord);
+                        auto* read        = Mapping::dataCoord(in, matrixCoord, ld);
+                        auto* write       = Mapping::dataCoord(out, matrixCoord, ld);
+                        load_matrix_coop_sync(frag, read, ld, waveIndex, workCount);
+
+                        if constexpr(Path == IoPath::CoopLds)
+                        {
+                            // Waves read back their own share, but stage the block
+                            // with the same barriers as a cooperative gemm
+                            store_matrix_coop_sync(lds, frag, ldLds, waveIndex, workCount);
+                            synchronize_workgroup();
+                            load_matrix_coop_sync(frag, lds, ldLds, waveIndex, workCount);
+                            synchronize_workgroup();
+                        }
+
+                        store_matrix_coop_sync(write, frag, ld, waveIndex, workCount);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_IO_BANDWIDTH_HPP
@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_BLOCKED_LAYOUT_HPP
+#define ROCWMMA_DETAIL_BLOCKED_LAYOUT_HPP
+
+#include <vector>
+
+#include <rocwmma/rocwmma.hpp>
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of blocked data layouts.
+    // - Blocked offsets must match the reference tile-major offsets, and be a bijection.
+    // - Fragment IO on blocked layouts must map registers to the same matrix coordinates
+    //   as the inner layout, with each IO vector contiguous in memory.
+    // - Layout conversion must round trip through blocked layouts.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct BlockedLayoutKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+    public:
+        BlockedLayoutKernel()        = default;
+        ~BlockedLayoutKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        static inline bool isSame(Coord2d const& lhs, Coord2d const& rhs)
+        {
+            return (get<0>(lhs) == get<0>(rhs)) && (get<1>(lhs) == get<1>(rhs));
+        }
+
+        template <uint32_t TileRows, uint32_t TileCols, typename OuterLayoutT>
+        bool addressTest(uint32_t m, uint32_t n)
+        {
+            using BlockedT  = blocked_layout<TileRows, TileCols, DataLayoutT, OuterLayoutT>;
+            using Blocked   = DataLayout::template Array1d<BlockedT>;
+            using OuterRowT = std::is_same<OuterLayoutT, row_major>;
+            using InnerRowT = std::is_same<DataLayoutT, row_major>;
+
+            auto ld       = OuterRowT::value ? n : m;
+            auto tilesRow = n / TileCols;
+            auto tilesCol = m / TileRows;
+
+            bool err     = false;
+            auto visited = std::vector<bool>(m * n, false);
+            for(uint32_t row = 0; row < m; row++)
+            {
+                for(uint32_t col = 0; col < n; col++)
+                {
+                    // Reference: tile index, then element index within the tile
+                    auto tileRow = row / TileRows;
+                    auto tileCol = col / TileCols;
+                    auto tileIdx = OuterRowT::value ? tileRow * tilesRow + tileCol
+                                                    : tileCol * tilesCol + tileRow;
+                    auto elemIdx = InnerRowT::value ? (row % TileRows) * TileCols + col % TileCols
+                                                    : (col % TileCols) * TileRows + row % TileRows;
+
+                    uint32_t offset = Blocked::fromMatrixCoord(make_coord2d(row, col), ld);
+                    err |= (offset != tileIdx * TileRows * TileCols + elemIdx);
+                    err |= (offset >= m * n) || visited[offset];
+
+                    visited[offset] = true;
+                }
+            }
+
+            err |= (Blocked::leadingDim(make_coord2d(m, n)) != ld);
+
+            return err;
+        }
+
+        template <uint32_t TileRows, uint32_t TileCols, typename OuterLayoutT>
+        bool fragmentTest()
+        {
+            using BlockedT = blocked_layout<TileRows, TileCols, DataLayoutT, OuterLayoutT>;
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, BlockedT>;
+            using RefFragT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+            using IOConfig        = GetIOConfig_t<FragT>;
+            using IOShape         = typename IOConfig::IOShape;
+            using IOTraits        = typename IOConfig::IOTraits;
+            using DataLayout      = typename IOConfig::IOLayout::DataLayout;
+            using MatrixLayout    = typename IOConfig::IOLayout::MatrixLayout;
+            using RefMatrixLayout = typename GetIOConfig_t<RefFragT>::IOLayout::MatrixLayout;
+            using Reference       = typename IOConfig::AtomicStorer;
+
+            constexpr uint32_t VW = IOConfig::IOLayout::VW;
+
+            auto ld = std::is_same<OuterLayoutT, row_major>::value ? IOShape::BlockWidth
+                                                                   : IOShape::BlockHeight;
+
+            // Vectors must fit within tiles
+            bool err = (VW > (uint32_t)DataLayout::MaxContiguous);
+
+            for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+            {
+                for(uint32_t i = 0; i < IOTraits::IOCount; i++)
+                {
+                    uint32_t vectorOffset = Reference::dataOffset(lane, i, ld);
+                    for(uint32_t v = 0; v < VW; v++)
+                    {
+                        auto elementIdx = i * VW + v;
+                        auto coord      = MatrixLayout::matrixCoord(lane, elementIdx);
+
+                        // Same registers as the inner layout, contiguous vectors in memory
+                        err |= !isSame(coord, RefMatrixLayout::matrixCoord(lane, elementIdx));
+                        err |= (DataLayout::fromMatrixCoord(coord, ld) != vectorOffset + v);
+                    }
+                }
+            }
+
+            return err;
+        }
+
+        template <uint32_t TileRows, uint32_t TileCols, typename OuterLayoutT>
+        bool conversionTest(uint32_t m, uint32_t n)
+        {
+            using BlockedT = blocked_layout<TileRows, TileCols, DataLayoutT, OuterLayoutT>;
+
+            auto ld        = std::is_same<DataLayoutT, row_major>::value ? n : m;
+            auto ldBlocked = std::is_same<OuterLayoutT, row_major>::value ? n : m;
+
+            auto src     = std::vector<DataT>(m * n);
+            auto blocked = std::vector<DataT>(m * n);
+            auto dst     = std::vector<DataT>(m * n);
+            for(uint32_t i = 0; i < m * n; i++)
+            {
+                src[i] = static_cast<DataT>(i % 64u);
+            }
+
+            convert_matrix_layout<BlockedT, DataLayoutT>(
+                blocked.data(), src.data(), m, n, ldBlocked, ld);
+            convert_matrix_layout<DataLayoutT, BlockedT>(
+                dst.data(), blocked.data(), m, n, ld, ldBlocked);
+
+            bool err = false;
+            for(uint32_t i = 0; i < m * n; i++)
+            {
+                err |= (dst[i] != src[i]);
+            }
+
+            return err;
+        }
+
+        template <uint32_t TileRows, uint32_t TileCols, typename OuterLayoutT>
+        bool blockedTest()
+        {
+            // Matrix of 2 x 3 fragment blocks
+            constexpr uint32_t M = 2u * BlockM;
+            constexpr uint32_t N = 3u * BlockN;
+
+            return addressTest<TileRows, TileCols, OuterLayoutT>(M, N)
+                   || fragmentTest<TileRows, TileCols, OuterLayoutT>()
+                   || conversionTest<TileRows, TileCols, OuterLayoutT>(M, N);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                // Tiles must fit within the smallest fragment block (BlockK >= 8)
+                bool err = blockedTest<8, 8, row_major>() || blockedTest<8, 8, col_major>()
+                           || blockedTest<4, 8, row_major>() || blockedTest<8, 4, col_major>();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct BlockedLayoutGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = BlockedLayoutKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_BLOCKED_LAYOUT_HPP
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_LAZY_TRANSFORMS_HPP
+#define ROCWMMA_DETAIL_LAZY_TRANSFORMS_HPP
+
+#include <rocwmma/rocwmma_transforms.hpp>
+
+#include "device/lazy_transforms.hpp"
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    // Host-side check of lazy layout transform chains.
+    // - The lazy chain must arrive at the same fragment type as the sequential chain.
+    // - The fused permutation must equal the composition of the sequential permutations.
+    // - Re-cast steps, and fused chains with the same register layout at both ends,
+    //   must not move any elements.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct LazyTransformsKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+        using FragT       = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using OrthoLayout = orthogonal_layout_t<DataLayoutT>;
+
+        template <typename FragOut, typename FragIn>
+        using Step = detail::ApplyLazy<FragOut, FragIn, 1u>;
+
+    public:
+        LazyTransformsKernel()        = default;
+        ~LazyTransformsKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        static inline bool isSame(Coord2d const& lhs, Coord2d const& rhs)
+        {
+            return (get<0>(lhs) == get<0>(rhs)) && (get<1>(lhs) == get<1>(rhs));
+        }
+
+        // Source register of the sequential chain, applying the steps from last to first
+        template <typename FragOut, typename FragIn, typename... FragsIn>
+        static inline Coord2d sequentialSrc(Coord2d const& reg)
+        {
+            auto src = Step<FragOut, FragIn>::srcRegisterCoord(get<0>(reg), get<1>(reg));
+            if constexpr(sizeof...(FragsIn) == 0u)
+            {
+                return src;
+            }
+            else
+            {
+                return sequentialSrc<FragIn, FragsIn...>(src);
+            }
+        }
+
+        // Re-cast steps must be identity permutations
+        template <typename FragOut, typename FragIn>
+        static inline bool stepTest()
+        {
+            using StepT = Step<FragOut, FragIn>;
+
+            constexpr uint32_t WaveSize = GetIOConfig_t<FragOut>::IOTraits::ThreadsPerIO;
+            constexpr uint32_t Size     = GetIOConfig_t<FragOut>::IOTraits::UnpackedSize;
+
+            bool err = false;
+            if constexpr((bool)StepT::IsIdentity)
+            {
+                for(uint32_t lane = 0; lane < WaveSize; lane++)
+                {
+                    for(uint32_t e = 0; e < Size; e++)
+                    {
+                        err |= !isSame(StepT::srcRegisterCoord(lane, e), make_coord2d(lane, e));
+                    }
+                }
+            }
+            return err;
+        }
+
+        // Frags are the sequential chain of fragment types, from final to source.
+        // LazyT is the lazy fragment type at the end of the same chain.
+        template <typename LazyT, typename FragOut, typename... FragsIn>
+        static inline bool chainTest()
+        {
+            using FragIn = std::tuple_element_t<sizeof...(FragsIn) - 1u, std::tuple<FragsIn...>>;
+            using Fused  = Step<FragOut, FragIn>;
+
+            static_assert(std::is_same_v<typename LazyT::Type, FragOut>,
+                          "Lazy chain does not match the sequential chain type");
+            static_assert(std::is_same_v<typename LazyT::SourceType, FragIn>,
+                          "Lazy chain does not hold the source fragment");
+
+            constexpr uint32_t WaveSize = GetIOConfig_t<FragOut>::IOTraits::ThreadsPerIO;
+            constexpr uint32_t Size     = GetIOConfig_t<FragOut>::IOTraits::UnpackedSize;
+
+            bool err = false;
+            for(uint32_t lane = 0; lane < WaveSize; lane++)
+            {
+                for(uint32_t e = 0; e < Size; e++)
+                {
+                    auto fused      = Fused::srcRegisterCoord(lane, e);
+                    auto sequential = sequentialSrc<FragOut, FragsIn...>(make_coord2d(lane, e));
+
+                    err |= !isSame(fused, sequential);
+                    err |= (Fused::IsIdentity && !isSame(fused, make_coord2d(lane, e)));
+                }
+            }
+
+            return err;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                using Lazy0 = lazy_fragment<FragT>;
+
+                // Round trip: data layout change and back
+                using Frag1A = ApplyDataLayout_t<FragT, OrthoLayout>;
+                using Frag2A = ApplyDataLayout_t<Frag1A, DataLayoutT>;
+                using Lazy2A
+                    = ApplyDataLayout_t<ApplyDataLayout_t<Lazy0, OrthoLayout>, DataLayoutT>;
+
+                // Data layout change, transpose and data layout change
+                using Frag1B = ApplyDataLayout_t<FragT, OrthoLayout>;
+                using Frag2B = ApplyTranspose_t<Frag1B>;
+                using Frag3B = ApplyDataLayout_t<Frag2B, OrthoLayout>;
+                using Lazy3B = ApplyDataLayout_t<
+                    ApplyTranspose_t<ApplyDataLayout_t<Lazy0, OrthoLayout>>,
+                    OrthoLayout>;
+
+                // Transpose, data layout change and transpose
+                using Frag1C = ApplyTranspose_t<FragT>;
+                using Frag2C = ApplyDataLayout_t<Frag1C, DataLayoutT>;
+                using Frag3C = ApplyTranspose_t<Frag2C>;
+                using Lazy3C
+                    = ApplyTranspose_t<ApplyDataLayout_t<ApplyTranspose_t<Lazy0>, DataLayoutT>>;
+
+                bool err = stepTest<Frag1A, FragT>() || stepTest<Frag2A, Frag1A>()
+                           || stepTest<Frag2B, Frag1B>() || stepTest<Frag3B, Frag2B>()
+                           || stepTest<Frag1C, FragT>() || stepTest<Frag2C, Frag1C>()
+                           || stepTest<Frag3C, Frag2C>();
+
+                err = err || chainTest<Lazy2A, Frag2A, Frag1A, FragT>()
+                      || chainTest<Lazy3B, Frag3B, Frag2B, Frag1B, FragT>()
+                      || chainTest<Lazy3C, Frag3C, Frag2C, Frag1C, FragT>();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // Device-side check of lazy layout transform chains.
+    // The materialized lazy chains must equal the eager chains, element by element.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct LazyTransformsDeviceKernel final
+        : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+    public:
+        LazyTransformsDeviceKernel()        = default;
+        ~LazyTransformsDeviceKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+            dataInstance->copyData(dataInstance->deviceOut(), dataInstance->hostOut(), 1);
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Cache current kernel result from device
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), 1);
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                lazyTransformsTest<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    template <template <typename MatrixT,
+                        uint32_t BlockM,
+                        uint32_t BlockN,
+                        uint32_t BlockK,
+                        typename DataT,
+                        typename DataLayoutT>
+              typename Func>
+    struct LazyTransformsGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = Func<std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                                 std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                                 std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                                 std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                 std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                 std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                                 >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_LAZY_TRANSFORMS_HPP
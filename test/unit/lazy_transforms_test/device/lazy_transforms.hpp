@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_LAZY_TRANSFORMS_HPP
+#define ROCWMMA_DEVICE_LAZY_TRANSFORMS_HPP
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_transforms.hpp>
+
+static constexpr uint32_t ERROR_VALUE   = 7u;
+static constexpr uint32_t SUCCESS_VALUE = 0u;
+
+namespace rocwmma
+{
+    template <typename FragT, typename OtherT>
+    ROCWMMA_DEVICE static inline bool isEqual(FragT const& frag, OtherT const& other)
+    {
+        static_assert(std::is_same_v<FragT, OtherT>,
+                      "Lazy chain does not match the eager chain type");
+
+        bool err = false;
+        for(uint32_t i = 0; i < frag.num_elements; i++)
+        {
+            err |= (static_cast<float32_t>(frag.x[i]) != static_cast<float32_t>(other.x[i]));
+        }
+        return !err;
+    }
+
+    // Each wave fills a fragment with unique values, exact in every data type, and
+    // compares element by element the materialized lazy chains against the eager chains:
+    // - Round trip: data layout change and back (fused into a reinterpret).
+    // - Data layout change, transpose and data layout change (fused into one aos<->soa pass).
+    // - Transpose, data layout change and transpose.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_KERNEL void lazyTransformsTest(uint32_t     m,
+                                           uint32_t     n,
+                                           DataT const* in,
+                                           DataT*       out,
+                                           uint32_t     ld,
+                                           DataT        param1,
+                                           DataT        param2)
+    {
+        using FragT       = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using OrthoLayout = orthogonal_layout_t<DataLayoutT>;
+
+        __shared__ int32_t result;
+        result = 0;
+        synchronize_workgroup();
+
+        bool err = false;
+
+        // Fragments hold at most 2048 elements, which are exact in float16
+        auto frag = FragT();
+        for(uint32_t i = 0; i < frag.num_elements; i++)
+        {
+            auto value = static_cast<float32_t>((threadIdx.x * frag.num_elements + i) % 2048u);
+            frag.x[i]  = static_cast<DataT>(value);
+        }
+
+        // Round trip: data layout change and back
+        auto eagerA = applyDataLayout<DataLayoutT>(applyDataLayout<OrthoLayout>(frag));
+        auto lazyA  = materialize(
+            applyDataLayout<DataLayoutT>(applyDataLayout<OrthoLayout>(deferTransforms(frag))));
+        err |= !isEqual(lazyA, eagerA);
+
+        // Data layout change, transpose and data layout change
+        auto eagerB = applyDataLayout<OrthoLayout>(
+            applyTranspose(applyDataLayout<OrthoLayout>(frag)));
+        auto lazyB = materialize(applyDataLayout<OrthoLayout>(
+            applyTranspose(applyDataLayout<OrthoLayout>(deferTransforms(frag)))));
+        err |= !isEqual(lazyB, eagerB);
+
+        // Transpose, data layout change and transpose
+        auto eagerC = applyTranspose(applyDataLayout<DataLayoutT>(applyTranspose(frag)));
+        auto lazyC  = materialize(
+            applyTranspose(applyDataLayout<DataLayoutT>(applyTranspose(deferTransforms(frag)))));
+        err |= !isEqual(lazyC, eagerC);
+
+        // Reduce error count
+        atomicAdd(&result, (int32_t)err);
+
+        // Wait for all threads
+        synchronize_workgroup();
+
+        // Just need one thread to update output
+        if(threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0 && blockIdx.x == 0
+           && blockIdx.y == 0 && blockIdx.z == 0)
+        {
+            out[0] = static_cast<DataT>(result == 0 ? SUCCESS_VALUE : ERROR_VALUE);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_LAZY_TRANSFORMS_HPP
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_BROADCAST_MAPPING_HPP
+#define ROCWMMA_DETAIL_BROADCAST_MAPPING_HPP
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of the lane to vector element mapping of the broadcast loaders.
+    // Every register element must receive the vector element at the row (column vector)
+    // or column (row vector) that a regular load would have read it from.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct BroadcastMappingKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+    public:
+        BroadcastMappingKernel()        = default;
+        ~BroadcastMappingKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        template <uint32_t VectorIndex>
+        bool mappingTest()
+        {
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using IOConfig = GetIOConfig_t<FragT>;
+            using IOShape  = typename IOConfig::IOShape;
+            using IOTraits = typename IOConfig::IOTraits;
+            using Loader   = typename IOConfig::template BroadcastLoader<VectorIndex>;
+
+            // The regular IO mapping is shared by all loaders and storers
+            using Reference = typename IOConfig::AtomicStorer;
+
+            constexpr auto IsRowMajor   = std::is_same_v<DataLayoutT, row_major>;
+            constexpr auto IsContiguous = (bool)Loader::Traits::IsContiguous;
+            constexpr auto VW           = IOConfig::IOLayout::VW;
+
+            auto ldm = IsRowMajor ? IOShape::BlockWidth : IOShape::BlockHeight;
+
+            bool err = false;
+            for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+            {
+                for(uint32_t i = 0; i < IOTraits::IOCount; i++)
+                {
+                    auto offset = Loader::vectorOffset(lane, i);
+
+                    // IOs reusing an earlier IO's registers must read the same elements
+                    err |= (Loader::vectorOffset(lane, Loader::sourceIteration(i)) != offset);
+
+                    for(uint32_t v = 0; v < VW; v++)
+                    {
+                        // Matrix coordinate of the element in the regular load
+                        uint32_t idx    = Reference::dataOffset(lane, i, ldm) + v;
+                        uint32_t major  = idx / ldm;
+                        uint32_t minor  = idx % ldm;
+                        uint32_t row    = IsRowMajor ? major : minor;
+                        uint32_t col    = IsRowMajor ? minor : major;
+                        uint32_t expect = VectorIndex == 0u ? row : col;
+
+                        err |= (offset + (IsContiguous ? v : 0u) != expect);
+                    }
+                }
+            }
+
+            return err;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                // Column vector, then row vector
+                bool err = mappingTest<0u>() || mappingTest<1u>();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct BroadcastMappingGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = BroadcastMappingKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_BROADCAST_MAPPING_HPP
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <type_traits>
+
+#include "detail/load_matrix_broadcast.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+#include "unit_test_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <typename GeneratorImpl>
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // Types: Base IOC
+        // Block Sizes: 32 x BlockN
+        // Layouts: N, T
+        using Types        = typename Base::TestTypesIOC;
+        using BlockSizes   = typename Base::TestBlockSizes32;
+        using Layouts      = typename Base::TestLayoutsAll;
+        using KernelParams = typename CombineLists<Types, BlockSizes, Layouts>::Result;
+
+        // Assemble the kernel generator
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+    };
+
+    using LoadMatrixBroadcastTestParamsARow   = TestParams<LoadMatrixBroadcastGeneratorARow>;
+    using LoadMatrixBroadcastTestParamsACol   = TestParams<LoadMatrixBroadcastGeneratorACol>;
+    using LoadMatrixBroadcastTestParamsBRow   = TestParams<LoadMatrixBroadcastGeneratorBRow>;
+    using LoadMatrixBroadcastTestParamsBCol   = TestParams<LoadMatrixBroadcastGeneratorBCol>;
+    using LoadMatrixBroadcastTestParamsAccRow = TestParams<LoadMatrixBroadcastGeneratorAccRow>;
+    using LoadMatrixBroadcastTestParamsAccCol = TestParams<LoadMatrixBroadcastGeneratorAccCol>;
+
+} // namespace rocwmma
+
+// Test suites for unique parameterization
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastARowTest32, LoadMatrixBroadcastTestParamsARow)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastAColTest32, LoadMatrixBroadcastTestParamsACol)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastBRowTest32, LoadMatrixBroadcastTestParamsBRow)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastBColTest32, LoadMatrixBroadcastTestParamsBCol)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastAccRowTest32,
+                                  LoadMatrixBroadcastTestParamsAccRow)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(LoadMatrixBroadcastAccColTest32,
+                                  LoadMatrixBroadcastTestParamsAccCol)
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_MMA_CALIBRATION_HPP
+#define ROCWMMA_DETAIL_MMA_CALIBRATION_HPP
+
+#include <cmath>
+
+#include "device/mma_calibration.hpp"
+#include "perf_calibration.hpp"
+#include "rocwmma_logging.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+    // Best independent throughput of this run per arch and input type,
+    // over all of the mma block sizes.
+    inline PerfCalibration& measuredCalibration()
+    {
+        static PerfCalibration calibration;
+        return calibration;
+    }
+
+    // Times mma_sync chains on register-resident fragments.
+    // Dependent chains run a single wave, and report the mma latency in cycles.
+    // Independent chains fill every CU, and report the peak flops / CU / clock.
+    // With --calibration_out, the best independent peak of each input type is
+    // merged into the calibration file as it is measured.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              MmaChain Chain>
+    struct MmaCalibrationKernel final : public UnitKernelBase<BlockM, BlockN, ComputeT, row_major>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, ComputeT, row_major>;
+
+        enum : uint32_t
+        {
+            // mma_syncs per chain, long enough to hide the launch overhead
+            Iterations = 16384u,
+
+            // Cold runs warm up clocks, hot runs are timed
+            ColdRuns = 2u,
+            HotRuns  = 10u,
+
+            // Workgroups per CU for independent chains
+            WorkgroupsPerCu = 2u,
+
+            Chains = static_cast<uint32_t>(Chain)
+        };
+
+    public:
+        MmaCalibrationKernel()        = default;
+        ~MmaCalibrationKernel() final = default;
+
+        dim3 gridDim() const final
+        {
+            return Chain == MmaChain::Dependent
+                       ? dim3(1)
+                       : dim3(Base::DeviceInfo::instance()->cuCount() * WorkgroupsPerCu);
+        }
+
+        // The grid does not depend on the problem size
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        uint32_t waveCount() const
+        {
+            return gridDim().x * Base::mTBlockX * Base::mTBlockY
+                   / Base::DeviceInfo::instance()->warpSize();
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // One output block per wave
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage({waveCount() * BlockM, BlockN});
+
+            CHECK_HIP_ERROR(hipMalloc(&mDeviceMmaCount, sizeof(uint32_t)));
+            CHECK_HIP_ERROR(hipMemset(mDeviceMmaCount, 0, sizeof(uint32_t)));
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                auto mmaKernel = [this]() {
+                    auto& dataInstance = Base::DataStorage::instance();
+
+                    hipExtLaunchKernelGGL(
+                        (MmaCalibration<BlockM, BlockN, BlockK, InputT, ComputeT, Chain>),
+                        (this->gridDim()), // Wg grid size
+                        (this->blockDim()), // Thread block size
+                        0, // sharedMemBytes
+                        0, // stream
+                        nullptr, // Event start
+                        nullptr, // event stop
+                        0, // flags
+                        static_cast<uint32_t>(Iterations), // iterations
+                        dataInstance->deviceOut().get(), // Out*
+                        mDeviceMmaCount); // mmaCount*
+                };
+
+                for(uint32_t i = 0; i < ColdRuns; ++i)
+                {
+                    mmaKernel();
+                }
+
+                hipEvent_t startEvent, stopEvent;
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < HotRuns; ++i)
+                {
+                    mmaKernel();
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                CHECK_HIP_ERROR(hipMemcpy(
+                    &mMmaCount, mDeviceMmaCount, sizeof(uint32_t), hipMemcpyDeviceToHost));
+
+                // No mma instruction on this arch for the types and block size
+                if(mMmaCount == 0u)
+                {
+                    Base::mRunFlag = false;
+                    return;
+                }
+
+                auto& deviceInfo       = Base::DeviceInfo::instance();
+                auto  freqMhz          = deviceInfo->curFreqMhz();
+                auto  cuCount          = deviceInfo->cuCount();
+                auto  peakGFlopsPerSec = deviceInfo->template peakGFlopsPerSec<InputT>();
+                auto  mmaSyncs         = static_cast<float64_t>(waveCount()) * Iterations * Chains;
+
+                Base::mElapsedTimeMs        = float64_t(timeMs);
+                Base::mTotalGFlops          = calculateGFlops(BlockM, BlockN, BlockK) * mmaSyncs;
+                Base::mMeasuredTFlopsPerSec = Base::mTotalGFlops * HotRuns / Base::mElapsedTimeMs;
+                Base::mEfficiency
+                    = round(Base::mMeasuredTFlopsPerSec * 1.0e3 / peakGFlopsPerSec * 100.0);
+
+                // Clocks between the issue of consecutive mmas of a chain
+                auto clocks   = Base::mElapsedTimeMs * 1.0e-3 * freqMhz * 1.0e6 / HotRuns;
+                mCyclesPerMma = clocks / (static_cast<float64_t>(Iterations) * Chains * mMmaCount);
+                mMultiplier   = Base::mTotalGFlops * 1.0e9 / (clocks * cuCount);
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+            auto  size         = waveCount() * BlockM * BlockN;
+
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), size);
+
+            // Every accumulator keeps its initial value of 1
+            Base::mValidationResult = true;
+            for(uint32_t i = 0; i < size; i++)
+            {
+                auto result = static_cast<float32_t>(dataInstance->hostOut().get()[i]);
+                Base::mValidationResult &= (result == static_cast<float32_t>(Chains));
+            }
+        }
+
+        void reportResults() final
+        {
+            Base::reportResults();
+
+            if(Chain == MmaChain::Independent && Base::mRunFlag && Base::mValidationResult)
+            {
+                auto  gcnArchName = Base::DeviceInfo::instance()->getDeviceProps().gcnArchName;
+                auto  arch        = PerfCalibration::archKey(gcnArchName);
+                auto  dataType    = dataTypeToString<InputT>();
+                auto& measured    = measuredCalibration();
+
+                if(mMultiplier > measured.multiplier(arch, dataType))
+                {
+                    measured.set(arch, dataType, mMultiplier);
+                    writeCalibration();
+                }
+            }
+        }
+
+        void tearDown() final
+        {
+            if(mDeviceMmaCount != nullptr)
+            {
+                CHECK_HIP_ERROR(hipFree(mDeviceMmaCount));
+                mDeviceMmaCount = nullptr;
+            }
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, BlkK, InputT, ComputeT, Chain, "
+                             "mmas/sync, elapsedMs, Problem Size(GFlops), TFlops/s, "
+                             "Cycles/mma, Flops/CU/clk, Efficiency(%), Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", "
+                   << BlockK << ", " << dataTypeToString<InputT>() << ", "
+                   << dataTypeToString<ComputeT>() << ", "
+                   << (Chain == MmaChain::Dependent ? "Dependent" : "Independent") << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "n/a, n/a, n/a, n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << mMmaCount << ", " << Base::mElapsedTimeMs << ", " << Base::mTotalGFlops
+                       << ", " << Base::mMeasuredTFlopsPerSec << ", " << mCyclesPerMma << ", "
+                       << mMultiplier << ", " << Base::mEfficiency << ", "
+                       << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+
+            return stream;
+        }
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+
+    private:
+        // Merge this run's peaks over the existing file, which may hold other archs
+        static void writeCalibration()
+        {
+            auto const& fileName = RocwmmaLogging::instance()->calibrationOut();
+            if(fileName.empty())
+            {
+                return;
+            }
+
+            PerfCalibration calibration;
+            calibration.loadFile(fileName);
+            calibration.merge(measuredCalibration());
+            if(!calibration.writeFile(fileName))
+            {
+                std::cerr << "Cannot write calibration file " << fileName << std::endl;
+            }
+        }
+
+    private:
+        uint32_t* mDeviceMmaCount = nullptr;
+        uint32_t  mMmaCount       = 0u;
+
+        float64_t mCyclesPerMma = 0.0;
+        float64_t mMultiplier   = 0.0;
+    };
+
+    template <MmaChain Chain>
+    struct MmaCalibrationGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            ComputeT = 1,
+            BlockMN  = 2,
+            BlockK   = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = MmaCalibrationKernel<std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                                       std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                                       std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                       std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                       std::tuple_element_t<ComputeT, TestParamsT>, // ComputeT
+                                       Chain>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_MMA_CALIBRATION_HPP
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_PERF_CALIBRATION_FILE_HPP
+#define ROCWMMA_DETAIL_PERF_CALIBRATION_FILE_HPP
+
+#include <sstream>
+#include <string>
+
+#include "perf_calibration.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-only test of the calibration table loading, and of the peaks derived
+    // from it for the InputT entries:
+    // - Entries are parsed around comments, blank lines and whitespace.
+    // - Later entries override earlier ones.
+    // - Malformed streams are rejected, and merge nothing.
+    // - Written tables load back unchanged.
+    // - Peaks use the calibrated multiplier if there is one, or the built-in
+    //   MfmaPerfTraits for archs and types without one.
+    template <typename InputT>
+    struct PerfCalibrationFileKernel final : public UnitKernelBase<16, 16, uint32_t, row_major>
+    {
+    private:
+        using Base = UnitKernelBase<16, 16, uint32_t, row_major>;
+
+    public:
+        PerfCalibrationFileKernel()        = default;
+        ~PerfCalibrationFileKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<uint32_t>(ERROR_VALUE);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                const std::string dataType = dataTypeToString<InputT>();
+                const uint32_t    freqMhz  = 1700u;
+                const uint32_t    cuCount  = 304u;
+
+                bool err = false;
+
+                // Parsing and lookup
+                PerfCalibration   calibration;
+                std::stringstream file;
+                file << "# Comment line\n"
+                     << "\n"
+                     << "gfx942," << dataType << ",2048 # Trailing comment\n"
+                     << "  gfx1100 , " << dataType << " , 512.5\r\n"
+                     << "gfx942,other,1\n"
+                     << "gfx942," << dataType << ",1024\n";
+
+                err |= !calibration.load(file);
+                err |= (calibration.size() != 3u);
+                err |= (calibration.multiplier("gfx942", dataType) != 1024.0);
+                err |= (calibration.multiplier("gfx1100", dataType) != 512.5);
+                err |= (calibration.multiplier("gfx942", "other") != 1.0);
+                err |= (calibration.multiplier("gfx90a", dataType) >= 0.0);
+
+                // Malformed lines reject the whole stream
+                const char* malformed[] = {"gfx942,",
+                                           "gfx942,dt",
+                                           "gfx942,dt,",
+                                           "gfx942,dt,1,2",
+                                           ",dt,1",
+                                           "gfx942,,1",
+                                           "gfx942,dt,abc",
+                                           "gfx942,dt,12abc",
+                                           "gfx942,dt,-1",
+                                           "gfx942,dt,inf",
+                                           "gfx942,dt,nan"};
+                for(auto line : malformed)
+                {
+                    std::stringstream bad;
+                    bad << "gfx942," << dataType << ",1\n" << line << "\n";
+                    err |= calibration.load(bad);
+                    err |= (calibration.size() != 3u);
+                    err |= (calibration.multiplier("gfx942", dataType) != 1024.0);
+                }
+
+                // Round trip
+                calibration.set("gfx942", dataType, 2048.0 / 3.0);
+
+                std::stringstream written;
+                calibration.write(written);
+
+                PerfCalibration loaded;
+                err |= !loaded.load(written);
+                err |= (loaded.size() != calibration.size());
+                err |= (loaded.multiplier("gfx942", dataType) != 2048.0 / 3.0);
+                err |= (loaded.multiplier("gfx1100", dataType) != 512.5);
+
+                // Merge overrides, and keeps other entries
+                PerfCalibration update;
+                update.set("gfx1100", dataType, 256.0);
+                update.set("gfx1101", dataType, 128.0);
+                loaded.merge(update);
+                err |= (loaded.size() != 4u);
+                err |= (loaded.multiplier("gfx942", dataType) != 2048.0 / 3.0);
+                err |= (loaded.multiplier("gfx1100", dataType) != 256.0);
+                err |= (loaded.multiplier("gfx1101", dataType) != 128.0);
+
+                err |= (PerfCalibration::archKey("gfx942:sramecc+:xnack-") != "gfx942");
+                err |= (PerfCalibration::archKey("gfx1100") != "gfx1100");
+
+                // Calibrated peaks
+                err |= (calculatePeakGFlopsPerSec<InputT>(loaded, "gfx1101", freqMhz, cuCount)
+                        != calculatePeakGFlopsPerSec(128.0, freqMhz, cuCount));
+
+                // Fallback on the built-in peaks
+                err |= (calculatePeakGFlopsPerSec<InputT, ArchGfx90a>(
+                            loaded, "gfx90a", freqMhz, cuCount)
+                        != calculatePeakGFlopsPerSec<InputT, ArchGfx90a>(freqMhz, cuCount));
+                err |= (calculatePeakGFlopsPerSec<InputT>(
+                            PerfCalibration(), "gfx942", freqMhz, cuCount)
+                        != calculatePeakGFlopsPerSec<InputT>(freqMhz, cuCount));
+
+                // Missing files are not loaded
+                err |= loaded.loadFile("");
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<uint32_t>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == SUCCESS_VALUE);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct PerfCalibrationFileGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT = 0,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = PerfCalibrationFileKernel<std::tuple_element_t<InputT, TestParamsT> // InputT
+                                            >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_PERF_CALIBRATION_FILE_HPP
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_MMA_CALIBRATION_HPP
+#define ROCWMMA_DEVICE_MMA_CALIBRATION_HPP
+
+#include <rocwmma/rocwmma.hpp>
+
+#include "gemm/gemm_predicates_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    // Accumulator chains of mma_sync per wave.
+    // Dependent chains measure the mma latency, independent chains the throughput.
+    enum struct MmaChain : uint32_t
+    {
+        Dependent   = 1u,
+        Independent = 4u
+    };
+
+    // Runs iterations x chains mma_syncs per wave on register-resident fragments.
+    // Zero inputs leave each accumulator at 1, so out holds the number of chains
+    // for every element of each wave's block. The mma instruction count of one
+    // mma_sync on the current arch is written to mmaCount, or left at 0 if the
+    // arch has no instruction for the types and block size.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              MmaChain Chain>
+    __global__ void MmaCalibration(uint32_t iterations, ComputeT* out, uint32_t* mmaCount)
+    {
+        using Predicates = GemmPredicatesBase<BlockM,
+                                              BlockN,
+                                              BlockK,
+                                              InputT,
+                                              ComputeT,
+                                              ComputeT,
+                                              1u,
+                                              1u,
+                                              Constants::AMDGCN_WAVE_SIZE,
+                                              1u,
+                                              Constants::AMDGCN_WAVE_SIZE,
+                                              Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        if constexpr(Predicates::enableBuild())
+        {
+            constexpr uint32_t Chains = static_cast<uint32_t>(Chain);
+
+            using MMA = conditional_t<(bool)ROCWMMA_ARCH_GFX9,
+                                      Mfma<InputT, ComputeT, BlockM, BlockN, BlockK>,
+                                      Wmma<InputT, ComputeT, BlockM, BlockN, BlockK>>;
+
+            auto fragA = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, row_major>();
+            auto fragB = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, col_major>();
+            fragment<accumulator, BlockM, BlockN, BlockK, ComputeT> fragsAcc[Chains];
+
+            fill_fragment(fragA, static_cast<InputT>(0));
+            fill_fragment(fragB, static_cast<InputT>(0));
+            for(uint32_t c = 0; c < Chains; c++)
+            {
+                fill_fragment(fragsAcc[c], static_cast<ComputeT>(1));
+            }
+
+            for(uint32_t i = 0; i < iterations; i++)
+            {
+#pragma unroll
+                for(uint32_t c = 0; c < Chains; c++)
+                {
+                    mma_sync(fragsAcc[c], fragA, fragB, fragsAcc[c]);
+                }
+            }
+
+            // Fold the chains so that none of them are dead code
+            for(uint32_t c = 1; c < Chains; c++)
+            {
+                for(int e = 0; e < fragsAcc[0].num_elements; e++)
+                {
+                    fragsAcc[0].x[e] += fragsAcc[c].x[e];
+                }
+            }
+
+            auto  waveIndex = (blockIdx.x * blockDim.x * blockDim.y
+                               + threadIdx.y * blockDim.x + threadIdx.x)
+                              / Constants::AMDGCN_WAVE_SIZE;
+            auto* write     = out + waveIndex * BlockM * BlockN;
+            store_matrix_sync(write, fragsAcc[0], BlockN, mem_row_major);
+
+            if(blockIdx.x == 0 && threadIdx.x == 0 && threadIdx.y == 0)
+            {
+                *mmaCount = BlockK / MMA::Traits::MinK;
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_MMA_CALIBRATION_HPP
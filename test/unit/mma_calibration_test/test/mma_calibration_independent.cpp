@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <type_traits>
+
+#include "detail/mma_calibration.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+#include "unit_test_macros.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // One config per amdgcn_mfma / amdgcn_wmma specialization:
+        // InputT, ComputeT, BlockM = BlockN, and the smallest BlockK valid on all archs.
+        // Archs without an instruction for the config skip it at runtime.
+        using Types = std::tuple<std::tuple<float8_t, float32_t, I<16>, I<32>>,
+                                 std::tuple<float8_t, float32_t, I<32>, I<16>>,
+                                 std::tuple<bfloat8_t, float32_t, I<16>, I<32>>,
+                                 std::tuple<bfloat8_t, float32_t, I<32>, I<16>>,
+                                 std::tuple<int8_t, int32_t, I<16>, I<32>>,
+                                 std::tuple<int8_t, int32_t, I<32>, I<16>>,
+                                 std::tuple<float16_t, float16_t, I<16>, I<16>>,
+                                 std::tuple<float16_t, float16_t, I<32>, I<8>>,
+                                 std::tuple<float16_t, float32_t, I<16>, I<16>>,
+                                 std::tuple<float16_t, float32_t, I<32>, I<8>>,
+#if !ROCWMMA_TESTS_NO_HALF
+                                 std::tuple<hfloat16_t, hfloat16_t, I<16>, I<16>>,
+                                 std::tuple<hfloat16_t, hfloat16_t, I<32>, I<8>>,
+                                 std::tuple<hfloat16_t, float32_t, I<16>, I<16>>,
+                                 std::tuple<hfloat16_t, float32_t, I<32>, I<8>>,
+#endif // !ROCWMMA_TESTS_NO_HALF
+                                 std::tuple<bfloat16_t, bfloat16_t, I<16>, I<16>>,
+                                 std::tuple<bfloat16_t, bfloat16_t, I<32>, I<8>>,
+                                 std::tuple<bfloat16_t, float32_t, I<16>, I<16>>,
+                                 std::tuple<bfloat16_t, float32_t, I<32>, I<8>>,
+                                 std::tuple<xfloat32_t, float32_t, I<16>, I<8>>,
+                                 std::tuple<xfloat32_t, float32_t, I<32>, I<4>>,
+                                 std::tuple<float32_t, float32_t, I<16>, I<4>>,
+                                 std::tuple<float32_t, float32_t, I<32>, I<2>>,
+                                 std::tuple<float64_t, float64_t, I<16>, I<4>>>;
+        using KernelParams = typename CombineLists<Types>::Result;
+
+        // Assemble the kernel generator
+        // Kernel: MmaCalibration<MmaChain::Independent>
+        using GeneratorImpl   = MmaCalibrationGenerator<MmaChain::Independent>;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        // One wave per SIMD, in several workgroups per CU
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            // clang-format off
+            return { {warpSize * 4, 1} };
+            // clang-format on
+        }
+
+        // The grid covers the device regardless of the problem size
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            // clang-format off
+            return { {1, 1} };
+            // clang-format on
+        }
+    };
+
+} // namespace rocwmma
+
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(MmaCalibrationIndependentTest, TestParams)
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_NATIVE_FORMAT_HPP
+#define ROCWMMA_DETAIL_NATIVE_FORMAT_HPP
+
+#include "device/native_format.hpp"
+#include "helper_macros.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM, uint32_t BlockK, typename InputT, typename ComputeT>
+    struct NativeFormatKernel final : public UnitKernelBase<BlockM, BlockM, ComputeT, row_major>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockM, ComputeT, row_major>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard
+            = NativeFormatPredicates<BlockM, BlockM, BlockK, InputT, ComputeT, WaveSize, ArchId>;
+
+        uint32_t resultCount() const
+        {
+            auto gridDims = Base::gridDim();
+            return gridDims.x * gridDims.y;
+        }
+
+    public:
+        NativeFormatKernel()        = default;
+        ~NativeFormatKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            // Small integers, exact in every data type
+            const int64_t sizeC = Base::mM * Base::mN;
+            for(int64_t i = 0; i < sizeC; i++)
+            {
+                dataInstance->hostIn().get()[i]
+                    = static_cast<ComputeT>(static_cast<float32_t>(i % 9) - 4.0f);
+            }
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), sizeC);
+
+            for(uint32_t i = 0; i < resultCount(); i++)
+            {
+                dataInstance->hostOut().get()[i] = static_cast<ComputeT>(ERROR_VALUE);
+            }
+            dataInstance->copyData(
+                dataInstance->deviceOut(), dataInstance->hostOut(), resultCount());
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Cache current kernel result from device
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), resultCount());
+
+            // Check the result of each workgroup
+            Base::mValidationResult = true;
+            for(uint32_t i = 0; i < resultCount(); i++)
+            {
+                Base::mValidationResult
+                    &= (dataInstance->hostOut().get()[i] == static_cast<ComputeT>(SUCCESS_VALUE));
+            }
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Skip archs without an mma instruction for the types and block size
+            auto dispatchGuard = [waveSize, deviceArch]() {
+                bool dispatchResult = false;
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = TestGuard<WAVE_SIZE, ARCH_ID>::enableRun();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                          \
+    ROCWMMA_SWITCH_BODY8_ARG1(deviceArch,            \
+                              SWITCH_BODY_WAVE_SIZE, \
+                              HipDevice::GFX908,     \
+                              HipDevice::GFX90A,     \
+                              HipDevice::GFX940,     \
+                              HipDevice::GFX941,     \
+                              HipDevice::GFX942,     \
+                              HipDevice::GFX1100,    \
+                              HipDevice::GFX1101,    \
+                              HipDevice::GFX1102)
+
+                DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+                return dispatchResult;
+            };
+
+            return Base::checkQuirks() && dispatchGuard();
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                nativeFormatTest<BlockM, BlockM, BlockK, InputT, ComputeT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct NativeFormatGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            ComputeT = 1,
+            BlockM   = 2,
+            BlockK   = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = NativeFormatKernel<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                     std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                     std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                     std::tuple_element_t<ComputeT, TestParamsT> // ComputeT
+                                     >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_NATIVE_FORMAT_HPP
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_NATIVE_FORMAT_HPP
+#define ROCWMMA_DEVICE_NATIVE_FORMAT_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+
+#include "gemm/gemm_predicates_base.hpp"
+#include "unit_test_traits.hpp"
+
+static constexpr uint32_t ERROR_VALUE   = 7u;
+static constexpr uint32_t SUCCESS_VALUE = 0u;
+
+namespace rocwmma
+{
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    using NativeFormatPredicates = GemmPredicatesBase<BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      ComputeT,
+                                                      ComputeT,
+                                                      1u,
+                                                      1u,
+                                                      WaveSize,
+                                                      1u,
+                                                      WaveSize,
+                                                      ArchId>;
+
+    template <typename FragT, typename OtherT>
+    ROCWMMA_DEVICE static inline bool isEqual(FragT const& frag, OtherT const& other)
+    {
+        bool err = false;
+        for(uint32_t i = 0; i < frag.num_elements; i++)
+        {
+            err |= (static_cast<float32_t>(frag.x[i]) != static_cast<float32_t>(other.x[i]));
+        }
+        return !err;
+    }
+
+    // Each wave loads its BlockM x BlockN tile of the input as accumulator C, and
+    // generates small integer A / B inputs, exact in every data type:
+    // - from_native(to_native(C)) returns C unchanged.
+    // - Repeated mma_sync on native fragments matches mma_sync on regular fragments.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename InputT, typename ComputeT>
+    __global__ void nativeFormatTest(uint32_t        m,
+                                     uint32_t        n,
+                                     ComputeT const* in,
+                                     ComputeT*       out,
+                                     uint32_t        ld,
+                                     ComputeT        param1,
+                                     ComputeT        param2)
+    {
+        using Predicates = NativeFormatPredicates<BlockM,
+                                                  BlockN,
+                                                  BlockK,
+                                                  InputT,
+                                                  ComputeT,
+                                                  Constants::AMDGCN_WAVE_SIZE,
+                                                  Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        __shared__ int32_t result;
+        result = 0;
+        synchronize_workgroup();
+
+        bool err = false;
+
+        if constexpr(Predicates::enableBuild())
+        {
+            // Accumulations of the same A * B
+            constexpr uint32_t Reps = 4u;
+
+            using Mapping = MappingUtil<BlockM, BlockN, ComputeT, row_major>;
+
+            auto fragA = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, row_major>();
+            auto fragB = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, col_major>();
+            auto fragC = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>();
+
+            for(uint32_t i = 0; i < fragA.num_elements; i++)
+            {
+                auto value = static_cast<float32_t>((threadIdx.x + i) % 5u) - 2.0f;
+                fragA.x[i] = static_cast<InputT>(value);
+            }
+            for(uint32_t i = 0; i < fragB.num_elements; i++)
+            {
+                auto value = static_cast<float32_t>((threadIdx.x * i) % 3u) - 1.0f;
+                fragB.x[i] = static_cast<InputT>(value);
+            }
+            load_matrix_sync(fragC, Mapping::dataCoord(in, ld), ld, mem_row_major);
+
+            // Round trip of the accumulator format
+            err |= !isEqual(from_native(to_native(fragC)), fragC);
+
+            // Reference: mma_sync formats the inputs and accumulator on every call
+            auto fragRef = fragC;
+            for(uint32_t r = 0; r < Reps; r++)
+            {
+                mma_sync(fragRef, fragA, fragB, fragRef);
+            }
+
+            // Native: formatted once, accumulated in place
+            auto nativeA   = to_native(fragA);
+            auto nativeB   = to_native(fragB);
+            auto nativeAcc = to_native(fragC);
+            for(uint32_t r = 0; r < Reps; r++)
+            {
+                mma_sync(nativeAcc, nativeA, nativeB, nativeAcc);
+            }
+
+            err |= !isEqual(from_native(nativeAcc), fragRef);
+        }
+
+        // Reduce error count
+        atomicAdd(&result, (int32_t)err);
+
+        // Wait for all threads
+        synchronize_workgroup();
+
+        // One result per workgroup
+        if(threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0)
+        {
+            out[blockIdx.y * gridDim.x + blockIdx.x]
+                = static_cast<ComputeT>(result == 0 ? SUCCESS_VALUE : ERROR_VALUE);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_NATIVE_FORMAT_HPP
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_PACKED_IO_HPP
+#define ROCWMMA_DETAIL_PACKED_IO_HPP
+
+#include <vector>
+
+#include "device/packed_io.hpp"
+#include "helper_macros.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Host-side packing of a whole m x n matrix, one block at a time
+    template <typename FragT, uint32_t BlockM, uint32_t BlockN, typename Layout, typename DataT>
+    static inline void packMatrix(DataT* packed, DataT const* data, uint32_t m, uint32_t n)
+    {
+        constexpr auto IsRowMajor = std::is_same<Layout, row_major>::value;
+
+        auto ld = IsRowMajor ? n : m;
+
+        for(uint32_t blockRow = 0u; blockRow < m / BlockM; blockRow++)
+        {
+            for(uint32_t blockCol = 0u; blockCol < n / BlockN; blockCol++)
+            {
+                auto row = blockRow * BlockM;
+                auto col = blockCol * BlockN;
+
+                pack_matrix<FragT>(
+                    packed
+                        + packedBlockOffset<BlockM, BlockN>(make_coord2d(blockRow, blockCol), n),
+                    data + (IsRowMajor ? row * ld + col : col * ld + row),
+                    ld);
+            }
+        }
+    }
+
+    // Wrapper into the actual device function
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct PackedIOKernel : public UnitKernelBase<BlockM, BlockN, DataT, Layout>
+    {
+    protected:
+        using Base  = UnitKernelBase<BlockM, BlockN, DataT, Layout>;
+        using FragT = TestFragment_t<MatrixT, BlockM, BlockN, DataT, Layout>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = FragSize_guard<BlockM, BlockN, DataT, Layout, WaveSize, ArchId>;
+
+    public:
+        PackedIOKernel()          = default;
+        virtual ~PackedIOKernel() = default;
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // The test guard for this class requires 2 values at runtime.
+            auto dispatchGuard = [waveSize, deviceArch]() {
+                bool dispatchResult = false;
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = TestGuard<WAVE_SIZE, ARCH_ID>::enable();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                          \
+    ROCWMMA_SWITCH_BODY8_ARG1(deviceArch,            \
+                              SWITCH_BODY_WAVE_SIZE, \
+                              HipDevice::GFX908,     \
+                              HipDevice::GFX90A,     \
+                              HipDevice::GFX940,     \
+                              HipDevice::GFX941,     \
+                              HipDevice::GFX942,     \
+                              HipDevice::GFX1100,    \
+                              HipDevice::GFX1101,    \
+                              HipDevice::GFX1102)
+
+                DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+                return dispatchResult;
+            };
+
+            // Packed data is only supported on wave64 targets
+            bool packerGuard = (waveSize == HipDevice::Wave64);
+
+            return Base::checkQuirks() && dispatchGuard() && packerGuard;
+        }
+
+        virtual typename Base::KernelFunc kernelImpl() const = 0;
+    };
+
+    // Host packed input -> load_matrix_packed_sync -> store_matrix_sync
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct PackedLoadKernel final : public PackedIOKernel<MatrixT, BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = PackedIOKernel<MatrixT, BlockM, BlockN, DataT, Layout>;
+
+    public:
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Initialize matrix storage
+            dataInstance->resizeStorage(probsize);
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            // Original data in hostIn, packed data in hostOut
+            MatrixUtil<Layout>::fill(dataInstance->hostIn().get(), Base::mM, Base::mN);
+            packMatrix<typename Base::FragT, BlockM, BlockN, Layout>(
+                dataInstance->hostOut().get(), dataInstance->hostIn().get(), Base::mM, Base::mN);
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostOut(), sizeD);
+            MatrixUtil<Layout>::fillValLaunchKernel(
+                dataInstance->deviceOut().get(), Base::mM, Base::mN, static_cast<DataT>(100));
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            // Unpacked output must match the original data
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), sizeD);
+
+            double errorTolerance = 1.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<DataT, DataT, Layout, Layout>(dataInstance->hostIn().get(),
+                                                             dataInstance->hostOut().get(),
+                                                             Base::mM,
+                                                             Base::mN,
+                                                             errorTolerance);
+        }
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(PackedLoad<MatrixT, BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Input -> load_matrix_sync -> store_matrix_packed_sync, checked against host packing
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct PackedStoreKernel final : public PackedIOKernel<MatrixT, BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = PackedIOKernel<MatrixT, BlockM, BlockN, DataT, Layout>;
+
+    public:
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Initialize matrix storage
+            dataInstance->resizeStorage(probsize);
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            MatrixUtil<Layout>::fill(dataInstance->hostIn().get(), Base::mM, Base::mN);
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), sizeD);
+            MatrixUtil<Layout>::fillValLaunchKernel(
+                dataInstance->deviceOut().get(), Base::mM, Base::mN, static_cast<DataT>(100));
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            // Device packed output must match host packed data
+            auto reference = std::vector<DataT>(sizeD);
+            packMatrix<typename Base::FragT, BlockM, BlockN, Layout>(
+                reference.data(), dataInstance->hostIn().get(), Base::mM, Base::mN);
+
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), sizeD);
+
+            double errorTolerance = 1.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<DataT, DataT, Layout, Layout>(reference.data(),
+                                                             dataInstance->hostOut().get(),
+                                                             Base::mM,
+                                                             Base::mN,
+                                                             errorTolerance);
+        }
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(PackedStore<MatrixT, BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <template <typename, uint32_t, uint32_t, typename, typename> class KernelClass,
+              typename MatrixT>
+    struct PackedIOGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT  = 0,
+            BlockM = 1,
+            BlockN = 2,
+            Layout = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT = KernelClass<MatrixT,
+                                        std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                        std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                        std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                        std::tuple_element_t<Layout, TestParamsT> // Layout
+                                        >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+    using PackedLoadGeneratorA    = PackedIOGenerator<PackedLoadKernel, matrix_a>;
+    using PackedLoadGeneratorB    = PackedIOGenerator<PackedLoadKernel, matrix_b>;
+    using PackedLoadGeneratorAcc  = PackedIOGenerator<PackedLoadKernel, accumulator>;
+    using PackedStoreGeneratorA   = PackedIOGenerator<PackedStoreKernel, matrix_a>;
+    using PackedStoreGeneratorB   = PackedIOGenerator<PackedStoreKernel, matrix_b>;
+    using PackedStoreGeneratorAcc = PackedIOGenerator<PackedStoreKernel, accumulator>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_PACKED_IO_HPP
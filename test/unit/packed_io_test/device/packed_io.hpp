@@ -0,0 +1,192 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_PACKED_IO_HPP
+#define ROCWMMA_DEVICE_PACKED_IO_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+
+    // Mapping:
+    // Incoming -> Matrix A (ColNT)  : BlockM -> BlockM, BlockN -> BlockK
+    // Incoming -> Matrix B (RowNT)  : BlockM -> BlockK, BlockN -> BlockN
+    // Incoming -> Accumulator       : BlockM -> BlockM, BlockN -> BlockN
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout>
+    struct TestFragment;
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayout>
+    struct TestFragment<matrix_a, BlockM, BlockN, DataT, DataLayout>
+    {
+        using Type = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>;
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayout>
+    struct TestFragment<matrix_b, BlockM, BlockN, DataT, DataLayout>
+    {
+        using Type = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>;
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayout>
+    struct TestFragment<accumulator, BlockM, BlockN, DataT, DataLayout>
+    {
+        using Type = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>;
+    };
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout>
+    using TestFragment_t = typename TestFragment<MatrixT, BlockM, BlockN, DataT, DataLayout>::Type;
+
+    // Packed blocks are stored contiguously, in row-major order of blocks
+    template <uint32_t BlockM, uint32_t BlockN, typename BlockCoordT>
+    ROCWMMA_HOST_DEVICE static inline uint32_t packedBlockOffset(BlockCoordT const& blockCoord,
+                                                                 uint32_t           n)
+    {
+        return (get<0>(blockCoord) * (n / BlockN) + get<1>(blockCoord)) * BlockM * BlockN;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()
+                  && (Constants::AMDGCN_WAVE_SIZE == 64u)>* = nullptr>
+    __global__ void PackedLoad(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+        using FragT   = TestFragment_t<MatrixT, BlockM, BlockN, DataT, DataLayout>;
+
+        // Read packed block, write unpacked block
+        auto frag = FragT();
+        load_matrix_packed_sync(
+            frag, in + packedBlockOffset<BlockM, BlockN>(Mapping::blockCoord(), n));
+        store_matrix_sync(Mapping::dataCoord(out, ld), frag, ld);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()
+                  || (Constants::AMDGCN_WAVE_SIZE != 64u)>* = nullptr>
+    __global__ void PackedLoad(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()
+                  && (Constants::AMDGCN_WAVE_SIZE == 64u)>* = nullptr>
+    __global__ void PackedStore(uint32_t     m,
+                                uint32_t     n,
+                                DataT const* in,
+                                DataT*       out,
+                                uint32_t     ld,
+                                DataT        param1,
+                                DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+        using FragT   = TestFragment_t<MatrixT, BlockM, BlockN, DataT, DataLayout>;
+
+        // Read unpacked block, write packed block
+        auto frag = FragT();
+        load_matrix_sync(frag, Mapping::dataCoord(in, ld), ld);
+        store_matrix_packed_sync(
+            out + packedBlockOffset<BlockM, BlockN>(Mapping::blockCoord(), n), frag);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()
+                  || (Constants::AMDGCN_WAVE_SIZE != 64u)>* = nullptr>
+    __global__ void PackedStore(uint32_t     m,
+                                uint32_t     n,
+                                DataT const* in,
+                                DataT*       out,
+                                uint32_t     ld,
+                                DataT        param1,
+                                DataT        param2)
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_PACKED_IO_HPP
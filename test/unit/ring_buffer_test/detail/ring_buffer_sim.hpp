@@ -0,0 +1,337 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_RING_BUFFER_SIM_HPP
+#define ROCWMMA_DETAIL_RING_BUFFER_SIM_HPP
+
+#include <random>
+#include <vector>
+
+#include "gemm/gemm_ring_buffer.hpp"
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side model of the producer / consumer ring buffer protocol.
+    // Waves are agents that advance one action at a time, in an order chosen by the
+    // scheduling policy. Each K step is: wait -> LDS write / read -> signal.
+    // The protocol is sound if, for every interleaving:
+    // - Some wave can always make progress until all waves are done (no deadlock).
+    // - Producers never overwrite a slot that a consumer has yet to read.
+    // - Consumers only read a slot when every producer has written their K step.
+    template <uint32_t Slots>
+    struct RingBufferSim
+    {
+        using RingBuffer = CooperativeGemm::RingBuffer<Slots>;
+
+        enum struct Policy : uint32_t
+        {
+            Fifo, // Lowest ready wave first
+            Lifo, // Highest ready wave first
+            ProducersFirst,
+            ConsumersFirst,
+            Random
+        };
+
+        enum struct Action : uint32_t
+        {
+            Wait,
+            Access,
+            Signal
+        };
+
+        struct Wave
+        {
+            bool     isProducer;
+            uint32_t index;
+            uint32_t step;
+            Action   action;
+        };
+
+        RingBufferSim(uint32_t producers, uint32_t consumers, uint32_t kSteps)
+            : mProducers(producers)
+            , mConsumers(consumers)
+            , mKSteps(kSteps)
+        {
+        }
+
+        // Returns true if the protocol ran to completion without violations
+        bool run(Policy policy, uint32_t seed = 0u)
+        {
+            std::vector<uint32_t> flags(RingBuffer::flagCount(), 0u);
+            auto*                 full  = flags.data();
+            auto*                 empty = flags.data() + Slots;
+
+            // K step held in each slot, per producer
+            std::vector<int64_t> slotData(Slots * mProducers, -1);
+
+            // Consumer reads of each K step
+            std::vector<uint32_t> reads(mKSteps, 0u);
+
+            std::vector<Wave> waves;
+            for(uint32_t i = 0; i < mProducers; i++)
+            {
+                waves.push_back({true, i, 0u, Action::Wait});
+            }
+            for(uint32_t i = 0; i < mConsumers; i++)
+            {
+                waves.push_back({false, i, 0u, Action::Wait});
+            }
+
+            std::mt19937 rng(seed);
+            bool         err = false;
+
+            while(!err)
+            {
+                // Gather waves that can make progress
+                std::vector<uint32_t> ready;
+                bool                  done = true;
+                for(uint32_t w = 0; w < waves.size(); w++)
+                {
+                    auto& wave = waves[w];
+                    if(wave.step >= mKSteps)
+                    {
+                        continue;
+                    }
+
+                    done = false;
+                    if(wave.action != Action::Wait)
+                    {
+                        ready.push_back(w);
+                    }
+                    else
+                    {
+                        auto slot = RingBuffer::slot(wave.step);
+                        if(wave.isProducer
+                           && empty[slot] >= RingBuffer::emptyCount(wave.step, mConsumers))
+                        {
+                            ready.push_back(w);
+                        }
+                        else if(!wave.isProducer
+                                && full[slot] >= RingBuffer::fullCount(wave.step, mProducers))
+                        {
+                            ready.push_back(w);
+                        }
+                    }
+                }
+
+                if(done)
+                {
+                    break;
+                }
+
+                // Deadlock: nobody can move
+                if(ready.empty())
+                {
+                    err = true;
+                    break;
+                }
+
+                auto& wave = waves[pick(ready, waves, policy, rng)];
+                auto  slot = RingBuffer::slot(wave.step);
+
+                switch(wave.action)
+                {
+                case Action::Wait:
+                    wave.action = Action::Access;
+                    break;
+
+                case Action::Access:
+                    if(wave.isProducer)
+                    {
+                        // Every consumer must be done with the previous lap of this slot
+                        err |= (wave.step >= Slots) && (reads[wave.step - Slots] != mConsumers);
+                        slotData[slot * mProducers + wave.index] = wave.step;
+                    }
+                    else
+                    {
+                        // Every producer must have written this K step
+                        for(uint32_t p = 0; p < mProducers; p++)
+                        {
+                            err |= (slotData[slot * mProducers + p] != int64_t(wave.step));
+                        }
+                        reads[wave.step]++;
+                    }
+                    wave.action = Action::Signal;
+                    break;
+
+                case Action::Signal:
+                    wave.isProducer ? full[slot]++ : empty[slot]++;
+                    wave.action = Action::Wait;
+                    wave.step++;
+                    break;
+                }
+            }
+
+            // Every K step must have been read by every consumer
+            for(uint32_t i = 0; i < mKSteps; i++)
+            {
+                err |= (reads[i] != mConsumers);
+            }
+
+            return !err;
+        }
+
+    private:
+        static uint32_t pick(std::vector<uint32_t> const& ready,
+                             std::vector<Wave> const&     waves,
+                             Policy                       policy,
+                             std::mt19937&                rng)
+        {
+            switch(policy)
+            {
+            case Policy::Lifo:
+                return ready.back();
+            case Policy::ProducersFirst:
+            case Policy::ConsumersFirst:
+            {
+                bool wantProducer = (policy == Policy::ProducersFirst);
+                for(auto w : ready)
+                {
+                    if(waves[w].isProducer == wantProducer)
+                    {
+                        return w;
+                    }
+                }
+                return ready.front();
+            }
+            case Policy::Random:
+                return ready[std::uniform_int_distribution<uint32_t>(0u, ready.size() - 1u)(rng)];
+            case Policy::Fifo:
+            default:
+                return ready.front();
+            }
+        }
+
+        uint32_t mProducers;
+        uint32_t mConsumers;
+        uint32_t mKSteps;
+    };
+
+    // Host-only test of the ring buffer protocol for the given slot count.
+    // Runs every scheduling policy over a range of wave counts and K steps,
+    // including K steps that do not fill the ring and that wrap it many times.
+    template <uint32_t Slots, uint32_t Producers, uint32_t Consumers>
+    struct RingBufferSimKernel final : public UnitKernelBase<16, 16, uint32_t, row_major>
+    {
+    private:
+        using Base = UnitKernelBase<16, 16, uint32_t, row_major>;
+        using Sim  = RingBufferSim<Slots>;
+
+    public:
+        RingBufferSimKernel()        = default;
+        ~RingBufferSimKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<uint32_t>(ERROR_VALUE);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                using Policy = typename Sim::Policy;
+
+                constexpr uint32_t RandomRuns = 64u;
+                const uint32_t     kSteps[]   = {1u, Slots, Slots + 1u, 4u * Slots + 1u, 64u};
+
+                bool err = false;
+                for(auto k : kSteps)
+                {
+                    Sim sim(Producers, Consumers, k);
+
+                    err |= !sim.run(Policy::Fifo);
+                    err |= !sim.run(Policy::Lifo);
+                    err |= !sim.run(Policy::ProducersFirst);
+                    err |= !sim.run(Policy::ConsumersFirst);
+                    for(uint32_t seed = 0; seed < RandomRuns; seed++)
+                    {
+                        err |= !sim.run(Policy::Random, seed);
+                    }
+                }
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<uint32_t>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == SUCCESS_VALUE);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct RingBufferSimGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            Slots     = 0,
+            Producers = 1,
+            Consumers = 2,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = RingBufferSimKernel<
+                std::tuple_element_t<Slots, TestParamsT>::value, // Slots
+                std::tuple_element_t<Producers, TestParamsT>::value, // Producers
+                std::tuple_element_t<Consumers, TestParamsT>::value // Consumers
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_RING_BUFFER_SIM_HPP
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_ATOMIC_ADD_MAPPING_HPP
+#define ROCWMMA_DETAIL_ATOMIC_ADD_MAPPING_HPP
+
+#include <vector>
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of the lane to address mapping of the atomic storers.
+    // Every element of the block must be accumulated by exactly one lane, exactly
+    // once, and vectors must start dword-aligned whenever packed atomics apply.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct AtomicAddMappingKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+    public:
+        AtomicAddMappingKernel()        = default;
+        ~AtomicAddMappingKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        template <typename Storer>
+        bool mappingTest(uint32_t padding)
+        {
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using IOConfig = GetIOConfig_t<FragT>;
+            using IOShape  = typename IOConfig::IOShape;
+            using IOTraits = typename IOConfig::IOTraits;
+
+            constexpr auto IsRowMajor = std::is_same_v<DataLayoutT, row_major>;
+            constexpr auto VW         = IOConfig::IOLayout::VW;
+
+            auto rows = IOShape::BlockHeight;
+            auto cols = IOShape::BlockWidth;
+            auto ldm  = (IsRowMajor ? cols : rows) + padding;
+
+            std::vector<uint32_t> hits(ldm * (IsRowMajor ? rows : cols), 0u);
+
+            bool err = false;
+            for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+            {
+                for(uint32_t i = 0; i < IOTraits::IOCount; i++)
+                {
+                    int64_t offset = Storer::dataOffset(lane, i, ldm);
+
+                    // Packed 2 x 16b atomics rely on even vector offsets for even ldm
+                    if(VW % 2u == 0u && ldm % 2u == 0u)
+                    {
+                        err |= (offset % 2 != 0);
+                    }
+
+                    for(uint32_t v = 0; v < VW; v++)
+                    {
+                        auto idx = offset + v;
+
+                        // Out of bounds or in the padding
+                        if(idx < 0 || idx >= static_cast<int64_t>(hits.size())
+                           || idx % ldm >= ldm - padding)
+                        {
+                            return true;
+                        }
+                        hits[idx]++;
+                    }
+                }
+            }
+
+            // Exactly one accumulation per element, none in the padding
+            for(uint32_t idx = 0; idx < hits.size(); idx++)
+            {
+                err |= (hits[idx] != (idx % ldm < ldm - padding ? 1u : 0u));
+            }
+
+            return err;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+                using IOConfig = GetIOConfig_t<FragT>;
+
+                bool err = false;
+
+                // Both atomic and ordered storers must share the regular store mapping
+                for(auto padding : {0u, 1u, 2u})
+                {
+                    err |= mappingTest<typename IOConfig::AtomicStorer>(padding);
+                    err |= mappingTest<typename IOConfig::OrderedStorer>(padding);
+                }
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct AtomicAddMappingGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = AtomicAddMappingKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_ATOMIC_ADD_MAPPING_HPP
@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_SUB_FRAGMENT_HPP
+#define ROCWMMA_DETAIL_SUB_FRAGMENT_HPP
+
+#include "device/sub_fragment.hpp"
+#include "helper_macros.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct SubFragmentKernel : public UnitKernelBase<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, Layout>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = FragSize_guard<BlockM, BlockN, DataT, Layout, WaveSize, ArchId>;
+
+    public:
+        SubFragmentKernel()          = default;
+        virtual ~SubFragmentKernel() = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Initialize matrix storage
+            dataInstance->resizeStorage(probsize);
+
+            // Initialize matrix data on device
+            MatrixUtil<Layout>::fillLaunchKernel(
+                dataInstance->deviceIn().get(), Base::mM, Base::mN);
+            MatrixUtil<Layout>::fillValLaunchKernel(
+                dataInstance->deviceOut().get(), Base::mM, Base::mN, static_cast<DataT>(100));
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            // Every tile must be moved to its original location
+            dataInstance->copyData(dataInstance->hostIn(), dataInstance->deviceIn(), sizeD);
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), sizeD);
+
+            double errorTolerance = 1.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<DataT, DataT, Layout, Layout>(dataInstance->hostIn().get(),
+                                                             dataInstance->hostOut().get(),
+                                                             Base::mM,
+                                                             Base::mN,
+                                                             errorTolerance);
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // The test guard for this class requires 2 values at runtime.
+            auto dispatchGuard = [waveSize, deviceArch]() {
+                bool dispatchResult = false;
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = TestGuard<WAVE_SIZE, ARCH_ID>::enable();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                          \
+    ROCWMMA_SWITCH_BODY8_ARG1(deviceArch,            \
+                              SWITCH_BODY_WAVE_SIZE, \
+                              HipDevice::GFX908,     \
+                              HipDevice::GFX90A,     \
+                              HipDevice::GFX940,     \
+                              HipDevice::GFX941,     \
+                              HipDevice::GFX942,     \
+                              HipDevice::GFX1100,    \
+                              HipDevice::GFX1101,    \
+                              HipDevice::GFX1102)
+
+                DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+                return dispatchResult;
+            };
+
+            return Base::checkQuirks() && dispatchGuard();
+        }
+
+        virtual typename Base::KernelFunc kernelImpl() const = 0;
+    };
+
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct SubFragmentSliceKernel final
+        : public SubFragmentKernel<MatrixT, BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = SubFragmentKernel<MatrixT, BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                SubFragmentSlice<MatrixT, BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct SubFragmentInsertKernel final
+        : public SubFragmentKernel<MatrixT, BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = SubFragmentKernel<MatrixT, BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                SubFragmentInsert<MatrixT, BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <template <typename, uint32_t, uint32_t, typename, typename> class KernelClass,
+              typename MatrixT>
+    struct SubFragmentGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT  = 0,
+            BlockM = 1,
+            BlockN = 2,
+            Layout = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT = KernelClass<MatrixT,
+                                        std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                        std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                        std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                        std::tuple_element_t<Layout, TestParamsT> // Layout
+                                        >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+    using SubFragmentSliceGeneratorA   = SubFragmentGenerator<SubFragmentSliceKernel, matrix_a>;
+    using SubFragmentSliceGeneratorB   = SubFragmentGenerator<SubFragmentSliceKernel, matrix_b>;
+    using SubFragmentSliceGeneratorAcc = SubFragmentGenerator<SubFragmentSliceKernel, accumulator>;
+    using SubFragmentInsertGeneratorA  = SubFragmentGenerator<SubFragmentInsertKernel, matrix_a>;
+    using SubFragmentInsertGeneratorB  = SubFragmentGenerator<SubFragmentInsertKernel, matrix_b>;
+    using SubFragmentInsertGeneratorAcc
+        = SubFragmentGenerator<SubFragmentInsertKernel, accumulator>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_SUB_FRAGMENT_HPP
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_SUB_FRAGMENT_MAPPING_HPP
+#define ROCWMMA_DETAIL_SUB_FRAGMENT_MAPPING_HPP
+
+#include <rocwmma/rocwmma_transforms.hpp>
+
+#include "unit_kernel_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    static constexpr uint32_t ERROR_VALUE   = 7;
+    static constexpr uint32_t SUCCESS_VALUE = 0;
+
+    // Host-side check of the register layout model and the sub-fragment register maps.
+    // - The layout model must agree with the fragment IO mapping and be invertible.
+    // - Each sliced element must come from the same matrix coordinate in the fragment.
+    // - Each inserted element must come from the same matrix coordinate in the sub-fragment,
+    //   and elements outside of the tile must be untouched.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct SubFragmentMappingKernel final
+        : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+        // Sub-fragments are half of the fragment in every dimension
+        using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using SubFragT = fragment<MatrixT, BlockM / 2, BlockN / 2, BlockK / 2, DataT, DataLayoutT>;
+
+    public:
+        SubFragmentMappingKernel()        = default;
+        ~SubFragmentMappingKernel() final = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            // Need at least 1 element for the result
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->resizeStorage(probsize);
+
+            dataInstance->hostOut().get()[0] = static_cast<DataT>(ERROR_VALUE);
+        }
+
+        static inline bool isSame(Coord2d const& lhs, Coord2d const& rhs)
+        {
+            return (get<0>(lhs) == get<0>(rhs)) && (get<1>(lhs) == get<1>(rhs));
+        }
+
+        template <typename FragT_>
+        bool layoutTest()
+        {
+            using IOConfig     = GetIOConfig_t<FragT_>;
+            using IOShape      = typename IOConfig::IOShape;
+            using IOTraits     = typename IOConfig::IOTraits;
+            using MatrixLayout = typename IOConfig::IOLayout::MatrixLayout;
+            using Reference    = typename IOConfig::AtomicStorer;
+
+            constexpr auto IsRowMajor = std::is_same_v<DataLayoutT, row_major>;
+            constexpr auto VW         = IOConfig::IOLayout::VW;
+
+            auto ldm = IsRowMajor ? IOShape::BlockWidth : IOShape::BlockHeight;
+
+            bool err = false;
+            for(uint32_t lane = 0; lane < IOTraits::ThreadsPerIO; lane++)
+            {
+                for(uint32_t i = 0; i < IOTraits::IOCount; i++)
+                {
+                    for(uint32_t v = 0; v < VW; v++)
+                    {
+                        uint32_t idx   = Reference::dataOffset(lane, i, ldm) + v;
+                        uint32_t major = idx / ldm;
+                        uint32_t minor = idx % ldm;
+                        auto     coord = IsRowMajor ? make_coord2d(major, minor)
+                                                    : make_coord2d(minor, major);
+
+                        auto elementIdx = i * VW + v;
+                        err |= !isSame(MatrixLayout::matrixCoord(lane, elementIdx), coord);
+                        err |= !isSame(MatrixLayout::registerCoord(coord),
+                                       make_coord2d(lane, elementIdx));
+                    }
+                }
+            }
+
+            return err;
+        }
+
+        template <uint32_t TileRow, uint32_t TileCol>
+        bool mappingTest()
+        {
+            using Transform       = detail::ApplySubBlock<FragT, SubFragT, TileRow, TileCol>;
+            using SliceMap        = typename Transform::SliceMap;
+            using InsertMap       = typename Transform::InsertMap;
+            using IOConfig        = GetIOConfig_t<FragT>;
+            using SubIOConfig     = GetIOConfig_t<SubFragT>;
+            using MatrixLayout    = typename IOConfig::IOLayout::MatrixLayout;
+            using SubMatrixLayout = typename SubIOConfig::IOLayout::MatrixLayout;
+
+            constexpr uint32_t WaveSize  = IOConfig::IOTraits::ThreadsPerIO;
+            constexpr uint32_t Size      = IOConfig::IOTraits::UnpackedSize;
+            constexpr uint32_t SubSize   = SubIOConfig::IOTraits::UnpackedSize;
+            constexpr uint32_t SubHeight = SubIOConfig::IOShape::BlockHeight;
+            constexpr uint32_t SubWidth  = SubIOConfig::IOShape::BlockWidth;
+
+            auto origin = make_coord2d(TileRow * SubHeight, TileCol * SubWidth);
+
+            bool err = false;
+
+            // Slice: every sub-fragment element reads the fragment at coord + origin
+            for(uint32_t e = 0; e < SubSize; e++)
+            {
+                auto sources = SliceMap::elementSources(e);
+                err |= !sources.isComplete;
+
+                for(uint32_t lane = 0; lane < WaveSize; lane++)
+                {
+                    auto src = SliceMap::srcRegisterCoord(lane, e);
+                    err |= !isSame(MatrixLayout::matrixCoord(get<0>(src), get<1>(src)),
+                                   SubMatrixLayout::matrixCoord(lane, e) + origin);
+                    err |= (sources.isLocal && get<0>(src) != lane);
+
+                    bool isCandidate = false;
+                    for(uint32_t c = 0; c < sources.count; c++)
+                    {
+                        isCandidate |= (sources.elementIdx[c] == get<1>(src));
+                    }
+                    err |= !isCandidate;
+                }
+            }
+
+            // Insert: only the tile is overwritten, from the sub-fragment at coord - origin
+            for(uint32_t e = 0; e < Size; e++)
+            {
+                for(uint32_t lane = 0; lane < WaveSize; lane++)
+                {
+                    auto coord  = MatrixLayout::matrixCoord(lane, e);
+                    bool inTile = (get<0>(coord) - get<0>(origin) < SubHeight)
+                                  && (get<1>(coord) - get<1>(origin) < SubWidth);
+
+                    err |= (InsertMap::isInBounds(InsertMap::srcMatrixCoord(lane, e)) != inTile);
+                    if(inTile)
+                    {
+                        auto src = InsertMap::srcRegisterCoord(lane, e);
+                        err |= !isSame(
+                            SubMatrixLayout::matrixCoord(get<0>(src), get<1>(src)) + origin,
+                            coord);
+                    }
+                }
+            }
+
+            return err;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                bool err = layoutTest<FragT>() || layoutTest<SubFragT>();
+
+                err = err || mappingTest<0, 0>() || mappingTest<0, 1>() || mappingTest<1, 0>()
+                      || mappingTest<1, 1>();
+
+                if(!err)
+                {
+                    auto& dataInstance               = Base::DataStorage::instance();
+                    dataInstance->hostOut().get()[0] = static_cast<DataT>(SUCCESS_VALUE);
+                }
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Check the single output result
+            Base::mValidationResult = (dataInstance->hostOut().get()[0] == DataT(SUCCESS_VALUE));
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct SubFragmentMappingGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            MatrixT     = 0,
+            BlockMN     = 1,
+            BlockK      = 2,
+            DataT       = 3,
+            DataLayoutT = 4,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = SubFragmentMappingKernel<
+                std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_SUB_FRAGMENT_MAPPING_HPP
@@ -0,0 +1,445 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_TINY_BATCHED_GEMM_HPP
+#define ROCWMMA_DETAIL_TINY_BATCHED_GEMM_HPP
+
+#include <algorithm>
+#include <cmath>
+
+#include "device/tiny_batched_gemm.hpp"
+#include "helper_macros.hpp"
+#include "reference.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Runs a batch of BlockM x BlockN x k gemms with one wave per problem.
+    // Problem size is interpreted as (batchCount, k), param1 as alpha and param2 as beta.
+    // Reports the throughput in problems / s alongside the usual TFlops / s.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              BatchIndexing Indexing>
+    struct TinyBatchedGemmKernel final : public UnitKernelBase<BlockM, BlockN, OutputT, row_major>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, OutputT, row_major>;
+
+        template <typename T>
+        using DevicePtrT = HipResource::DevicePtrT<T>;
+
+        template <typename T>
+        using HostPtrT = HipResource::HostPtrT<T>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using Predicates = TinyBatchedGemmPredicates<BlockM,
+                                                     BlockN,
+                                                     BlockK,
+                                                     InputT,
+                                                     OutputT,
+                                                     ComputeT,
+                                                     WaveSize,
+                                                     ArchId>;
+
+        enum : uint32_t
+        {
+            // Cold runs warm up clocks and caches, hot runs are timed
+            ColdRuns = 2u,
+            HotRuns  = 10u,
+
+            // Upper bound of resident workgroups per CU for the grid-stride loop
+            MaxWorkgroupsPerCu = 16u
+        };
+
+    public:
+        TinyBatchedGemmKernel()
+            : mDeviceA(HipResource::allocDevice<InputT>(0))
+            , mDeviceB(HipResource::allocDevice<InputT>(0))
+            , mDeviceArrayA(HipResource::allocDevice<InputT const*>(0))
+            , mDeviceArrayB(HipResource::allocDevice<InputT const*>(0))
+            , mDeviceArrayC(HipResource::allocDevice<OutputT const*>(0))
+            , mDeviceArrayD(HipResource::allocDevice<OutputT*>(0))
+            , mHostA(HipResource::allocHost<InputT>(0))
+            , mHostB(HipResource::allocHost<InputT>(0))
+        {
+        }
+        ~TinyBatchedGemmKernel() final = default;
+
+        uint32_t batchCount() const
+        {
+            return Base::mM;
+        }
+
+        uint32_t k() const
+        {
+            return Base::mN;
+        }
+
+        uint32_t wavesPerBlock() const
+        {
+            return Base::mTBlockX * Base::mTBlockY / Base::DeviceInfo::instance()->warpSize();
+        }
+
+        // Enough waves for one problem each, up to a full device
+        dim3 gridDim() const final
+        {
+            auto cuCount = static_cast<uint32_t>(Base::DeviceInfo::instance()->cuCount());
+            return dim3(std::min(ceilDiv(batchCount(), wavesPerBlock()),
+                                 cuCount * static_cast<uint32_t>(MaxWorkgroupsPerCu)));
+        }
+
+        // Any batch count is covered by the grid-stride loop
+        bool checkSizes() const final
+        {
+            return (batchCount() > 0u) && (k() >= BlockK) && (k() % BlockK == 0u);
+        }
+
+        // Dispatch the single wave gemm predicates against the runtime wave size and arch
+        bool checkDevice() const final
+        {
+            bool dispatchResult = false;
+
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = Predicates<WAVE_SIZE, ARCH_ID>::enableRun();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                          \
+    ROCWMMA_SWITCH_BODY8_ARG1(deviceArch,            \
+                              SWITCH_BODY_WAVE_SIZE, \
+                              HipDevice::GFX908,     \
+                              HipDevice::GFX90A,     \
+                              HipDevice::GFX940,     \
+                              HipDevice::GFX941,     \
+                              HipDevice::GFX942,     \
+                              HipDevice::GFX1100,    \
+                              HipDevice::GFX1101,    \
+                              HipDevice::GFX1102)
+
+            DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+            return Base::checkDevice() && dispatchResult;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // C and D are held by the unit resource as in / out, stacked row major
+            // (batchCount * BlockM) x BlockN. A and B are stacked in their own layouts.
+            auto sizeA = static_cast<int64_t>(batchCount()) * BlockM * k();
+            auto sizeB = static_cast<int64_t>(batchCount()) * k() * BlockN;
+            auto sizeC = static_cast<int64_t>(batchCount()) * BlockM * BlockN;
+
+            dataInstance->resizeStorage({batchCount() * BlockM, BlockN});
+            HipResource::reallocDeviceHostPair(mDeviceA, mHostA, sizeA);
+            HipResource::reallocDeviceHostPair(mDeviceB, mHostB, sizeB);
+
+            // Flat fills, which shift the pattern from one problem to the next
+            MatrixUtil<row_major>::fill(mHostA.get(), 1u, sizeA);
+            MatrixUtil<row_major>::fill(mHostB.get(), 1u, sizeB);
+            MatrixUtil<row_major>::fill(dataInstance->hostIn().get(), 1u, sizeC);
+
+            HipResource::copyData(mDeviceA, mHostA, sizeA);
+            HipResource::copyData(mDeviceB, mHostB, sizeB);
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), sizeC);
+
+            if constexpr(Indexing == BatchIndexing::PointerArray)
+            {
+                // A and B pointers run backwards through the batch, so that the
+                // problem order of the arrays does not match the memory order.
+                auto arrayA = HipResource::allocHost<InputT const*>(batchCount());
+                auto arrayB = HipResource::allocHost<InputT const*>(batchCount());
+                auto arrayC = HipResource::allocHost<OutputT const*>(batchCount());
+                auto arrayD = HipResource::allocHost<OutputT*>(batchCount());
+
+                for(uint32_t i = 0; i < batchCount(); i++)
+                {
+                    arrayA[i] = mDeviceA.get() + operandIndexAB(i) * BlockM * k();
+                    arrayB[i] = mDeviceB.get() + operandIndexAB(i) * k() * BlockN;
+                    arrayC[i] = dataInstance->deviceIn().get() + i * BlockM * BlockN;
+                    arrayD[i] = dataInstance->deviceOut().get() + i * BlockM * BlockN;
+                }
+
+                HipResource::reallocDevice(mDeviceArrayA, batchCount());
+                HipResource::reallocDevice(mDeviceArrayB, batchCount());
+                HipResource::reallocDevice(mDeviceArrayC, batchCount());
+                HipResource::reallocDevice(mDeviceArrayD, batchCount());
+
+                HipResource::copyData(mDeviceArrayA, arrayA, batchCount());
+                HipResource::copyData(mDeviceArrayB, arrayB, batchCount());
+                HipResource::copyData(mDeviceArrayC, arrayC, batchCount());
+                HipResource::copyData(mDeviceArrayD, arrayD, batchCount());
+            }
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                auto batchArgs = this->batchArgs();
+                auto alpha     = static_cast<ComputeT>(Base::mParam1);
+                auto beta      = static_cast<ComputeT>(Base::mParam2);
+
+                auto gemmKernel = [this, batchArgs, alpha, beta]() {
+                    hipExtLaunchKernelGGL((TinyBatchedGemm<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           LayoutA,
+                                                           LayoutB,
+                                                           Indexing>),
+                                          (this->gridDim()), // Wg grid size
+                                          (this->blockDim()), // Thread block size
+                                          0, // sharedMemBytes
+                                          0, // stream
+                                          nullptr, // Event start
+                                          nullptr, // event stop
+                                          0, // flags
+                                          this->batchCount(), // batchCount
+                                          this->k(), // k
+                                          batchArgs, // batch
+                                          alpha, // alpha
+                                          beta); // beta
+                };
+
+                for(uint32_t i = 0; i < ColdRuns; ++i)
+                {
+                    gemmKernel();
+                }
+
+                hipEvent_t startEvent, stopEvent;
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < HotRuns; ++i)
+                {
+                    gemmKernel();
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                auto& deviceInfo       = Base::DeviceInfo::instance();
+                auto  peakGFlopsPerSec = deviceInfo->template peakGFlopsPerSec<InputT>();
+
+                Base::mElapsedTimeMs = float64_t(timeMs);
+                Base::mTotalGFlops
+                    = calculateGFlops(BlockM, BlockN, k()) * static_cast<float64_t>(batchCount());
+                Base::mMeasuredTFlopsPerSec = Base::mTotalGFlops * HotRuns / Base::mElapsedTimeMs;
+                Base::mEfficiency
+                    = round(Base::mMeasuredTFlopsPerSec * 1.0e3 / peakGFlopsPerSec * 100.0);
+
+                mProblemsPerSec = static_cast<float64_t>(batchCount()) * HotRuns * 1.0e3
+                                  / Base::mElapsedTimeMs;
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto sizeC  = static_cast<int64_t>(batchCount()) * BlockM * BlockN;
+            auto result = HipResource::allocHost<OutputT>(sizeC);
+            auto ref    = HipResource::allocHost<OutputT>(sizeC);
+            HipResource::copyData(result, dataInstance->deviceOut(), sizeC);
+
+            // Every problem of the batch, including the tail of odd batch counts
+            auto alpha = static_cast<ComputeT>(Base::mParam1);
+            auto beta  = static_cast<ComputeT>(Base::mParam2);
+            for(uint32_t i = 0; i < batchCount(); i++)
+            {
+                gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, row_major, row_major>(
+                    BlockM,
+                    BlockN,
+                    k(),
+                    mHostA.get() + operandIndexAB(i) * BlockM * k(),
+                    mHostB.get() + operandIndexAB(i) * k() * BlockN,
+                    dataInstance->hostIn().get() + i * BlockM * BlockN,
+                    ref.get() + i * BlockM * BlockN,
+                    alpha,
+                    beta);
+            }
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<OutputT, OutputT, row_major, row_major>(
+                    result.get(), ref.get(), batchCount() * BlockM, BlockN);
+        }
+
+        void tearDown() final
+        {
+            // A and B are not shared with other kernels
+            HipResource::reallocDeviceHostPair(mDeviceA, mHostA, 0);
+            HipResource::reallocDeviceHostPair(mDeviceB, mHostB, 0);
+            HipResource::reallocDevice(mDeviceArrayA, 0);
+            HipResource::reallocDevice(mDeviceArrayB, 0);
+            HipResource::reallocDevice(mDeviceArrayC, 0);
+            HipResource::reallocDevice(mDeviceArrayD, 0);
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, BlkK, Batch, K, LytA_LytB, "
+                             "InputT, OutputT, ComputeT, Indexing, elapsedMs, "
+                             "Problem Size(GFlops), TFlops/s, Problems/s, Efficiency(%), Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", "
+                   << BlockK << ", " << batchCount() << ", " << k() << ", "
+                   << dataTypeToString<LayoutA>() << "_" << dataTypeToString<LayoutB>() << ", "
+                   << dataTypeToString<InputT>() << ", " << dataTypeToString<OutputT>() << ", "
+                   << dataTypeToString<ComputeT>() << ", "
+                   << (Indexing == BatchIndexing::Strided ? "Strided" : "PointerArray") << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "n/a, n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << Base::mElapsedTimeMs << ", " << Base::mTotalGFlops << ", "
+                       << Base::mMeasuredTFlopsPerSec << ", " << mProblemsPerSec << ", "
+                       << Base::mEfficiency << ", "
+                       << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+
+            return stream;
+        }
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+
+    private:
+        // Problem i reads the A / B operands at this index of the stacked buffers
+        uint64_t operandIndexAB(uint32_t i) const
+        {
+            return Indexing == BatchIndexing::PointerArray ? batchCount() - 1u - i : i;
+        }
+
+        batch_args_t<Indexing, InputT, OutputT> batchArgs() const
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            if constexpr(Indexing == BatchIndexing::Strided)
+            {
+                return {mDeviceA.get(),
+                        mDeviceB.get(),
+                        dataInstance->deviceIn().get(),
+                        dataInstance->deviceOut().get(),
+                        static_cast<uint64_t>(BlockM) * k(),
+                        static_cast<uint64_t>(k()) * BlockN,
+                        static_cast<uint64_t>(BlockM) * BlockN,
+                        static_cast<uint64_t>(BlockM) * BlockN};
+            }
+            else
+            {
+                return {mDeviceArrayA.get(),
+                        mDeviceArrayB.get(),
+                        mDeviceArrayC.get(),
+                        mDeviceArrayD.get()};
+            }
+        }
+
+    private:
+        DevicePtrT<InputT>         mDeviceA, mDeviceB;
+        DevicePtrT<InputT const*>  mDeviceArrayA, mDeviceArrayB;
+        DevicePtrT<OutputT const*> mDeviceArrayC;
+        DevicePtrT<OutputT*>       mDeviceArrayD;
+        HostPtrT<InputT>           mHostA, mHostB;
+
+        float64_t mProblemsPerSec = 0.0;
+    };
+
+    template <BatchIndexing Indexing>
+    struct TinyBatchedGemmGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            OutputT  = 1,
+            ComputeT = 2,
+            BlockM   = 3,
+            BlockN   = 4,
+            BlockK   = 5,
+            LayoutA  = 6,
+            LayoutB  = 7
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = TinyBatchedGemmKernel<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                        std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                        std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                        std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                        std::tuple_element_t<OutputT, TestParamsT>, // OutputT
+                                        std::tuple_element_t<ComputeT, TestParamsT>, // ComputeT
+                                        std::tuple_element_t<LayoutA, TestParamsT>, // LayoutA
+                                        std::tuple_element_t<LayoutB, TestParamsT>, // LayoutB
+                                        Indexing>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_TINY_BATCHED_GEMM_HPP
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_TINY_BATCHED_GEMM_HPP
+#define ROCWMMA_DEVICE_TINY_BATCHED_GEMM_HPP
+
+#include <rocwmma/rocwmma.hpp>
+
+#include "gemm/gemm_predicates_base.hpp"
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+    // How the kernel finds the operands of each problem of the batch
+    enum struct BatchIndexing : uint32_t
+    {
+        Strided, // Problem i starts at a + i * strideA, ...
+        PointerArray // Problem i starts at a[i], ...
+    };
+
+    template <typename InputT, typename OutputT>
+    struct StridedBatch
+    {
+        InputT const*  a;
+        InputT const*  b;
+        OutputT const* c;
+        OutputT*       d;
+        uint64_t       strideA, strideB, strideC, strideD;
+
+        ROCWMMA_DEVICE inline InputT const* problemA(uint32_t i) const
+        {
+            return a + i * strideA;
+        }
+        ROCWMMA_DEVICE inline InputT const* problemB(uint32_t i) const
+        {
+            return b + i * strideB;
+        }
+        ROCWMMA_DEVICE inline OutputT const* problemC(uint32_t i) const
+        {
+            return c + i * strideC;
+        }
+        ROCWMMA_DEVICE inline OutputT* problemD(uint32_t i) const
+        {
+            return d + i * strideD;
+        }
+    };
+
+    template <typename InputT, typename OutputT>
+    struct PointerArrayBatch
+    {
+        InputT const* const*  a;
+        InputT const* const*  b;
+        OutputT const* const* c;
+        OutputT* const*       d;
+
+        ROCWMMA_DEVICE inline InputT const* problemA(uint32_t i) const
+        {
+            return a[i];
+        }
+        ROCWMMA_DEVICE inline InputT const* problemB(uint32_t i) const
+        {
+            return b[i];
+        }
+        ROCWMMA_DEVICE inline OutputT const* problemC(uint32_t i) const
+        {
+            return c[i];
+        }
+        ROCWMMA_DEVICE inline OutputT* problemD(uint32_t i) const
+        {
+            return d[i];
+        }
+    };
+
+    template <BatchIndexing Indexing, typename InputT, typename OutputT>
+    using batch_args_t = conditional_t<Indexing == BatchIndexing::Strided,
+                                       StridedBatch<InputT, OutputT>,
+                                       PointerArrayBatch<InputT, OutputT>>;
+
+    // Problems are computed by single waves, so the gemm predicates are those of
+    // a one wave workgroup. The host dispatches them against the runtime arch.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    using TinyBatchedGemmPredicates = GemmPredicatesBase<BlockM,
+                                                         BlockN,
+                                                         BlockK,
+                                                         InputT,
+                                                         OutputT,
+                                                         ComputeT,
+                                                         1u,
+                                                         1u,
+                                                         WaveSize,
+                                                         1u,
+                                                         WaveSize,
+                                                         ArchId>;
+
+    // D = alpha * A x B + beta * C for a batch of BlockM x BlockN x k problems.
+    // Each wave computes whole problems end to end in registers, striding over
+    // the batch by the number of waves in the grid. There is no LDS and no
+    // workgroup barrier, so waves never wait on each other.
+    // Problems are packed: A and B in LayoutA / LayoutB, C and D in row major.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              BatchIndexing Indexing>
+    __global__ void TinyBatchedGemm(uint32_t                                     batchCount,
+                                    uint32_t                                     k,
+                                    batch_args_t<Indexing, InputT, OutputT> const batch,
+                                    ComputeT                                     alpha,
+                                    ComputeT                                     beta)
+    {
+        using Predicates = TinyBatchedGemmPredicates<BlockM,
+                                                     BlockN,
+                                                     BlockK,
+                                                     InputT,
+                                                     OutputT,
+                                                     ComputeT,
+                                                     Constants::AMDGCN_WAVE_SIZE,
+                                                     Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        if constexpr(Predicates::enableBuild())
+        {
+            using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+            using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+            using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, row_major>;
+            using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>;
+
+            constexpr bool IsRowMajorA = std::is_same_v<LayoutA, row_major>;
+            constexpr bool IsRowMajorB = std::is_same_v<LayoutB, row_major>;
+
+            // Packed leading dimensions, and the offsets of consecutive BlockK steps
+            auto lda   = IsRowMajorA ? k : BlockM;
+            auto ldb   = IsRowMajorB ? BlockN : k;
+            auto ldc   = BlockN;
+            auto incrA = IsRowMajorA ? BlockK : BlockK * lda;
+            auto incrB = IsRowMajorB ? BlockK * ldb : BlockK;
+
+            auto waveIndex = (blockIdx.x * blockDim.x * blockDim.y + threadIdx.y * blockDim.x
+                              + threadIdx.x)
+                             / Constants::AMDGCN_WAVE_SIZE;
+            auto waveCount = gridDim.x * blockDim.x * blockDim.y / Constants::AMDGCN_WAVE_SIZE;
+
+            // Wave-uniform loop over the problems of this wave
+            for(uint32_t problem = waveIndex; problem < batchCount; problem += waveCount)
+            {
+                auto* addrA = batch.problemA(problem);
+                auto* addrB = batch.problemB(problem);
+
+                auto fragA   = FragA();
+                auto fragB   = FragB();
+                auto fragC   = FragC();
+                auto fragAcc = FragAcc();
+                fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+                for(uint32_t kk = 0; kk < k; kk += BlockK)
+                {
+                    load_matrix_sync(fragA, addrA, lda);
+                    load_matrix_sync(fragB, addrB, ldb);
+                    mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+                    addrA += incrA;
+                    addrB += incrB;
+                }
+
+                load_matrix_sync(fragC, batch.problemC(problem), ldc);
+
+                // D = alpha * accumAB + beta * C
+#pragma unroll
+                for(int i = 0; i < fragC.num_elements; ++i)
+                {
+                    fragC.x[i]
+                        = OutputT(alpha * ComputeT(fragAcc.x[i]) + beta * ComputeT(fragC.x[i]));
+                }
+
+                store_matrix_sync(batch.problemD(problem), fragC, ldc);
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_TINY_BATCHED_GEMM_HPP
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <type_traits>
+
+#include "detail/tiny_batched_gemm.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+#include "unit_test_macros.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // InputT, OutputT, ComputeT, BlockM, BlockN, BlockK.
+        // Tiny problems of a single block, with one or a few BlockK steps.
+        using Types = std::tuple<
+            std::tuple<float16_t, float32_t, float32_t, I<16>, I<16>, I<16>>,
+            std::tuple<float16_t, float32_t, float32_t, I<32>, I<32>, I<8>>,
+            std::tuple<bfloat16_t, float32_t, float32_t, I<16>, I<16>, I<16>>,
+            std::tuple<float32_t, float32_t, float32_t, I<16>, I<16>, I<4>>>;
+        using Layouts      = typename Base::TestLayoutsAll;
+        using KernelParams = typename CombineLists<Types, Layouts, Layouts>::Result;
+
+        // Assemble the kernel generator
+        // Kernel: TinyBatchedGemm<BatchIndexing::PointerArray>
+        // Operands of problem i from arrays of device pointers
+        using GeneratorImpl   = TinyBatchedGemmGenerator<BatchIndexing::PointerArray>;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            // clang-format off
+            return { {warpSize, 1}, {warpSize * 4, 1} };
+            // clang-format on
+        }
+
+        // BatchCount, K
+        // Odd batch counts leave partially filled workgroups and grid-stride tails
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            // clang-format off
+            return { {1, 16}, {127, 16}, {4097, 32}, {65535, 16},
+#if ROCWMMA_EXTENDED_TESTS
+                     {262143, 16},
+#endif // ROCWMMA_EXTENDED_TESTS
+            };
+            // clang-format on
+        }
+
+        // Alpha
+        static inline std::vector<Param1T> param1s()
+        {
+            return {2.0};
+        }
+
+        // Beta
+        static inline std::vector<Param2T> param2s()
+        {
+            return {-1.0};
+        }
+    };
+
+} // namespace rocwmma
+
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(TinyBatchedGemmPointerArrayTest, TestParams)
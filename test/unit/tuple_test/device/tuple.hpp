@@ -323,6 +323,44 @@ namespace rocwmma
         return err;
     }
 
+    __device__ static inline bool unrollFlatTest()
+    {
+        bool err = false;
+
+        auto srcDims = make_vector(2u, 3u, 5u);
+
+        // Flat unroll with inflate_coord_left must visit the stride
+        // space in the same order as the equivalent nested loops.
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        auto expect = make_vector(0u, 0u, 0u);
+        auto count  = 0u;
+        auto visit  = [&](uint32_t i) {
+            auto result = inflate_coord_left(i, srcDims);
+            err |= (get<0>(expect) != get<0>(result)) || (get<1>(expect) != get<1>(result))
+                   || (get<2>(expect) != get<2>(result));
+            err |= (i != count++);
+
+            // Step the expected coordinate as nested loops would
+            get<2>(expect)++;
+            if(get<2>(expect) == get<2>(srcDims))
+            {
+                get<2>(expect) = 0u;
+                get<1>(expect)++;
+            }
+            if(get<1>(expect) == get<1>(srcDims))
+            {
+                get<1>(expect) = 0u;
+                get<0>(expect)++;
+            }
+        };
+
+        unroll_flat<2u * 3u * 5u>(visit);
+        err |= (count != 2u * 3u * 5u);
+
+        return err;
+    }
+
     template <typename DataT, uint32_t VecSize>
     __global__ void tupleTest(uint32_t     m,
                               uint32_t     n,
@@ -354,6 +392,7 @@ namespace rocwmma
         err = err ? err : inflateCoordLeftTest();
         err = err ? err : inflateCoordLeftWith1DimTest();
         err = err ? err : toMatrixSpaceTest();
+        err = err ? err : unrollFlatTest();
 
         // Reduce error count
         atomicAdd(&result, (int32_t)err);
@@ -36,13 +36,13 @@ namespace rocwmma
 {
 
     struct UnitTest
-        : public ::testing::TestWithParam<std::tuple<typename UnitTestParams::KernelT,
+        : public ::testing::TestWithParam<std::tuple<typename UnitTestParams::KernelFactoryT,
                                                      typename UnitTestParams::ThreadBlockT,
                                                      typename UnitTestParams::ProblemSizeT,
                                                      typename UnitTestParams::Param1T,
                                                      typename UnitTestParams::Param2T>>
     {
-        using Base = ::testing::TestWithParam<std::tuple<typename UnitTestParams::KernelT,
+        using Base = ::testing::TestWithParam<std::tuple<typename UnitTestParams::KernelFactoryT,
                                                          typename UnitTestParams::ThreadBlockT,
                                                          typename UnitTestParams::ProblemSizeT,
                                                          typename UnitTestParams::Param1T,
@@ -50,6 +50,9 @@
                            ::testing::ValuesIn(rocwmma::TestParamsClassName::threadBlocks()), \
                            ::testing::ValuesIn(rocwmma::TestParamsClassName::problemSizes()), \
                            ::testing::ValuesIn(rocwmma::TestParamsClassName::param1s()),      \
-                           ::testing::ValuesIn(rocwmma::TestParamsClassName::param2s())));
+                           ::testing::ValuesIn(rocwmma::TestParamsClassName::param2s())));    \
+                                                                                              \
+    /* The --kernel filter may remove every kernel of a suite */                              \
+    GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TestClassName);
 
 #endif // ROCWMMA_UNIT_TEST_MACROS_HPP
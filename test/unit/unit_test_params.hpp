@@ -142,11 +142,12 @@ namespace rocwmma
         ///
 
         // Types of parameters
-        using KernelT      = std::shared_ptr<KernelI>; // Kernel test interface
-        using ThreadBlockT = std::pair<int64_t, int64_t>;
-        using ProblemSizeT = std::pair<int64_t, int64_t>;
-        using Param1T      = float64_t;
-        using Param2T      = float64_t;
+        using KernelT        = std::shared_ptr<KernelI>; // Kernel test interface
+        using KernelFactoryT = KernelFactory<KernelT>; // Lazy kernel construction
+        using ThreadBlockT   = std::pair<int64_t, int64_t>;
+        using ProblemSizeT   = std::pair<int64_t, int64_t>;
+        using Param1T        = float64_t;
+        using Param2T        = float64_t;
 
         static inline std::vector<ThreadBlockT> threadBlocks()
         {